@@ -582,7 +582,7 @@ public:
     return {el.begin(), el.end()};
   }
   bool has_exclusion(int pid) const {
-    return std::find(el.begin(), el.end(), pid) != el.end();
+    return std::binary_search(el.begin(), el.end(), pid);
   }
 #endif
 
@@ -50,63 +50,57 @@ int min(int i, unsigned int j) { return std::min(i, static_cast<int>(j)); }
 
 namespace Accumulators {
 /** Compress computing arithmetic mean: A_compressed=(A1+A2)/2 */
-std::vector<double> compress_linear(std::vector<double> const &A1,
-                                    std::vector<double> const &A2) {
+void compress_linear(std::vector<double> const &A1,
+                     std::vector<double> const &A2,
+                     std::vector<double> &A_compressed) {
   assert(A1.size() == A2.size());
-  std::vector<double> A_compressed(A1.size());
+  assert(A_compressed.size() == A1.size());
 
   std::transform(A1.begin(), A1.end(), A2.begin(), A_compressed.begin(),
                  [](double a, double b) -> double { return 0.5 * (a + b); });
-
-  return A_compressed;
 }
 
 /** Compress discarding the 1st argument and return the 2nd */
-std::vector<double> compress_discard1(std::vector<double> const &A1,
-                                      std::vector<double> const &A2) {
+void compress_discard1(std::vector<double> const &A1,
+                       std::vector<double> const &A2,
+                       std::vector<double> &A_compressed) {
   assert(A1.size() == A2.size());
-  std::vector<double> A_compressed(A2);
-  return A_compressed;
+  assert(A_compressed.size() == A2.size());
+  std::copy(A2.begin(), A2.end(), A_compressed.begin());
 }
 
 /** Compress discarding the 2nd argument and return the 1st */
-std::vector<double> compress_discard2(std::vector<double> const &A1,
-                                      std::vector<double> const &A2) {
+void compress_discard2(std::vector<double> const &A1,
+                       std::vector<double> const &A2,
+                       std::vector<double> &A_compressed) {
   assert(A1.size() == A2.size());
-  std::vector<double> A_compressed(A1);
-  return A_compressed;
+  assert(A_compressed.size() == A1.size());
+  std::copy(A1.begin(), A1.end(), A_compressed.begin());
 }
 
-std::vector<double> scalar_product(std::vector<double> const &A,
-                                   std::vector<double> const &B,
-                                   Utils::Vector3d const &) {
+void scalar_product(std::vector<double> const &A, std::vector<double> const &B,
+                    Utils::Vector3d const &, std::vector<double> &C) {
   if (A.size() != B.size()) {
     throw std::runtime_error(
         "Error in scalar product: The vector sizes do not match");
   }
 
-  auto const result = std::inner_product(A.begin(), A.end(), B.begin(), 0.0);
-  return {result};
+  C[0] = std::inner_product(A.begin(), A.end(), B.begin(), 0.0);
 }
 
-std::vector<double> componentwise_product(std::vector<double> const &A,
-                                          std::vector<double> const &B,
-                                          Utils::Vector3d const &) {
-  std::vector<double> C(A.size());
+void componentwise_product(std::vector<double> const &A,
+                           std::vector<double> const &B,
+                           Utils::Vector3d const &, std::vector<double> &C) {
   if (A.size() != B.size()) {
     throw std::runtime_error(
         "Error in componentwise product: The vector sizes do not match");
   }
 
   std::transform(A.begin(), A.end(), B.begin(), C.begin(), std::multiplies<>());
-
-  return C;
 }
 
-std::vector<double> tensor_product(std::vector<double> const &A,
-                                   std::vector<double> const &B,
-                                   Utils::Vector3d const &) {
-  std::vector<double> C(A.size() * B.size());
+void tensor_product(std::vector<double> const &A, std::vector<double> const &B,
+                    Utils::Vector3d const &, std::vector<double> &C) {
   auto C_it = C.begin();
 
   for (double a : A) {
@@ -114,33 +108,27 @@ std::vector<double> tensor_product(std::vector<double> const &A,
       *(C_it++) = a * b;
     }
   }
-
-  return C;
 }
 
-std::vector<double> square_distance_componentwise(std::vector<double> const &A,
-                                                  std::vector<double> const &B,
-                                                  Utils::Vector3d const &) {
+void square_distance_componentwise(std::vector<double> const &A,
+                                   std::vector<double> const &B,
+                                   Utils::Vector3d const &,
+                                   std::vector<double> &C) {
   if (A.size() != B.size()) {
     throw std::runtime_error(
         "Error in square distance componentwise: The vector sizes do not "
         "match.");
   }
 
-  std::vector<double> C(A.size());
-
   std::transform(
       A.begin(), A.end(), B.begin(), C.begin(),
       [](double a, double b) -> double { return Utils::sqr(a - b); });
-
-  return C;
 }
 
 // note: the argument name wsquare denotes that its value is w^2 while the user
 // sets w
-std::vector<double> fcs_acf(std::vector<double> const &A,
-                            std::vector<double> const &B,
-                            Utils::Vector3d const &wsquare) {
+void fcs_acf(std::vector<double> const &A, std::vector<double> const &B,
+             Utils::Vector3d const &wsquare, std::vector<double> &C) {
   if (A.size() != B.size()) {
     throw std::runtime_error(
         "Error in fcs_acf: The vector sizes do not match.");
@@ -148,22 +136,18 @@ std::vector<double> fcs_acf(std::vector<double> const &A,
 
   auto const C_size = A.size() / 3;
   assert(3 * C_size == A.size());
-
-  std::vector<double> C(C_size, 0);
+  assert(C.size() == C_size);
 
   for (std::size_t i = 0; i < C_size; i++) {
+    auto c = 0.;
     for (int j = 0; j < 3; j++) {
       auto const &a = A[3 * i + j];
       auto const &b = B[3 * i + j];
 
-      C[i] -= Utils::sqr(a - b) / wsquare[j];
+      c -= Utils::sqr(a - b) / wsquare[j];
     }
+    C[i] = std::exp(c);
   }
-
-  std::transform(C.begin(), C.end(), C.begin(),
-                 [](double c) -> double { return std::exp(c); });
-
-  return C;
 }
 
 void Correlator::initialize() {
@@ -280,6 +264,8 @@ void Correlator::initialize() {
   B.resize(std::array<int, 2>{{m_hierarchy_depth, m_tau_lin + 1}});
   std::fill_n(B.data(), B.num_elements(), std::vector<double>(dim_B, 0));
 
+  m_corr_buffer = std::vector<double>(m_dim_corr, 0);
+
   n_data = 0;
   A_accumulated_average = std::vector<double>(dim_A, 0);
   B_accumulated_average = std::vector<double>(dim_B, 0);
@@ -349,12 +335,12 @@ void Correlator::update() {
     // folding)
     newest[i + 1] = (newest[i + 1] + 1) % (m_tau_lin + 1);
     n_vals[i + 1] += 1;
-    A[i + 1][newest[i + 1]] =
-        (*compressA)(A[i][(newest[i] + 1) % (m_tau_lin + 1)],
-                     A[i][(newest[i] + 2) % (m_tau_lin + 1)]);
-    B[i + 1][newest[i + 1]] =
-        (*compressB)(B[i][(newest[i] + 1) % (m_tau_lin + 1)],
-                     B[i][(newest[i] + 2) % (m_tau_lin + 1)]);
+    (*compressA)(A[i][(newest[i] + 1) % (m_tau_lin + 1)],
+                 A[i][(newest[i] + 2) % (m_tau_lin + 1)],
+                 A[i + 1][newest[i + 1]]);
+    (*compressB)(B[i][(newest[i] + 1) % (m_tau_lin + 1)],
+                 B[i][(newest[i] + 2) % (m_tau_lin + 1)],
+                 B[i + 1][newest[i + 1]]);
   }
 
   newest[0] = (newest[0] + 1) % (m_tau_lin + 1);
@@ -364,6 +350,7 @@ void Correlator::update() {
   if (A_obs != B_obs) {
     B[0][newest[0]] = B_obs->operator()();
   } else {
+    // same size, so this copies without reallocating
     B[0][newest[0]] = A[0][newest[0]];
   }
 
@@ -382,13 +369,12 @@ void Correlator::update() {
   for (long j = 0; j < min(m_tau_lin + 1, n_vals[0]); j++) {
     auto const index_new = newest[0];
     auto const index_old = (newest[0] - j + m_tau_lin + 1) % (m_tau_lin + 1);
-    auto const temp =
-        (corr_operation)(A[0][index_old], B[0][index_new], m_correlation_args);
-    assert(temp.size() == m_dim_corr);
+    (corr_operation)(A[0][index_old], B[0][index_new], m_correlation_args,
+                     m_corr_buffer);
 
     n_sweeps[j]++;
     for (index_type k = 0; k < static_cast<index_type>(m_dim_corr); k++) {
-      result[j][k] += temp[k];
+      result[j][k] += m_corr_buffer[k];
     }
   }
   // Now for the higher ones
@@ -399,13 +385,12 @@ void Correlator::update() {
       auto const index_old = (newest[i] - j + m_tau_lin + 1) % (m_tau_lin + 1);
       auto const index_res =
           m_tau_lin + (i - 1) * m_tau_lin / 2 + (j - m_tau_lin / 2 + 1) - 1;
-      auto const temp = (corr_operation)(A[i][index_old], B[i][index_new],
-                                         m_correlation_args);
-      assert(temp.size() == m_dim_corr);
+      (corr_operation)(A[i][index_old], B[i][index_new], m_correlation_args,
+                       m_corr_buffer);
 
       n_sweeps[index_res]++;
       for (index_type k = 0; k < static_cast<index_type>(m_dim_corr); k++) {
-        result[index_res][k] += temp[k];
+        result[index_res][k] += m_corr_buffer[k];
       }
     }
   }
@@ -458,11 +443,6 @@ int Correlator::finalize() {
         // folding)
         newest[i + 1] = (newest[i + 1] + 1) % (m_tau_lin + 1);
         n_vals[i + 1] += 1;
-
-        (*compressA)(A[i][(newest[i] + 1) % (m_tau_lin + 1)],
-                     A[i][(newest[i] + 2) % (m_tau_lin + 1)]);
-        (*compressB)(B[i][(newest[i] + 1) % (m_tau_lin + 1)],
-                     B[i][(newest[i] + 2) % (m_tau_lin + 1)]);
       }
       newest[ll] = (newest[ll] + 1) % (m_tau_lin + 1);
 
@@ -476,13 +456,12 @@ int Correlator::finalize() {
           auto const index_res =
               m_tau_lin + (i - 1) * m_tau_lin / 2 + (j - m_tau_lin / 2 + 1) - 1;
 
-          auto const temp = (corr_operation)(A[i][index_old], B[i][index_new],
-                                             m_correlation_args);
-          assert(temp.size() == m_dim_corr);
+          (corr_operation)(A[i][index_old], B[i][index_new],
+                           m_correlation_args, m_corr_buffer);
 
           n_sweeps[index_res]++;
           for (index_type k = 0; k < static_cast<index_type>(m_dim_corr); k++) {
-            result[index_res][k] += temp[k];
+            result[index_res][k] += m_corr_buffer[k];
           }
         }
       }
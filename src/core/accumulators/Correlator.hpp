@@ -264,14 +264,21 @@ private:
   std::size_t dim_B;                ///< dimensionality of B
   std::vector<std::size_t> m_shape; ///< dimensionality of the correlation
 
-  using correlation_operation_type = std::vector<double> (*)(
-      std::vector<double> const &, std::vector<double> const &,
-      Utils::Vector3d const &);
+  /** Correlation operations write into a pre-allocated output buffer,
+   *  so that @ref update() does not allocate.
+   */
+  using correlation_operation_type = void (*)(std::vector<double> const &,
+                                              std::vector<double> const &,
+                                              Utils::Vector3d const &,
+                                              std::vector<double> &);
 
   correlation_operation_type corr_operation;
+  std::vector<double> m_corr_buffer; ///< output of @ref corr_operation
 
-  using compression_function = std::vector<double> (*)(
-      std::vector<double> const &A1, std::vector<double> const &A2);
+  /** Compression functions write into the (pre-allocated) target sample. */
+  using compression_function = void (*)(std::vector<double> const &A1,
+                                        std::vector<double> const &A2,
+                                        std::vector<double> &A_compressed);
 
   // compression functions
   compression_function compressA;
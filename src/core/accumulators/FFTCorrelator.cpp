@@ -0,0 +1,435 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "FFTCorrelator.hpp"
+
+#ifdef FFTW
+
+#include "integrate.hpp"
+
+#include <utils/math/sqr.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <fftw3.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Accumulators {
+namespace detail {
+/** Buffers and plans for batches of zero-padded 1D transforms. */
+struct FFTCorrelatorWorkspace {
+  /** Number of components transformed together. */
+  static constexpr std::size_t max_batch_size = 64;
+
+  FFTCorrelatorWorkspace(std::size_t window, std::size_t dim)
+      : n_fft(4 * window), n_modes(n_fft / 2 + 1),
+        batch_size(std::min(dim, max_batch_size)),
+        in_A(fftw_alloc_real(batch_size * n_fft)),
+        in_B(fftw_alloc_real(batch_size * n_fft)),
+        out_A(fftw_alloc_complex(batch_size * n_modes)),
+        out_B(fftw_alloc_complex(batch_size * n_modes)),
+        prefix_A(2 * window + 1), prefix_B(2 * window + 1) {
+    if (!in_A or !in_B or !out_A or !out_B) {
+      free_buffers();
+      throw std::bad_alloc();
+    }
+    auto const n = static_cast<int>(n_fft);
+    auto const n_c = static_cast<int>(n_modes);
+    auto const howmany = static_cast<int>(batch_size);
+    forward = fftw_plan_many_dft_r2c(1, &n, howmany, in_A, nullptr, 1, n,
+                                     out_A, nullptr, 1, n_c, FFTW_MEASURE);
+    backward = fftw_plan_many_dft_c2r(1, &n, howmany, out_A, nullptr, 1, n_c,
+                                      in_A, nullptr, 1, n, FFTW_MEASURE);
+  }
+  ~FFTCorrelatorWorkspace() {
+    fftw_destroy_plan(forward);
+    fftw_destroy_plan(backward);
+    free_buffers();
+  }
+  FFTCorrelatorWorkspace(FFTCorrelatorWorkspace const &) = delete;
+  FFTCorrelatorWorkspace &operator=(FFTCorrelatorWorkspace const &) = delete;
+
+  std::size_t n_fft;      ///< length of the zero-padded signal
+  std::size_t n_modes;    ///< number of Fourier modes of a real signal
+  std::size_t batch_size; ///< number of components per transform
+  double *in_A;
+  double *in_B;
+  fftw_complex *out_A;
+  fftw_complex *out_B;
+  std::vector<double> prefix_A; ///< prefix sums of the squares of A
+  std::vector<double> prefix_B; ///< prefix sums of the squares of B
+  fftw_plan forward;
+  fftw_plan backward;
+
+private:
+  void free_buffers() {
+    fftw_free(in_A);
+    fftw_free(in_B);
+    fftw_free(out_A);
+    fftw_free(out_B);
+  }
+};
+} // namespace detail
+
+FFTCorrelator::FFTCorrelator(double tau_max, int delta_N,
+                             std::string corr_operation, obs_ptr obs1,
+                             obs_ptr obs2)
+    : AccumulatorBase(delta_N), m_tau_max(tau_max),
+      m_dt(delta_N * get_time_step()),
+      m_corr_operation_name(std::move(corr_operation)),
+      m_obs1(std::move(obs1)), m_obs2(std::move(obs2)) {
+  if (m_tau_max < m_dt) {
+    throw std::runtime_error("tau_max must be >= delta_t (delta_N too large)");
+  }
+  // tau_max is usually a multiple of the sampling interval; do not let
+  // round-off in the ratio add a lag
+  auto const n_lags = m_tau_max / m_dt;
+  auto const n_lags_nearest = std::round(n_lags);
+  m_window = static_cast<std::size_t>(
+      (std::abs(n_lags - n_lags_nearest) <= 1e-9 * n_lags_nearest)
+          ? n_lags_nearest
+          : std::ceil(n_lags));
+
+  assert(m_obs1);
+  assert(m_obs2);
+  m_dim_A = m_obs1->n_values();
+  m_dim_B = m_obs2->n_values();
+
+  if (m_dim_A == 0) {
+    throw std::runtime_error("dimension of first observable has to be >= 1");
+  }
+  if (m_dim_B == 0) {
+    throw std::runtime_error("dimension of second observable has to be >= 1");
+  }
+  if (m_dim_A != m_dim_B) {
+    throw std::runtime_error(
+        "the FFT correlator requires observables of equal dimensions");
+  }
+
+  if (m_corr_operation_name == "componentwise_product") {
+    m_operation = Operation::COMPONENTWISE;
+    m_dim_corr = m_dim_A;
+    m_shape = m_obs1->shape();
+  } else if (m_corr_operation_name == "square_distance_componentwise") {
+    m_operation = Operation::SQUARE_DISTANCE;
+    m_dim_corr = m_dim_A;
+    m_shape = m_obs1->shape();
+  } else if (m_corr_operation_name == "scalar_product") {
+    m_operation = Operation::SCALAR;
+    m_dim_corr = 1;
+    m_shape = {1};
+  } else {
+    throw std::invalid_argument("correlation operation '" +
+                                m_corr_operation_name +
+                                "' not implemented in the FFT correlator");
+  }
+
+  m_A_prev = std::vector<double>(m_window * m_dim_A, 0.);
+  m_A_curr = std::vector<double>(m_window * m_dim_A, 0.);
+  m_B_curr = std::vector<double>(m_window * m_dim_B, 0.);
+
+  auto const n_result = n_values();
+  m_estimates.sum = std::vector<double>(n_result * m_dim_corr, 0.);
+  m_estimates.n_sweeps = std::vector<std::size_t>(n_result, 0u);
+  m_estimates.block_sum = std::vector<double>(n_result * m_dim_corr, 0.);
+  m_estimates.block_sum2 = std::vector<double>(n_result * m_dim_corr, 0.);
+  m_estimates.n_blocks = std::vector<std::size_t>(n_result, 0u);
+  m_window_sums = std::vector<double>(n_result * m_dim_corr, 0.);
+
+  m_workspace =
+      std::make_unique<detail::FFTCorrelatorWorkspace>(m_window, m_dim_A);
+}
+
+FFTCorrelator::~FFTCorrelator() = default;
+
+void FFTCorrelator::update() {
+  if (m_finalized) {
+    throw std::runtime_error(
+        "No data can be added after finalize() was called.");
+  }
+
+  auto const sample_A = m_obs1->operator()();
+  assert(sample_A.size() == m_dim_A);
+  std::copy(sample_A.begin(), sample_A.end(),
+            m_A_curr.begin() +
+                static_cast<std::ptrdiff_t>(m_n_pending * m_dim_A));
+  if (m_obs1 == m_obs2) {
+    std::copy(sample_A.begin(), sample_A.end(),
+              m_B_curr.begin() +
+                  static_cast<std::ptrdiff_t>(m_n_pending * m_dim_B));
+  } else {
+    auto const sample_B = m_obs2->operator()();
+    assert(sample_B.size() == m_dim_B);
+    std::copy(sample_B.begin(), sample_B.end(),
+              m_B_curr.begin() +
+                  static_cast<std::ptrdiff_t>(m_n_pending * m_dim_B));
+  }
+  ++m_n_pending;
+
+  if (m_n_pending == m_window) {
+    accumulate_window(m_window, m_estimates);
+    std::swap(m_A_prev, m_A_curr);
+    ++m_n_windows;
+    m_n_pending = 0;
+  }
+}
+
+void FFTCorrelator::finalize() {
+  if (m_finalized) {
+    throw std::runtime_error(
+        "FFTCorrelator::finalize() can only be called once.");
+  }
+  m_finalized = true;
+  if (m_n_pending) {
+    accumulate_window(m_n_pending, m_estimates);
+    m_n_pending = 0;
+  }
+}
+
+void FFTCorrelator::accumulate_window(std::size_t n_valid,
+                                      Estimates &estimates) {
+  auto &ws = *m_workspace;
+  auto const window = m_window;
+  auto const n_fft = ws.n_fft;
+  auto const n_modes = ws.n_modes;
+  auto const dim = m_dim_A;
+  auto const n_lags = n_values();
+  auto const x_end = window + n_valid;
+  auto const first_sample = m_n_windows * window;
+
+  /* Targets of B are at positions [window, x_end) of the concatenated
+   * windows, their origins at position x - tau. Origins before the first
+   * sample are excluded, i.e. x >= x_begin(tau). */
+  auto const x_begin = [=](std::size_t tau) {
+    return window + ((tau > first_sample) ? tau - first_sample : 0u);
+  };
+  auto const n_pairs = [=](std::size_t tau) {
+    auto const x0 = x_begin(tau);
+    return (x_end > x0) ? x_end - x0 : std::size_t{0};
+  };
+
+  auto const sample = [dim](std::vector<double> const &data, std::size_t t,
+                            std::size_t c) { return data[t * dim + c]; };
+
+  for (std::size_t c0 = 0; c0 < dim; c0 += ws.batch_size) {
+    auto const n_batch = std::min(ws.batch_size, dim - c0);
+
+    for (std::size_t j = 0; j < ws.batch_size; ++j) {
+      auto *const a = ws.in_A + j * n_fft;
+      auto *const b = ws.in_B + j * n_fft;
+      std::fill_n(a, n_fft, 0.);
+      std::fill_n(b, n_fft, 0.);
+      if (j >= n_batch)
+        continue;
+      auto const c = c0 + j;
+      for (std::size_t t = 0; t < window; ++t) {
+        a[t] = sample(m_A_prev, t, c);
+      }
+      for (std::size_t t = 0; t < n_valid; ++t) {
+        a[window + t] = sample(m_A_curr, t, c);
+        b[window + t] = sample(m_B_curr, t, c);
+      }
+    }
+
+    fftw_execute_dft_r2c(ws.forward, ws.in_A, ws.out_A);
+    fftw_execute_dft_r2c(ws.forward, ws.in_B, ws.out_B);
+
+    // cross-correlation: conj(FT[A]) * FT[B]
+    for (std::size_t k = 0; k < n_batch * n_modes; ++k) {
+      auto const re_a = ws.out_A[k][0];
+      auto const im_a = ws.out_A[k][1];
+      auto const re_b = ws.out_B[k][0];
+      auto const im_b = ws.out_B[k][1];
+      ws.out_A[k][0] = re_a * re_b + im_a * im_b;
+      ws.out_A[k][1] = re_a * im_b - im_a * re_b;
+    }
+
+    fftw_execute_dft_c2r(ws.backward, ws.out_A, ws.in_A);
+
+    auto const norm = 1. / static_cast<double>(n_fft);
+    for (std::size_t j = 0; j < n_batch; ++j) {
+      auto const c = c0 + j;
+      auto const *const cross = ws.in_A + j * n_fft;
+
+      if (m_operation == Operation::SQUARE_DISTANCE) {
+        auto &prefix_A = ws.prefix_A;
+        auto &prefix_B = ws.prefix_B;
+        prefix_A[0] = prefix_B[0] = 0.;
+        for (std::size_t x = 0; x < 2 * window; ++x) {
+          auto a = 0.;
+          auto b = 0.;
+          if (x < window) {
+            a = sample(m_A_prev, x, c);
+          } else if (x < x_end) {
+            a = sample(m_A_curr, x - window, c);
+            b = sample(m_B_curr, x - window, c);
+          }
+          prefix_A[x + 1] = prefix_A[x] + Utils::sqr(a);
+          prefix_B[x + 1] = prefix_B[x] + Utils::sqr(b);
+        }
+        for (std::size_t tau = 0; tau < n_lags; ++tau) {
+          if (n_pairs(tau) == 0)
+            continue;
+          auto const x0 = x_begin(tau);
+          auto const sq_A = prefix_A[x_end - tau] - prefix_A[x0 - tau];
+          auto const sq_B = prefix_B[x_end] - prefix_B[x0];
+          m_window_sums[tau * m_dim_corr + c] =
+              sq_A + sq_B - 2. * norm * cross[tau];
+        }
+      } else if (m_operation == Operation::COMPONENTWISE) {
+        for (std::size_t tau = 0; tau < n_lags; ++tau) {
+          m_window_sums[tau * m_dim_corr + c] = norm * cross[tau];
+        }
+      } else {
+        for (std::size_t tau = 0; tau < n_lags; ++tau) {
+          if (c == 0)
+            m_window_sums[tau] = 0.;
+          m_window_sums[tau] += norm * cross[tau];
+        }
+      }
+    }
+  }
+
+  for (std::size_t tau = 0; tau < n_lags; ++tau) {
+    auto const n = n_pairs(tau);
+    if (n == 0)
+      continue;
+    estimates.n_sweeps[tau] += n;
+    estimates.n_blocks[tau] += 1;
+    for (std::size_t k = 0; k < m_dim_corr; ++k) {
+      auto const i = tau * m_dim_corr + k;
+      auto const value = m_window_sums[i];
+      auto const block_average = value / static_cast<double>(n);
+      estimates.sum[i] += value;
+      estimates.block_sum[i] += block_average;
+      estimates.block_sum2[i] += Utils::sqr(block_average);
+    }
+  }
+}
+
+FFTCorrelator::Estimates FFTCorrelator::current_estimates() {
+  auto estimates = m_estimates;
+  if (m_n_pending) {
+    accumulate_window(m_n_pending, estimates);
+  }
+  return estimates;
+}
+
+std::vector<double> FFTCorrelator::get_correlation() {
+  auto const estimates = current_estimates();
+  std::vector<double> res(estimates.sum.size(), 0.);
+  for (std::size_t tau = 0; tau < n_values(); ++tau) {
+    auto const n = estimates.n_sweeps[tau];
+    if (n == 0)
+      continue;
+    for (std::size_t k = 0; k < m_dim_corr; ++k) {
+      auto const i = tau * m_dim_corr + k;
+      res[i] = estimates.sum[i] / static_cast<double>(n);
+    }
+  }
+  return res;
+}
+
+std::vector<double> FFTCorrelator::get_correlation_error() {
+  auto const estimates = current_estimates();
+  std::vector<double> res(estimates.sum.size(),
+                          std::numeric_limits<double>::max());
+  for (std::size_t tau = 0; tau < n_values(); ++tau) {
+    auto const n = static_cast<double>(estimates.n_blocks[tau]);
+    if (n < 2.)
+      continue;
+    for (std::size_t k = 0; k < m_dim_corr; ++k) {
+      auto const i = tau * m_dim_corr + k;
+      auto const mean = estimates.block_sum[i] / n;
+      auto const variance =
+          std::max(0., estimates.block_sum2[i] / n - Utils::sqr(mean)) * n /
+          (n - 1.);
+      res[i] = std::sqrt(variance / n);
+    }
+  }
+  return res;
+}
+
+std::vector<int> FFTCorrelator::get_samples_sizes() {
+  auto const estimates = current_estimates();
+  return {estimates.n_sweeps.begin(), estimates.n_sweeps.end()};
+}
+
+std::vector<double> FFTCorrelator::get_lag_times() const {
+  std::vector<double> res(n_values());
+  for (std::size_t tau = 0; tau < res.size(); ++tau) {
+    res[tau] = static_cast<double>(tau) * m_dt;
+  }
+  return res;
+}
+
+std::string FFTCorrelator::get_internal_state() const {
+  std::stringstream ss;
+  boost::archive::binary_oarchive oa(ss);
+
+  oa << m_n_windows;
+  oa << m_n_pending;
+  oa << m_A_prev;
+  oa << m_A_curr;
+  oa << m_B_curr;
+  oa << m_estimates.sum;
+  oa << m_estimates.n_sweeps;
+  oa << m_estimates.block_sum;
+  oa << m_estimates.block_sum2;
+  oa << m_estimates.n_blocks;
+
+  return ss.str();
+}
+
+void FFTCorrelator::set_internal_state(std::string const &state) {
+  namespace iostreams = boost::iostreams;
+  iostreams::array_source src(state.data(), state.size());
+  iostreams::stream<iostreams::array_source> ss(src);
+  boost::archive::binary_iarchive ia(ss);
+
+  ia >> m_n_windows;
+  ia >> m_n_pending;
+  ia >> m_A_prev;
+  ia >> m_A_curr;
+  ia >> m_B_curr;
+  ia >> m_estimates.sum;
+  ia >> m_estimates.n_sweeps;
+  ia >> m_estimates.block_sum;
+  ia >> m_estimates.block_sum2;
+  ia >> m_estimates.n_blocks;
+}
+
+} // namespace Accumulators
+
+#endif // FFTW
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_ACCUMULATORS_FFTCORRELATOR_HPP
+#define CORE_ACCUMULATORS_FFTCORRELATOR_HPP
+/** @file
+ *
+ * Exact time correlations of two observables computed in blocks with FFTs.
+ *
+ * Samples of A and B are buffered in windows of @c W consecutive samples,
+ * where @c W is the largest lag. When a window is full, every pair
+ * <tt>(A(t - tau), B(t))</tt> with @c t in the window and
+ * <tt>0 <= tau <= W</tt> is correlated at once: the previous and the current
+ * window of A and the current window of B are zero-padded to length
+ * <tt>4 W</tt>, Fourier transformed, multiplied and transformed back
+ * (Wiener-Khinchin theorem). Every time origin is used, so the result is
+ * identical to a linear correlator without compression, at a cost of
+ * <tt>O(log W)</tt> instead of <tt>O(W)</tt> operations per sample and
+ * component. Square distances (e.g. mean square displacements) are obtained
+ * from the cross-correlation and prefix sums of the squared samples.
+ *
+ * The correlation of each window is also kept as an independent estimate,
+ * from which a block-averaged standard error is derived. The estimate is
+ * only meaningful if the window is longer than the correlation time of the
+ * observables.
+ */
+
+#include "config/config.hpp"
+
+#ifdef FFTW
+
+#include "AccumulatorBase.hpp"
+#include "observables/Observable.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Accumulators {
+
+namespace detail {
+struct FFTCorrelatorWorkspace;
+} // namespace detail
+
+class FFTCorrelator : public AccumulatorBase {
+  using obs_ptr = std::shared_ptr<Observables::Observable>;
+
+public:
+  /**
+   *  @param delta_N The number of time steps between subsequent updates
+   *  @param tau_max Largest time delay to sample
+   *  @param obs1 First observable to correlate
+   *  @param obs2 Second observable to correlate
+   *  @param corr_operation How to correlate the two observables: one of
+   *      "componentwise_product", "scalar_product" or
+   *      "square_distance_componentwise"
+   */
+  FFTCorrelator(double tau_max, int delta_N, std::string corr_operation,
+                obs_ptr obs1, obs_ptr obs2);
+  ~FFTCorrelator() override;
+
+  /** Sample the observables. The samples are correlated whenever a window
+   *  is complete; this path does not allocate memory besides the
+   *  evaluation of the observables.
+   */
+  void update() override;
+
+  /** Correlate the samples of the incomplete window. No data can be added
+   *  afterwards.
+   */
+  void finalize();
+
+  /** Return the correlation for lags <tt>0, dt, ..., tau_max</tt>. */
+  std::vector<double> get_correlation();
+  /** Return the block-averaged standard error of the correlation. */
+  std::vector<double> get_correlation_error();
+  std::vector<int> get_samples_sizes();
+  std::vector<double> get_lag_times() const;
+
+  std::size_t n_values() const { return m_window + 1; }
+  std::vector<std::size_t> shape() const override {
+    std::vector<std::size_t> shape = m_shape;
+    shape.insert(shape.begin(), n_values());
+    return shape;
+  }
+
+  double tau_max() const { return m_tau_max; }
+  double dt() const { return m_dt; }
+  std::string const &correlation_operation() const {
+    return m_corr_operation_name;
+  }
+
+  /** Partial serialization of state that is not accessible via the interface.
+   */
+  std::string get_internal_state() const;
+  void set_internal_state(std::string const &);
+
+private:
+  enum class Operation { COMPONENTWISE, SCALAR, SQUARE_DISTANCE };
+
+  /** Accumulated correlation estimates. */
+  struct Estimates {
+    std::vector<double> sum;           ///< sum over all pairs, per lag
+    std::vector<std::size_t> n_sweeps; ///< number of pairs, per lag
+    std::vector<double> block_sum;     ///< sum of the window averages
+    std::vector<double> block_sum2;    ///< sum of their squares
+    std::vector<std::size_t> n_blocks; ///< number of window averages
+  };
+
+  /** Correlate the first @p n_valid samples of the current window with the
+   *  current and the previous window and add the result to @p estimates.
+   */
+  void accumulate_window(std::size_t n_valid, Estimates &estimates);
+  /** Estimates including the samples of the incomplete window. */
+  Estimates current_estimates();
+
+  double m_tau_max;
+  double m_dt;
+  std::string m_corr_operation_name;
+  Operation m_operation;
+  obs_ptr m_obs1;
+  obs_ptr m_obs2;
+
+  std::size_t m_window;   ///< samples per window, equal to the largest lag
+  std::size_t m_dim_A;    ///< dimensionality of A
+  std::size_t m_dim_B;    ///< dimensionality of B
+  std::size_t m_dim_corr; ///< number of columns of the correlation
+  std::vector<std::size_t> m_shape;
+
+  bool m_finalized = false;
+  std::size_t m_n_windows = 0; ///< number of completed windows
+  std::size_t m_n_pending = 0; ///< samples in the current window
+
+  /** @name Sample windows, stored row-major by time.
+   *  Time origins reach back into the previous window of A, while the
+   *  samples of B are only needed for the current window.
+   */
+  /**@{*/
+  std::vector<double> m_A_prev;
+  std::vector<double> m_A_curr;
+  std::vector<double> m_B_curr;
+  /**@}*/
+
+  Estimates m_estimates;
+  std::vector<double> m_window_sums; ///< correlation sums of a single window
+
+  std::unique_ptr<detail::FFTCorrelatorWorkspace> m_workspace;
+};
+
+} // namespace Accumulators
+
+#endif // FFTW
+#endif
@@ -20,21 +20,117 @@
 
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/iostreams/device/array.hpp>
 #include <boost/iostreams/stream.hpp>
 #include <boost/serialization/vector.hpp>
 
+#include <cstddef>
+#include <cstdio>
+#include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Accumulators {
-void TimeSeries::update() { m_data.emplace_back(m_obs->operator()()); }
+namespace {
+struct FileCloser {
+  void operator()(std::FILE *f) const { std::fclose(f); }
+};
+using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+} // namespace
+
+TimeSeries::TimeSeries(std::shared_ptr<Observables::Observable> obs,
+                       int delta_N, std::string filename,
+                       std::size_t buffer_size)
+    : AccumulatorBase(delta_N), m_obs(std::move(obs)),
+      m_filename(std::move(filename)), m_buffer_size(buffer_size),
+      m_stride(m_obs->n_values()) {
+  if (file_backed() and m_buffer_size == 0) {
+    throw std::domain_error("Parameter 'buffer_size' must be > 0");
+  }
+  if (file_backed()) {
+    m_buffer.reserve(m_buffer_size * m_stride);
+  }
+}
+
+void TimeSeries::update() {
+  auto const sample = m_obs->operator()();
+  if (sample.size() != m_stride) {
+    throw std::runtime_error(
+        "TimeSeries: the number of values of the observable changed");
+  }
+  m_buffer.insert(m_buffer.end(), sample.begin(), sample.end());
+  ++m_n_buffered;
+  if (file_backed() and m_n_buffered >= m_buffer_size) {
+    flush();
+  }
+}
+
+void TimeSeries::flush() {
+  if (not file_backed() or m_n_buffered == 0) {
+    return;
+  }
+  // the first flush (re)creates the file, later ones append at the end of
+  // the valid samples
+  FilePtr file(std::fopen(m_filename.c_str(), m_n_flushed ? "r+b" : "wb"));
+  auto const offset = m_n_flushed * m_stride * sizeof(double);
+  if (!file or std::fseek(file.get(), static_cast<long>(offset), SEEK_SET) or
+      std::fwrite(m_buffer.data(), sizeof(double), m_buffer.size(),
+                  file.get()) != m_buffer.size() or
+      std::fflush(file.get())) {
+    throw std::runtime_error("TimeSeries: cannot write to file '" +
+                             m_filename + "'");
+  }
+  m_n_flushed += m_n_buffered;
+  m_n_buffered = 0;
+  m_buffer.clear();
+}
+
+void TimeSeries::clear() {
+  m_buffer.clear();
+  m_n_buffered = 0;
+  m_n_flushed = 0;
+  if (file_backed() and boost::filesystem::exists(m_filename)) {
+    boost::filesystem::resize_file(m_filename, 0u);
+  }
+}
+
+std::vector<std::vector<double>> TimeSeries::time_series() const {
+  std::vector<std::vector<double>> res(n_samples());
+  auto it = res.begin();
+  if (m_n_flushed) {
+    FilePtr file(std::fopen(m_filename.c_str(), "rb"));
+    if (!file) {
+      throw std::runtime_error("TimeSeries: cannot read from file '" +
+                               m_filename + "'");
+    }
+    for (std::size_t i = 0; i < m_n_flushed; ++i, ++it) {
+      it->resize(m_stride);
+      if (std::fread(it->data(), sizeof(double), m_stride, file.get()) !=
+          m_stride) {
+        throw std::runtime_error("TimeSeries: cannot read from file '" +
+                                 m_filename + "'");
+      }
+    }
+  }
+  auto const stride = static_cast<std::ptrdiff_t>(m_stride);
+  auto row = m_buffer.begin();
+  for (std::size_t i = 0; i < m_n_buffered; ++i, ++it, row += stride) {
+    it->assign(row, row + stride);
+  }
+  return res;
+}
 
 std::string TimeSeries::get_internal_state() const {
   std::stringstream ss;
   boost::archive::binary_oarchive oa(ss);
 
-  oa << m_data;
+  oa << m_n_flushed;
+  oa << m_n_buffered;
+  oa << m_buffer;
 
   return ss.str();
 }
@@ -45,6 +141,19 @@ void TimeSeries::set_internal_state(std::string const &state) {
   iostreams::stream<iostreams::array_source> ss(src);
   boost::archive::binary_iarchive ia(ss);
 
-  ia >> m_data;
+  ia >> m_n_flushed;
+  ia >> m_n_buffered;
+  ia >> m_buffer;
+
+  if (m_n_flushed) {
+    // discard samples written after the state was saved
+    auto const size = m_n_flushed * m_stride * sizeof(double);
+    if (not boost::filesystem::exists(m_filename) or
+        boost::filesystem::file_size(m_filename) < size) {
+      throw std::runtime_error("TimeSeries: file '" + m_filename +
+                               "' does not contain the recorded samples");
+    }
+    boost::filesystem::resize_file(m_filename, size);
+  }
 }
 } // namespace Accumulators
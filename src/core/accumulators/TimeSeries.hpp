@@ -37,28 +37,48 @@ namespace Accumulators {
  * the current value of an observable every time
  * it is updated.
  *
+ * Samples are stored as rows of fixed length. By default, the whole history
+ * is kept in memory. When a file name is given, at most @c buffer_size
+ * samples are kept in memory and older samples are appended to the file as
+ * raw native-endian doubles, so that the file can be memory-mapped. The
+ * file then only holds the samples which have been flushed; checkpoints
+ * refer to the file instead of containing the history.
  */
 class TimeSeries : public AccumulatorBase {
 public:
-  TimeSeries(std::shared_ptr<Observables::Observable> obs, int delta_N)
-      : AccumulatorBase(delta_N), m_obs(std::move(obs)) {}
+  TimeSeries(std::shared_ptr<Observables::Observable> obs, int delta_N,
+             std::string filename = {}, std::size_t buffer_size = 16);
 
   void update() override;
   std::string get_internal_state() const;
   void set_internal_state(std::string const &);
 
-  const std::vector<std::vector<double>> &time_series() const { return m_data; }
+  /** Copy of the recorded samples, including those stored in the file. */
+  std::vector<std::vector<double>> time_series() const;
   std::vector<std::size_t> shape() const override {
-    std::vector<std::size_t> shape{m_data.size()};
+    std::vector<std::size_t> shape{n_samples()};
     auto obs_shape = m_obs->shape();
     shape.insert(shape.end(), obs_shape.begin(), obs_shape.end());
     return shape;
   }
-  void clear() { m_data.clear(); }
+  void clear();
+  /** Append the buffered samples to the file, if any. */
+  void flush();
+
+  std::size_t n_samples() const { return m_n_flushed + m_n_buffered; }
+  std::string const &filename() const { return m_filename; }
+  std::size_t buffer_size() const { return m_buffer_size; }
 
 private:
+  bool file_backed() const { return not m_filename.empty(); }
+
   std::shared_ptr<Observables::Observable> m_obs;
-  std::vector<std::vector<double>> m_data;
+  std::string m_filename;
+  std::size_t m_buffer_size;
+  std::size_t m_stride;         ///< number of values per sample
+  std::size_t m_n_flushed = 0;  ///< number of samples in the file
+  std::size_t m_n_buffered = 0; ///< number of samples in @ref m_buffer
+  std::vector<double> m_buffer; ///< samples not written to the file
 };
 
 } // namespace Accumulators
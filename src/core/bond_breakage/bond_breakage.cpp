@@ -170,8 +170,12 @@ public:
   }
 };
 
-void process_queue() {
-  if (breakage_specs.empty())
+bool is_active() { return not breakage_specs.empty(); }
+
+bool queue_empty() { return queue.empty(); }
+
+void process_queue(bool any_breakage) {
+  if (breakage_specs.empty() or not any_breakage)
     return;
 
   auto global_queue = gather_global_queue(queue);
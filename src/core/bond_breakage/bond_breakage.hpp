@@ -48,7 +48,17 @@ bool check_and_handle_breakage(int particle_id, int bond_partner_id,
 
 void clear_queue();
 
-void process_queue();
+/** @brief Whether any bond type has a breakage specification */
+bool is_active();
+
+/** @brief Whether no bond broke on this node */
+bool queue_empty();
+
+/** @brief Execute the breakage actions of all nodes.
+ *
+ *  @param any_breakage  Whether any node queued a breakage
+ */
+void process_queue(bool any_breakage);
 
 } // namespace BondBreakage
 #endif
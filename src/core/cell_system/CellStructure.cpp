@@ -96,6 +96,8 @@ Cell *CellStructure::particle_to_cell(const Particle &p) {
 }
 
 void CellStructure::remove_particle(int id) {
+  m_rebuild_bond_list = true;
+
   auto remove_all_bonds_to = [id](BondList &bl) {
     for (auto it = bl.begin(); it != bl.end();) {
       if (Utils::contains(it->partner_ids(), id)) {
@@ -125,6 +127,7 @@ void CellStructure::remove_particle(int id) {
 Particle *CellStructure::add_local_particle(Particle &&p) {
   auto const sort_cell = particle_to_cell(p);
   if (sort_cell) {
+    m_rebuild_bond_list = true;
 
     return std::addressof(
         append_indexed_particle(sort_cell->particles(), std::move(p)));
@@ -142,6 +145,7 @@ Particle *CellStructure::add_particle(Particle &&p) {
   /* If the particle isn't local a global resort may be
    * needed, otherwise a local resort if sufficient. */
   set_resort_particles(sort_cell ? Cells::RESORT_LOCAL : Cells::RESORT_GLOBAL);
+  m_rebuild_bond_list = true;
 
   return std::addressof(
       append_indexed_particle(cell->particles(), std::move(p)));
@@ -160,6 +164,7 @@ void CellStructure::remove_all_particles() {
   }
 
   m_particle_index.clear();
+  m_rebuild_bond_list = true;
 }
 
 /* Map the data parts flags from cells to those used internally
@@ -246,6 +251,7 @@ void CellStructure::resort_particles(bool global_flag, BoxGeometry const &box) {
   }
 
   m_rebuild_verlet_list = true;
+  m_rebuild_bond_list = true;
   m_le_pos_offset_at_last_resort = box.lees_edwards_bc().pos_offset;
 
 #ifdef ADDITIONAL_CHECKS
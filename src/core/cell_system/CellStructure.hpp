@@ -35,6 +35,7 @@
 #include "cell_system/CellStructureType.hpp"
 #include "config/config.hpp"
 #include "ghosts.hpp"
+#include "instrumentation.hpp"
 
 #include <utils/math/sqr.hpp>
 
@@ -145,6 +146,17 @@ private:
   unsigned m_resort_particles = Cells::RESORT_NONE;
   bool m_rebuild_verlet_list = true;
   std::vector<std::pair<Particle *, Particle *>> m_verlet_list;
+  /** Local bonds of one bond id with resolved partners. */
+  struct BondGroup {
+    int bond_id;
+    int n_partners;
+    /** For each bond, the particle followed by its partners. */
+    std::vector<Particle *> particles;
+  };
+  bool m_rebuild_bond_list = true;
+  std::vector<BondGroup> m_bond_groups;
+  /** Particle and partner ids of bonds with missing partners. */
+  std::vector<std::pair<int, std::vector<int>>> m_unresolved_bonds;
   double m_le_pos_offset_at_last_resort = 0.;
 
 public:
@@ -384,11 +396,30 @@ public:
   bool
   check_resort_required(ParticleRange const &particles, double skin,
                         Utils::Vector3d const &additional_offset = {}) const {
-    auto const lim = Utils::sqr(skin / 2.) - additional_offset.norm2();
+    auto const lim = resort_threshold(skin, additional_offset);
     return std::any_of(
-        particles.begin(), particles.end(), [lim](const auto &p) {
-          return ((p.pos() - p.pos_at_last_verlet_update()).norm2() > lim);
-        });
+        particles.begin(), particles.end(),
+        [lim](const auto &p) { return exceeds_resort_threshold(p, lim); });
+  }
+
+  /**
+   * @brief Squared displacement above which a particle requires a resort.
+   * @param skin                Skin
+   * @param additional_offset   See @ref check_resort_required.
+   */
+  static double
+  resort_threshold(double skin, Utils::Vector3d const &additional_offset = {}) {
+    return Utils::sqr(skin / 2.) - additional_offset.norm2();
+  }
+
+  /**
+   * @brief Check whether a single particle has moved further than allowed
+   * since the last Verlet list update.
+   * @param p           Particle to check
+   * @param threshold   Squared displacement from @ref resort_threshold
+   */
+  static bool exceeds_resort_threshold(Particle const &p, double threshold) {
+    return (p.pos() - p.pos_at_last_verlet_update()).norm2() > threshold;
   }
 
   auto get_le_pos_offset_at_last_resort() const {
@@ -452,34 +483,46 @@ private:
   }
 
   /**
-   * @brief Execute kernel for every bond on particle.
-   * @tparam Handler Callable, which can be invoked with
-   *                 (Particle, int, Utils::Span<Particle *>),
-   *                 returning a bool.
-   * @param p Particles for whom the bonds are evaluated.
-   * @param handler is called for every bond, and handed
-   *                p, the bond id and a span with the bond
-   *                partners as arguments. Its return value
-   *                should indicate if the bond was broken.
+   * @brief Resolve the bonds of all local particles.
+   *
+   * Bonds are grouped by bond id, such that the bond kernel
+   * is evaluated for all bonds of the same type in a row. The
+   * resolved partner pointers stay valid as long as the particle
+   * storage is unchanged, i.e. until the next resort or change of
+   * the bond topology. Bonds whose partners cannot be resolved
+   * are kept separately and reported on every bond loop.
    */
-  template <class Handler>
-  void execute_bond_handler(Particle &p, Handler handler) {
-    for (const BondView bond : p.bonds()) {
-      auto const partner_ids = bond.partner_ids();
-
-      try {
-        auto partners = resolve_bond_partners(partner_ids);
-
-        auto const bond_broken =
-            handler(p, bond.bond_id(), Utils::make_span(partners));
+  void rebuild_bond_list() {
+    m_bond_groups.clear();
+    m_unresolved_bonds.clear();
 
-        if (bond_broken) {
-          bond_broken_error(p.id(), partner_ids);
+    for (auto &p : local_particles()) {
+      for (const BondView bond : p.bonds()) {
+        auto const partner_ids = bond.partner_ids();
+
+        try {
+          auto const partners = resolve_bond_partners(partner_ids);
+          auto group = boost::find_if(m_bond_groups, [&bond](auto const &g) {
+            return g.bond_id == bond.bond_id();
+          });
+          if (group == m_bond_groups.end()) {
+            group = m_bond_groups.insert(
+                group, BondGroup{bond.bond_id(),
+                                 static_cast<int>(partners.size()),
+                                 {}});
+          }
+          assert(group->n_partners == static_cast<int>(partners.size()));
+          group->particles.push_back(&p);
+          group->particles.insert(group->particles.end(), partners.begin(),
+                                  partners.end());
+        } catch (const BondResolutionError &) {
+          m_unresolved_bonds.emplace_back(
+              p.id(), std::vector<int>(partner_ids.begin(), partner_ids.end()));
         }
-      } catch (const BondResolutionError &) {
-        bond_broken_error(p.id(), partner_ids);
       }
     }
+
+    m_rebuild_bond_list = false;
   }
 
   /**
@@ -588,6 +631,7 @@ private:
      * the pair kernel, and the verlet list is rebuilt as
      * we go. */
     if (m_rebuild_verlet_list) {
+      Instrumentation::count(Instrumentation::Counter::VERLET_REBUILDS);
       m_verlet_list.clear();
 
       link_cell([&](Particle &p1, Particle &p2, Distance const &d) {
@@ -622,12 +666,42 @@ public:
   /** Bonded pair loop.
    * @param bond_kernel Kernel to apply
    */
-  template <class BondKernel> void bond_loop(BondKernel const &bond_kernel) {
-    for (auto &p : local_particles()) {
-      execute_bond_handler(p, bond_kernel);
+  template <class BondKernel> void bond_loop(BondKernel &&bond_kernel) {
+    if (m_rebuild_bond_list) {
+      rebuild_bond_list();
+    }
+
+    for (auto &group : m_bond_groups) {
+      auto const stride = static_cast<std::size_t>(1 + group.n_partners);
+      for (std::size_t i = 0; i < group.particles.size(); i += stride) {
+        auto &p = *group.particles[i];
+        auto const partners = Utils::Span<Particle *>(
+            group.particles.data() + i + 1, stride - 1);
+
+        auto const bond_broken = bond_kernel(p, group.bond_id, partners);
+
+        if (bond_broken) {
+          boost::container::static_vector<int, 4> partner_ids;
+          boost::transform(partners, std::back_inserter(partner_ids),
+                           [](Particle const *p) { return p->id(); });
+          bond_broken_error(p.id(), Utils::make_const_span(partner_ids));
+        }
+      }
+    }
+
+    for (auto const &bond : m_unresolved_bonds) {
+      bond_broken_error(bond.first, Utils::make_const_span(bond.second));
     }
   }
 
+  /**
+   * @brief Mark the resolved bond list as outdated.
+   *
+   * Has to be called when bonds are added or removed
+   * outside of a particle resort.
+   */
+  void invalidate_bond_list() { m_rebuild_bond_list = true; }
+
   /** Non-bonded pair loop.
    * @param pair_kernel Kernel to apply
    */
@@ -37,6 +37,7 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/range/algorithm/reverse.hpp>
 #include <boost/range/numeric.hpp>
+#include <boost/serialization/utility.hpp>
 
 #include <algorithm>
 #include <array>
@@ -54,8 +55,14 @@ Cell *RegularDecomposition::position_to_cell(const Utils::Vector3d &pos) {
   Utils::Vector3i cpos;
 
   for (int i = 0; i < 3; i++) {
-    cpos[i] = static_cast<int>(std::floor(pos[i] * inv_cell_size[i])) + 1 -
-              cell_offset[i];
+    if (m_uniform) {
+      cpos[i] = static_cast<int>(std::floor(pos[i] * inv_cell_size[i])) + 1 -
+                cell_offset[i];
+    } else {
+      cpos[i] = static_cast<int>(std::floor(
+                    (pos[i] - m_local_box.my_left()[i]) * inv_cell_size[i])) +
+                1;
+    }
 
     /* particles outside our box. Still take them if
        nonperiodic boundary. We also accept the particle if we are at
@@ -268,13 +275,16 @@ void RegularDecomposition::fill_comm_cell_lists(ParticleList **part_lists,
 }
 Utils::Vector3d RegularDecomposition::max_cutoff() const {
   auto dir_max_range = [this](int i) {
-    return std::min(0.5 * m_box.length()[i], m_local_box.length()[i]);
+    return std::min(0.5 * m_box.length()[i], m_min_local_box_l[i]);
   };
 
   return {dir_max_range(0), dir_max_range(1), dir_max_range(2)};
 }
 
-Utils::Vector3d RegularDecomposition::max_range() const { return cell_size; }
+Utils::Vector3d RegularDecomposition::max_range() const {
+  return m_min_cell_size;
+}
+
 int RegularDecomposition::calc_processor_min_num_cells() const {
   /* the minimal number of cells can be lower if there are at least two nodes
      serving a direction,
@@ -294,6 +304,16 @@ void RegularDecomposition::create_cell_grid(double range) {
   auto cell_range = Utils::Vector3d::broadcast(range);
   auto const min_num_cells = calc_processor_min_num_cells();
 
+  /* extremal local box lengths over all nodes */
+  auto const &local_box_l = m_local_box.length();
+  Utils::Vector3d max_local_box_l;
+  boost::mpi::all_reduce(m_comm, local_box_l.data(), 3, max_local_box_l.data(),
+                         boost::mpi::maximum<double>());
+  boost::mpi::all_reduce(m_comm, local_box_l.data(), 3,
+                         m_min_local_box_l.data(),
+                         boost::mpi::minimum<double>());
+  m_uniform = (m_min_local_box_l == max_local_box_l);
+
   if (range <= 0.) {
     /* this is the non-interacting case */
     auto const cells_per_dir =
@@ -301,9 +321,35 @@ void RegularDecomposition::create_cell_grid(double range) {
 
     cell_grid = Utils::Vector3i::broadcast(cells_per_dir);
     n_local_cells = Utils::product(cell_grid);
+  } else if (not m_uniform) {
+    /* Scale the grid of the largest local box down to max_num_cells,
+       the cell grid of smaller boxes then has fewer cells. */
+    auto const scale = std::cbrt(RegularDecomposition::max_num_cells /
+                                 Utils::product(max_local_box_l));
+
+    for (int i = 0; i < 3; i++) {
+      auto const n_max = static_cast<int>(std::floor(local_box_l[i] * scale));
+      cell_grid[i] = static_cast<int>(std::floor(local_box_l[i] / range));
+      if (cell_grid[i] < 1) {
+        runtimeErrorMsg() << "interaction range " << range << " in direction "
+                          << i << " is larger than the local box size "
+                          << local_box_l[i];
+      }
+      cell_grid[i] = std::max(1, std::min(cell_grid[i], n_max));
+    }
+    n_local_cells = Utils::product(cell_grid);
+
+    /* sanity check */
+    if (n_local_cells < min_num_cells) {
+      runtimeErrorMsg() << "number of cells " << n_local_cells
+                        << " is smaller than minimum " << min_num_cells
+                        << ": either interaction range is too large for "
+                        << "the current skin (range=" << range << ", "
+                        << "half_local_box_l=[" << local_box_l / 2. << "]) "
+                        << "or min_num_cells too large";
+    }
   } else {
     /* Calculate initial cell grid */
-    auto const &local_box_l = m_local_box.length();
     auto const volume = Utils::product(local_box_l);
     auto const scale = std::cbrt(RegularDecomposition::max_num_cells / volume);
 
@@ -375,7 +421,25 @@ void RegularDecomposition::create_cell_grid(double range) {
     new_cells *= ghost_cell_grid[i];
     cell_size[i] = m_local_box.length()[i] / static_cast<double>(cell_grid[i]);
     inv_cell_size[i] = 1.0 / cell_size[i];
-    cell_offset[i] = node_pos[i] * cell_grid[i];
+  }
+  boost::mpi::all_reduce(m_comm, cell_size.data(), 3, m_min_cell_size.data(),
+                         boost::mpi::minimum<double>());
+
+  /* The offset in the global cell grid is the number of cells of the nodes
+     to the left, which only depend on the node position in that direction. */
+  std::vector<std::pair<Utils::Vector3i, Utils::Vector3i>> grids;
+  boost::mpi::all_gather(m_comm, std::make_pair(node_pos, cell_grid), grids);
+  cell_offset = {};
+  global_cell_grid = {};
+  for (auto const &[pos, grid] : grids) {
+    for (int i = 0; i < 3; i++) {
+      if (pos[(i + 1) % 3] == 0 and pos[(i + 2) % 3] == 0) {
+        global_cell_grid[i] += grid[i];
+        if (pos[i] < node_pos[i]) {
+          cell_offset[i] += grid[i];
+        }
+      }
+    }
   }
 
   /* allocate cell array and cell pointer arrays */
@@ -393,10 +457,8 @@ template <class K, class Comparator> auto make_flat_set(Comparator &&comp) {
 void RegularDecomposition::init_cell_interactions() {
 
   auto const halo = Utils::Vector3i{1, 1, 1};
-  auto const cart_info = Utils::Mpi::cart_get<3>(m_comm);
-  auto const node_pos = cart_info.coords;
-  auto const global_halo_offset = hadamard_product(node_pos, cell_grid) - halo;
-  auto const global_size = hadamard_product(node_grid, cell_grid);
+  auto const global_halo_offset = cell_offset - halo;
+  auto const global_size = global_cell_grid;
 
   /* Tanslate a node local index (relative to the origin of the local grid)
    * to a global index. */
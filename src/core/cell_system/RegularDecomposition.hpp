@@ -76,6 +76,14 @@ struct RegularDecomposition : public ParticleDecomposition {
   Utils::Vector3i ghost_cell_grid = {};
   /** inverse @ref RegularDecomposition::cell_size "cell_size". */
   Utils::Vector3d inv_cell_size = {};
+  /** Size of the global cell grid, without ghost frame. */
+  Utils::Vector3i global_cell_grid = {};
+  /** Whether all nodes have local boxes of the same size. */
+  bool m_uniform = true;
+  /** Smallest local box length over all nodes. */
+  Utils::Vector3d m_min_local_box_l = {};
+  /** Smallest cell size over all nodes. */
+  Utils::Vector3d m_min_cell_size = {};
 
   boost::mpi::communicator m_comm;
   BoxGeometry const &m_box;
@@ -191,11 +199,16 @@ private:
    *  Calculates the cell grid, based on the local box size and the range.
    *  If the number of cells is larger than @c max_num_cells,
    *  it increases @c max_range until the number of cells is
-   *  smaller or equal to @c max_num_cells. It sets:
+   *  smaller or equal to @c max_num_cells. When the local boxes differ
+   *  in size, the number of cells in a direction only depends on the
+   *  local box length in that direction, so that neighboring nodes
+   *  agree on the cells of their common faces. It sets:
    *  @c cell_grid,
    *  @c ghost_cell_grid,
-   *  @c cell_size, and
-   *  @c inv_cell_size.
+   *  @c cell_size,
+   *  @c inv_cell_size,
+   *  @c cell_offset, and
+   *  @c global_cell_grid.
    *
    *  @param range interaction range. All pairs closer
    *               than this distance are found.
@@ -405,6 +405,14 @@ std::vector<CollisionPair> gather_global_collision_queue() {
   return res;
 }
 
+bool collision_queues_are_exchanged() {
+  return collision_params.mode == CollisionModeType::BIND_VS or
+         collision_params.mode == CollisionModeType::GLUE_TO_SURF or
+         collision_params.mode == CollisionModeType::BIND_THREE_PARTICLES;
+}
+
+bool local_collision_queue_empty() { return local_collision_queue.empty(); }
+
 static void three_particle_binding_do_search(Cell *basecell, Particle &p1,
                                              Particle &p2) {
   auto handle_cell = [&p1, &p2](Cell *c) {
@@ -468,7 +476,7 @@ void three_particle_binding_domain_decomposition(
 }
 
 // Handle the collisions stored in the queue
-void handle_collisions() {
+void handle_collisions(bool any_collision, int max_seen_particle) {
   // Note that the glue to surface mode adds bonds between the centers
   // but does so later in the process. This is needed to guarantee that
   // a particle can only be glued once, even if queued twice in a single
@@ -484,6 +492,9 @@ void handle_collisions() {
 
       get_part(c.pp1).bonds().insert({collision_params.bond_centers, bondG});
     }
+    if (!local_collision_queue.empty()) {
+      cell_structure.invalidate_bond_list();
+    }
   }
 
 // Virtual sites based collision schemes
@@ -494,14 +505,10 @@ void handle_collisions() {
     // across node boundaries in its queue.
     // The other node might still have to change particle properties on its
     // non-ghost particle
-    auto gathered_queue = gather_global_collision_queue();
-
-    // Sync max_seen_part
-    auto const global_max_seen_particle = boost::mpi::all_reduce(
-        comm_cart, cell_structure.get_max_local_particle_id(),
-        boost::mpi::maximum<int>());
+    auto gathered_queue = any_collision ? gather_global_collision_queue()
+                                        : std::vector<CollisionPair>{};
 
-    int current_vs_pid = global_max_seen_particle + 1;
+    int current_vs_pid = max_seen_particle + 1;
 
     // Iterate over global collision queue
     for (auto &c : gathered_queue) {
@@ -639,8 +646,11 @@ void handle_collisions() {
 
   // three-particle-binding part
   if (collision_params.mode == CollisionModeType::BIND_THREE_PARTICLES) {
-    auto gathered_queue = gather_global_collision_queue();
-    three_particle_binding_domain_decomposition(gathered_queue);
+    if (any_collision) {
+      auto gathered_queue = gather_global_collision_queue();
+      three_particle_binding_domain_decomposition(gathered_queue);
+      cell_structure.invalidate_bond_list();
+    }
   } // if TPB
 
   local_collision_queue.clear();
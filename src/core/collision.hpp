@@ -98,8 +98,18 @@ extern Collision_parameters collision_params;
 
 void prepare_local_collision_queue();
 
-/// Handle the collisions recorded in the queue
-void handle_collisions();
+/** @brief Whether the collision mode exchanges the queues between nodes */
+bool collision_queues_are_exchanged();
+
+/** @brief Whether the collision queue of this node has no entries */
+bool local_collision_queue_empty();
+
+/** @brief Handle the collisions recorded in the queue
+ *
+ *  @param any_collision      Whether any node queued a collision
+ *  @param max_seen_particle  Largest particle id on any node
+ */
+void handle_collisions(bool any_collision, int max_seen_particle);
 
 /** @brief Add the collision between the given particle ids to the collision
  *  queue
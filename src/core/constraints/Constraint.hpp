@@ -54,6 +54,10 @@ public:
    */
   virtual bool fits_in_box(Utils::Vector3d const &box) const = 0;
 
+  /**
+   * @brief Prepare a new force calculation, called before the first
+   * call to @ref force.
+   */
   virtual void reset_force() {}
 
   virtual ~Constraint() = default;
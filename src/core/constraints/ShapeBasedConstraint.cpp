@@ -28,6 +28,7 @@
 #include "errorhandling.hpp"
 #include "forces_inline.hpp"
 #include "grid.hpp"
+#include "integrate.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
 #include "thermostat.hpp"
 
@@ -38,7 +39,9 @@
 #include <algorithm>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <numeric>
+#include <stdexcept>
 
 namespace Constraints {
 Utils::Vector3d ShapeBasedConstraint::total_force() const {
@@ -49,6 +52,61 @@ double ShapeBasedConstraint::total_normal_force() const {
   return all_reduce(comm_cart, m_outer_normal_force, std::plus<double>());
 }
 
+void ShapeBasedConstraint::set_distance_cache_spacing(double spacing) {
+  if (spacing < 0.) {
+    throw std::domain_error(
+        "Parameter 'distance_cache_spacing' must be >= 0");
+  }
+  m_dist_cache_spacing = spacing;
+  m_dist_cache.reset();
+}
+
+void ShapeBasedConstraint::update_distance_cache() {
+  if (m_dist_cache_spacing <= 0.) {
+    m_dist_cache.reset();
+    return;
+  }
+  // cover the local domain plus the distance particles can travel before
+  // they are resorted, without leaving the box (positions are folded)
+  auto const halo = Utils::Vector3d::broadcast(std::max(skin, 0.));
+  Utils::Vector3d lower, upper;
+  for (unsigned int i = 0u; i < 3u; ++i) {
+    lower[i] = std::max(local_geo.my_left()[i] - halo[i], 0.);
+    upper[i] = std::min(local_geo.my_right()[i] + halo[i], box_geo.length()[i]);
+  }
+  auto const version = m_shape->version();
+  if (not m_dist_cache or version != m_dist_cache_version or
+      not m_dist_cache->covers(lower, upper, m_dist_cache_spacing)) {
+    m_dist_cache = std::make_unique<SignedDistanceCache>(
+        *m_shape, lower, upper, m_dist_cache_spacing);
+    m_dist_cache_version = version;
+  }
+}
+
+bool ShapeBasedConstraint::out_of_range(Utils::Vector3d const &folded_pos,
+                                        double cutoff) const {
+  if (not m_dist_cache) {
+    return false;
+  }
+#ifdef DPD
+  // DPD increments its RNG counter for each particle in front of the shape
+  if (thermo_switch & THERMO_DPD) {
+    return false;
+  }
+#endif
+  auto const dist = (*m_dist_cache)(folded_pos);
+  if (not dist) {
+    return false;
+  }
+  auto const error = m_dist_cache->error_bound();
+  if (*dist - error > cutoff) {
+    return true;
+  }
+  // deep inside a penetrable shape
+  auto const depth = -(*dist + error);
+  return m_penetrable and depth > 0. and (m_only_positive or depth > cutoff);
+}
+
 double ShapeBasedConstraint::min_dist(const ParticleRange &particles) {
   double global_mindist = std::numeric_limits<double>::infinity();
 
@@ -56,8 +114,8 @@ double ShapeBasedConstraint::min_dist(const ParticleRange &particles) {
       particles.begin(), particles.end(),
       std::numeric_limits<double>::infinity(),
       [this](double min, Particle const &p) {
-        auto const &ia_params = get_ia_param(p.type(), part_rep.type());
-        if (checkIfInteraction(ia_params)) {
+        auto const &ia_entry = get_ia_pair_entry(p.type(), part_rep.type());
+        if (checkIfInteraction(ia_entry)) {
           double dist;
           Utils::Vector3d vec;
           m_shape->calculate_dist(folded_position(p.pos(), box_geo), dist, vec);
@@ -74,9 +132,10 @@ ParticleForce ShapeBasedConstraint::force(Particle const &p,
                                           Utils::Vector3d const &folded_pos,
                                           double) {
   ParticleForce pf{};
-  auto const &ia_params = get_ia_param(p.type(), part_rep.type());
+  auto const &ia_entry = get_ia_pair_entry(p.type(), part_rep.type());
 
-  if (checkIfInteraction(ia_params)) {
+  if (checkIfInteraction(ia_entry) and
+      not out_of_range(folded_pos, ia_entry.max_cut)) {
     double dist = 0.;
     Utils::Vector3d dist_vec;
     m_shape->calculate_dist(folded_pos, dist, dist_vec);
@@ -89,24 +148,25 @@ ParticleForce ShapeBasedConstraint::force(Particle const &p,
 
     if (dist > 0) {
       outer_normal_vec = -dist_vec / dist;
-      pf = calc_non_bonded_pair_force(p, part_rep, ia_params, dist_vec, dist,
+      pf = calc_non_bonded_pair_force(p, part_rep, ia_entry, dist_vec, dist,
                                       coulomb_kernel.get_ptr());
 #ifdef DPD
       if (thermo_switch & THERMO_DPD) {
         dpd_force =
-            dpd_pair_force(p, part_rep, ia_params, dist_vec, dist, dist * dist);
+            dpd_pair_force(p, part_rep, *ia_entry.params, dist_vec, dist,
+                           dist * dist);
         // Additional use of DPD here requires counter increase
         dpd.rng_increment();
       }
 #endif
     } else if (m_penetrable && (dist <= 0)) {
       if ((!m_only_positive) && (dist < 0)) {
-        pf = calc_non_bonded_pair_force(p, part_rep, ia_params, dist_vec, -dist,
+        pf = calc_non_bonded_pair_force(p, part_rep, ia_entry, dist_vec, -dist,
                                         coulomb_kernel.get_ptr());
 #ifdef DPD
         if (thermo_switch & THERMO_DPD) {
-          dpd_force = dpd_pair_force(p, part_rep, ia_params, dist_vec, dist,
-                                     dist * dist);
+          dpd_force = dpd_pair_force(p, part_rep, *ia_entry.params, dist_vec,
+                                     dist, dist * dist);
           // Additional use of DPD here requires counter increase
           dpd.rng_increment();
         }
@@ -134,19 +194,20 @@ void ShapeBasedConstraint::add_energy(const Particle &p,
                                       Observable_stat &obs_energy) const {
   double energy = 0.0;
 
-  auto const &ia_params = get_ia_param(p.type(), part_rep.type());
+  auto const &ia_entry = get_ia_pair_entry(p.type(), part_rep.type());
 
-  if (checkIfInteraction(ia_params)) {
+  if (checkIfInteraction(ia_entry) and
+      not out_of_range(folded_pos, ia_entry.max_cut)) {
     auto const coulomb_kernel = Coulomb::pair_energy_kernel();
     double dist = 0.0;
     Utils::Vector3d vec;
     m_shape->calculate_dist(folded_pos, dist, vec);
     if (dist > 0) {
-      energy = calc_non_bonded_pair_energy(p, part_rep, ia_params, vec, dist,
+      energy = calc_non_bonded_pair_energy(p, part_rep, ia_entry, vec, dist,
                                            coulomb_kernel.get_ptr());
     } else if ((dist <= 0) && m_penetrable) {
       if (!m_only_positive && (dist < 0)) {
-        energy = calc_non_bonded_pair_energy(p, part_rep, ia_params, vec, -dist,
+        energy = calc_non_bonded_pair_energy(p, part_rep, ia_entry, vec, -dist,
                                              coulomb_kernel.get_ptr());
       }
     } else {
@@ -23,6 +23,7 @@
 #include "Observable_stat.hpp"
 #include "Particle.hpp"
 #include "ParticleRange.hpp"
+#include "SignedDistanceCache.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
 
 #include <shapes/NoWhere.hpp>
@@ -30,6 +31,7 @@
 
 #include <utils/Vector.hpp>
 
+#include <cstddef>
 #include <memory>
 
 namespace Constraints {
@@ -61,6 +63,7 @@ public:
 
   void set_shape(std::shared_ptr<Shapes::Shape> const &shape) {
     m_shape = shape;
+    m_dist_cache.reset();
   }
 
   Shapes::Shape const &shape() const { return *m_shape; }
@@ -68,8 +71,18 @@ public:
   void reset_force() override {
     m_local_force = Utils::Vector3d{0, 0, 0};
     m_outer_normal_force = 0.0;
+    update_distance_cache();
   }
 
+  /** @brief Grid spacing of the distance cache, 0 if it is disabled. */
+  double distance_cache_spacing() const { return m_dist_cache_spacing; }
+
+  /** @brief Enable the distance cache with a grid spacing, or disable it
+   *  with a spacing of 0. The cache is rebuilt automatically when the
+   *  parameters of the shape change.
+   */
+  void set_distance_cache_spacing(double spacing);
+
   bool &only_positive() { return m_only_positive; }
   bool &penetrable() { return m_penetrable; }
   int &type() { return part_rep.type(); }
@@ -93,6 +106,22 @@ private:
   bool m_only_positive;
   Utils::Vector3d m_local_force;
   double m_outer_normal_force;
+
+  /** Signed distances of the shape around the local domain */
+  std::unique_ptr<SignedDistanceCache> m_dist_cache;
+  double m_dist_cache_spacing = 0.;
+  /** Version of the shape the distance cache was sampled from */
+  std::size_t m_dist_cache_version = 0u;
+
+  /** Rebuild the distance cache if the local domain or the shape
+   *  has changed
+   */
+  void update_distance_cache();
+
+  /** Check with the distance cache if a particle at @p folded_pos is
+   *  certainly out of range of the interactions with cutoff @p cutoff.
+   */
+  bool out_of_range(Utils::Vector3d const &folded_pos, double cutoff) const;
 };
 
 } // namespace Constraints
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SignedDistanceCache.hpp"
+
+#include <shapes/Shape.hpp>
+
+#include <utils/Vector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+namespace Constraints {
+
+SignedDistanceCache::SignedDistanceCache(Shapes::Shape const &shape,
+                                         Utils::Vector3d const &lower,
+                                         Utils::Vector3d const &upper,
+                                         double spacing)
+    : m_lower(lower), m_upper(upper), m_spacing(spacing),
+      m_inv_spacing(1. / spacing),
+      m_error_bound(0.5 * std::sqrt(3.) * spacing) {
+  if (spacing <= 0.) {
+    throw std::domain_error("Parameter 'spacing' must be > 0");
+  }
+  for (unsigned int i = 0u; i < 3u; ++i) {
+    // nodes are placed on both corners of the region
+    auto const n_cells = std::ceil((upper[i] - lower[i]) / spacing);
+    m_n_nodes[i] = static_cast<std::size_t>(std::max(n_cells, 0.)) + 1u;
+  }
+  m_data.resize(m_n_nodes[0] * m_n_nodes[1] * m_n_nodes[2]);
+
+  auto it = m_data.begin();
+  Utils::Vector3d dist_vec;
+  for (std::size_t i = 0u; i < m_n_nodes[0]; ++i) {
+    for (std::size_t j = 0u; j < m_n_nodes[1]; ++j) {
+      for (std::size_t k = 0u; k < m_n_nodes[2]; ++k) {
+        auto const node =
+            lower + spacing * Utils::Vector3d{static_cast<double>(i),
+                                              static_cast<double>(j),
+                                              static_cast<double>(k)};
+        try {
+          shape.calculate_dist(node, *it, dist_vec);
+        } catch (std::exception const &) {
+          // the distance is not defined here, e.g. inside a Union
+          *it = std::numeric_limits<double>::quiet_NaN();
+        }
+        ++it;
+      }
+    }
+  }
+}
+
+} // namespace Constraints
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef CONSTRAINTS_SIGNEDDISTANCECACHE_HPP
+#define CONSTRAINTS_SIGNEDDISTANCECACHE_HPP
+
+#include <shapes/Shape.hpp>
+
+#include <utils/Vector.hpp>
+
+#include <boost/optional.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Constraints {
+
+/**
+ * @brief Signed distances of a shape sampled on a regular grid.
+ *
+ * The distance at an arbitrary position is approximated by the value at
+ * the nearest grid node. Since the distance to a surface changes at most
+ * by the displacement, the exact distance differs from the cached one by
+ * at most @ref error_bound. This makes the cache suitable to prove that a
+ * position is out of range of a short-ranged interaction without evaluating
+ * the shape; positions close to the surface still need the exact distance.
+ */
+class SignedDistanceCache {
+public:
+  /**
+   * @brief Sample @p shape on a grid covering a region.
+   * @param shape    Shape to sample.
+   * @param lower    Lower corner of the region.
+   * @param upper    Upper corner of the region.
+   * @param spacing  Grid spacing.
+   */
+  SignedDistanceCache(Shapes::Shape const &shape, Utils::Vector3d const &lower,
+                      Utils::Vector3d const &upper, double spacing);
+
+  /**
+   * @brief Cached distance at the node nearest to @p pos.
+   * @return The distance, or nothing if @p pos is outside of the region
+   * or if the shape has no defined distance at the node.
+   */
+  boost::optional<double> operator()(Utils::Vector3d const &pos) const {
+    std::size_t index = 0u;
+    for (unsigned int i = 0u; i < 3u; ++i) {
+      auto const x = (pos[i] - m_lower[i]) * m_inv_spacing + 0.5;
+      if (not(x >= 0. and x < static_cast<double>(m_n_nodes[i]))) {
+        return {};
+      }
+      index = index * m_n_nodes[i] + static_cast<std::size_t>(x);
+    }
+    auto const dist = m_data[index];
+    if (std::isnan(dist)) {
+      return {};
+    }
+    return dist;
+  }
+
+  /** @brief Maximal difference between cached and exact distance. */
+  double error_bound() const { return m_error_bound; }
+
+  /** @brief Whether the cache was built for this region and spacing. */
+  bool covers(Utils::Vector3d const &lower, Utils::Vector3d const &upper,
+              double spacing) const {
+    return lower == m_lower and upper == m_upper and spacing == m_spacing;
+  }
+
+private:
+  Utils::Vector3d m_lower;
+  Utils::Vector3d m_upper;
+  double m_spacing;
+  double m_inv_spacing;
+  double m_error_bound;
+  Utils::Vector<std::size_t, 3> m_n_nodes;
+  std::vector<double> m_data;
+};
+
+} // namespace Constraints
+
+#endif
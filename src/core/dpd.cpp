@@ -38,6 +38,7 @@
 #include "random.hpp"
 #include "thermostat.hpp"
 
+#include <utils/Span.hpp>
 #include <utils/Vector.hpp>
 #include <utils/constants.hpp>
 #include <utils/math/sqr.hpp>
@@ -45,9 +46,12 @@
 #include <utils/matrix.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 using Utils::Vector3d;
 
@@ -81,6 +85,10 @@ static double weight(int type, double r_cut, double k, double r) {
   if (type == 0) {
     return 1.;
   }
+  // the linear weight function is exact without pow()
+  if (k == 1.) {
+    return 1. - r / r_cut;
+  }
   return 1. - pow((r / r_cut), k);
 }
 
@@ -99,20 +107,16 @@ Vector3d dpd_pair_force(DPDParameters const &params, Vector3d const &v,
   return {};
 }
 
-Utils::Vector3d dpd_pair_force(Particle const &p1, Particle const &p2,
-                               IA_parameters const &ia_params,
-                               Utils::Vector3d const &d, double dist,
-                               double dist2) {
-  if (ia_params.dpd.radial.cutoff <= 0.0 && ia_params.dpd.trans.cutoff <= 0.0) {
-    return {};
-  }
+static bool has_noise(IA_parameters const &ia_params) {
+  return ia_params.dpd.radial.pref > 0.0 || ia_params.dpd.trans.pref > 0.0;
+}
 
+static Vector3d dpd_pair_force(Particle const &p1, Particle const &p2,
+                               IA_parameters const &ia_params,
+                               Vector3d const &d, double dist, double dist2,
+                               Vector3d const &noise_vec) {
   auto const v21 =
       box_geo.velocity_difference(p1.pos(), p2.pos(), p1.v(), p2.v());
-  auto const noise_vec =
-      (ia_params.dpd.radial.pref > 0.0 || ia_params.dpd.trans.pref > 0.0)
-          ? dpd_noise(p1.id(), p2.id())
-          : Vector3d{};
 
   auto const f_r = dpd_pair_force(ia_params.dpd.radial, v21, dist, noise_vec);
   auto const f_t = dpd_pair_force(ia_params.dpd.trans, v21, dist, noise_vec);
@@ -125,6 +129,114 @@ Utils::Vector3d dpd_pair_force(Particle const &p1, Particle const &p2,
   return force;
 }
 
+Utils::Vector3d dpd_pair_force(Particle const &p1, Particle const &p2,
+                               IA_parameters const &ia_params,
+                               Utils::Vector3d const &d, double dist,
+                               double dist2) {
+  if (ia_params.dpd.radial.cutoff <= 0.0 && ia_params.dpd.trans.cutoff <= 0.0) {
+    return {};
+  }
+
+  auto const noise_vec =
+      has_noise(ia_params) ? dpd_noise(p1.id(), p2.id()) : Vector3d{};
+
+  return dpd_pair_force(p1, p2, ia_params, d, dist, dist2, noise_vec);
+}
+
+namespace {
+/** @brief Ids of a queued pair, in the order used as RNG keys. */
+struct DPDKeys {
+  int pid1;
+  int pid2;
+  bool operator==(DPDKeys const &other) const {
+    return pid1 == other.pid1 and pid2 == other.pid2;
+  }
+};
+
+DPDKeys dpd_keys(int pid1, int pid2) {
+  return {std::max(pid1, pid2), std::min(pid1, pid2)};
+}
+
+/** @brief Whether the pair force needs noise. */
+bool needs_noise(IA_parameters const &ia_params, double dist) {
+  return has_noise(ia_params) and dist < ia_params.dpd.max_cutoff();
+}
+
+/** @brief Number of pairs whose noise is generated in one pass. */
+constexpr std::size_t dpd_block_size = 64u;
+
+/** @brief Pairs of the current force calculation, in loop order. */
+std::vector<DPDKeys> dpd_keys_queue;
+/** @brief Noise of the queued pairs. */
+std::vector<Vector3d> dpd_noise_queue;
+/** @brief Next queued pair to be taken by the short-range loop. */
+std::size_t dpd_queue_cursor = 0u;
+
+/** @brief Take the noise of a pair from the queue.
+ *  The short-range loop visits the queued pairs in the same order. A pair
+ *  that is not next in the queue gets its noise drawn directly, which
+ *  gives the same value.
+ */
+Vector3d dpd_next_noise(int pid1, int pid2) {
+  if (dpd_queue_cursor < dpd_noise_queue.size() and
+      dpd_keys_queue[dpd_queue_cursor] == dpd_keys(pid1, pid2)) {
+    return dpd_noise_queue[dpd_queue_cursor++];
+  }
+  return dpd_noise(pid1, pid2);
+}
+} // namespace
+
+void dpd_clear_queue() {
+  dpd_keys_queue.clear();
+  dpd_noise_queue.clear();
+  dpd_queue_cursor = 0u;
+}
+
+void dpd_queue_pair(Particle const &p1, Particle const &p2,
+                    IA_parameters const &ia_params, double dist) {
+  // pairs beyond both cutoffs or without noise do not use any noise
+  if (needs_noise(ia_params, dist)) {
+    dpd_keys_queue.push_back(dpd_keys(p1.id(), p2.id()));
+  }
+}
+
+void dpd_generate_queued_noise() {
+  auto const n_pairs = dpd_keys_queue.size();
+  dpd_noise_queue.resize(n_pairs);
+  std::array<int, dpd_block_size> keys1;
+  std::array<int, dpd_block_size> keys2;
+  for (std::size_t begin = 0u; begin < n_pairs; begin += dpd_block_size) {
+    auto const end = std::min(begin + dpd_block_size, n_pairs);
+    auto const n = end - begin;
+    for (auto i = begin; i < end; ++i) {
+      keys1[i - begin] = dpd_keys_queue[i].pid1;
+      keys2[i - begin] = dpd_keys_queue[i].pid2;
+    }
+    Random::noise_uniform_batch<RNGSalt::SALT_DPD>(
+        dpd.rng_counter(), dpd.rng_seed(),
+        Utils::Span<const int>(keys1.data(), n),
+        Utils::Span<const int>(keys2.data(), n),
+        Utils::make_span(dpd_noise_queue.data() + begin, n));
+  }
+  dpd_queue_cursor = 0u;
+}
+
+Utils::Vector3d dpd_queued_pair_force(Particle const &p1, Particle const &p2,
+                                      IA_parameters const &ia_params,
+                                      Utils::Vector3d const &d, double dist,
+                                      double dist2) {
+  if (ia_params.dpd.radial.cutoff <= 0.0 && ia_params.dpd.trans.cutoff <= 0.0) {
+    return {};
+  }
+
+  // beyond the cutoffs the force does not depend on the noise
+  auto const noise_vec = needs_noise(ia_params, dist)
+                             ? dpd_next_noise(p1.id(), p2.id())
+                             : Vector3d{};
+
+  return dpd_pair_force(p1, p2, ia_params, d, dist, dist2, noise_vec);
+}
+
 static auto dpd_viscous_stress_local() {
   on_observable_calc();
 
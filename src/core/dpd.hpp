@@ -42,6 +42,35 @@ Utils::Vector3d dpd_pair_force(Particle const &p1, Particle const &p2,
                                IA_parameters const &ia_params,
                                Utils::Vector3d const &d, double dist,
                                double dist2);
+
+/** @brief Remove all pairs from the DPD queue.
+ *  Called at the start of the force calculation, so that no noise of a
+ *  previous time step is used.
+ */
+void dpd_clear_queue();
+
+/** @brief Queue a particle pair for the DPD noise generation.
+ *  Called in a pass over the pairs ahead of the short-range loop.
+ *  Pairs beyond the DPD cutoffs or without noise are discarded.
+ */
+void dpd_queue_pair(Particle const &p1, Particle const &p2,
+                    IA_parameters const &ia_params, double dist);
+
+/** @brief Draw the noise of all queued pairs.
+ *  The noise is generated for blocks of pairs at once, from the same
+ *  counter-based random streams as @ref dpd_pair_force.
+ */
+void dpd_generate_queued_noise();
+
+/** @brief DPD force of a pair, with the noise taken from the queue.
+ *  The short-range loop adds the force pair by pair in its usual order,
+ *  hence the result is bitwise identical to @ref dpd_pair_force.
+ */
+Utils::Vector3d dpd_queued_pair_force(Particle const &p1, Particle const &p2,
+                                      IA_parameters const &ia_params,
+                                      Utils::Vector3d const &d, double dist,
+                                      double dist2);
+
 Utils::Vector9d dpd_stress();
 
 #endif // DPD
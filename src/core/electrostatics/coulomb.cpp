@@ -286,9 +286,13 @@ void calc_long_range_force(ParticleRange const &particles) {
   }
 #ifdef ELECTROKINETICS
   /* Add fields from EK if enabled */
+#ifdef CUDA
   if (this_node == 0) {
     ek_calculate_electrostatic_coupling();
   }
+#else
+  ek_calculate_electrostatic_coupling();
+#endif
 #endif
 }
 
@@ -145,9 +145,9 @@ double particle_short_range_energy_contribution(int pid) {
       if (not do_nonbonded(p, p1))
         return;
 #endif
-      auto const &ia_params = get_ia_param(p.type(), p1.type());
+      auto const &ia_entry = get_ia_pair_entry(p.type(), p1.type());
       // Add energy for current particle pair to result
-      ret += calc_non_bonded_pair_energy(p, p1, ia_params, vec, vec.norm(),
+      ret += calc_non_bonded_pair_energy(p, p1, ia_entry, vec, vec.norm(),
                                          coulomb_kernel_ptr);
     };
     cell_structure.run_on_particle_short_range_neighbors(*p, kernel);
@@ -31,23 +31,10 @@
 #include "bonded_interactions/bonded_interaction_data.hpp"
 #include "electrostatics/coulomb_inline.hpp"
 #include "magnetostatics/dipoles_inline.hpp"
-#include "nonbonded_interactions/bmhtf-nacl.hpp"
-#include "nonbonded_interactions/buckingham.hpp"
-#include "nonbonded_interactions/gaussian.hpp"
+#include "nonbonded_interactions/central_pair_potential.hpp"
 #include "nonbonded_interactions/gay_berne.hpp"
-#include "nonbonded_interactions/hat.hpp"
-#include "nonbonded_interactions/hertzian.hpp"
-#include "nonbonded_interactions/lj.hpp"
-#include "nonbonded_interactions/ljcos.hpp"
-#include "nonbonded_interactions/ljcos2.hpp"
-#include "nonbonded_interactions/ljgen.hpp"
-#include "nonbonded_interactions/morse.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
-#include "nonbonded_interactions/nonbonded_tab.hpp"
-#include "nonbonded_interactions/smooth_step.hpp"
-#include "nonbonded_interactions/soft_sphere.hpp"
 #include "nonbonded_interactions/thole.hpp"
-#include "nonbonded_interactions/wca.hpp"
 
 #include "Observable_stat.hpp"
 #include "Particle.hpp"
@@ -65,96 +52,30 @@
 /** Calculate non-bonded energies between a pair of particles.
  *  @param p1         particle 1.
  *  @param p2         particle 2.
- *  @param ia_params  the interaction parameters between the two particles
+ *  @param ia_entry   the interaction table entry of the two particle types
  *  @param d          vector between p1 and p2.
  *  @param dist       distance between p1 and p2.
  *  @param coulomb_kernel   %Coulomb energy kernel.
  *  @return the short-range interaction energy between the two particles
  */
 inline double calc_non_bonded_pair_energy(
-    Particle const &p1, Particle const &p2, IA_parameters const &ia_params,
+    Particle const &p1, Particle const &p2, IA_pair_entry const &ia_entry,
     Utils::Vector3d const &d, double const dist,
     Coulomb::ShortRangeEnergyKernel::kernel_type const *coulomb_kernel) {
 
-  double ret = 0;
-
-#ifdef LENNARD_JONES
-  /* Lennard-Jones */
-  ret += lj_pair_energy(ia_params, dist);
-#endif
-#ifdef WCA
-  /* WCA */
-  ret += wca_pair_energy(ia_params, dist);
-#endif
-
-#ifdef LENNARD_JONES_GENERIC
-  /* Generic Lennard-Jones */
-  ret += ljgen_pair_energy(ia_params, dist);
-#endif
-
-#ifdef SMOOTH_STEP
-  /* smooth step */
-  ret += SmSt_pair_energy(ia_params, dist);
-#endif
-
-#ifdef HERTZIAN
-  /* Hertzian potential */
-  ret += hertzian_pair_energy(ia_params, dist);
-#endif
-
-#ifdef GAUSSIAN
-  /* Gaussian potential */
-  ret += gaussian_pair_energy(ia_params, dist);
-#endif
-
-#ifdef BMHTF_NACL
-  /* BMHTF NaCl */
-  ret += BMHTF_pair_energy(ia_params, dist);
-#endif
-
-#ifdef MORSE
-  /* Morse */
-  ret += morse_pair_energy(ia_params, dist);
-#endif
-
-#ifdef BUCKINGHAM
-  /* Buckingham */
-  ret += buck_pair_energy(ia_params, dist);
-#endif
-
-#ifdef SOFT_SPHERE
-  /* soft-sphere */
-  ret += soft_pair_energy(ia_params, dist);
-#endif
-
-#ifdef HAT
-  /* hat */
-  ret += hat_pair_energy(ia_params, dist);
-#endif
-
-#ifdef LJCOS2
-  /* Lennard-Jones */
-  ret += ljcos2_pair_energy(ia_params, dist);
-#endif
+  auto ret = central_pair_energy(ia_entry, dist);
 
 #ifdef THOLE
   /* Thole damping */
-  ret += thole_pair_energy(p1, p2, ia_params, d, dist, coulomb_kernel);
-#endif
-
-#ifdef TABULATED
-  /* tabulated */
-  ret += tabulated_pair_energy(ia_params, dist);
-#endif
-
-#ifdef LJCOS
-  /* Lennard-Jones cosine */
-  ret += ljcos_pair_energy(ia_params, dist);
+  if (ia_entry.kernels & NB_THOLE)
+    ret += thole_pair_energy(p1, p2, *ia_entry.params, d, dist,
+                             coulomb_kernel);
 #endif
 
 #ifdef GAY_BERNE
   /* Gay-Berne */
-  ret += gb_pair_energy(p1.quat(), p2.quat(), ia_params, d, dist);
+  if (ia_entry.kernels & NB_GAY_BERNE)
+    ret += gb_pair_energy(p1.quat(), p2.quat(), *ia_entry.params, d, dist);
 #endif
 
   return ret;
@@ -177,14 +98,14 @@ inline void add_non_bonded_pair_energy(
     Coulomb::ShortRangeEnergyKernel::kernel_type const *coulomb_kernel,
     Dipoles::ShortRangeEnergyKernel::kernel_type const *dipoles_kernel,
     Observable_stat &obs_energy) {
-  auto const &ia_params = get_ia_param(p1.type(), p2.type());
+  auto const &ia_entry = get_ia_pair_entry(p1.type(), p2.type());
 
 #ifdef EXCLUSIONS
   if (do_nonbonded(p1, p2))
 #endif
     obs_energy.add_non_bonded_contribution(
         p1.type(), p2.type(),
-        calc_non_bonded_pair_energy(p1, p2, ia_params, d, dist,
+        calc_non_bonded_pair_energy(p1, p2, ia_entry, d, dist,
                                     coulomb_kernel));
 
 #ifdef ELECTROSTATICS
@@ -44,6 +44,7 @@
 #include "immersed_boundaries.hpp"
 #include "integrate.hpp"
 #include "interactions.hpp"
+#include "load_balancing.hpp"
 #include "magnetostatics/dipoles.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
 #include "npt.hpp"
@@ -98,6 +99,7 @@ void on_integration_start(double time_step) {
 #endif
   long_range_interactions_sanity_checks();
   lb_lbfluid_sanity_checks(time_step);
+  LoadBalancing::sanity_checks();
 
   /********************************************/
   /* end sanity checks                        */
@@ -237,6 +239,7 @@ void on_dipoles_change() {
 }
 
 void on_non_bonded_ia_change() {
+  update_central_pair_tables();
   maximal_cutoff_nonbonded();
   on_short_range_ia_change();
 }
@@ -340,6 +343,11 @@ void on_node_grid_change() {
   cells_re_init(cell_structure.decomposition_type());
 }
 
+void on_node_grid_splits_change() {
+  grid_changed_box_l(box_geo);
+  cells_re_init(cell_structure.decomposition_type());
+}
+
 /**
  * @brief Returns the ghost flags required for running pair
  *        kernels for the global state, e.g. the force calculation.
@@ -128,6 +128,10 @@ void on_forcecap_change();
  */
 void on_node_grid_change();
 
+/** @brief Called when the subdomain boundaries changed.
+ */
+void on_node_grid_splits_change();
+
 unsigned global_ghost_flags();
 
 /** called every time the walls for the lb fluid are changed */
@@ -27,15 +27,15 @@
 
 #include "Particle.hpp"
 
-#include <utils/contains.hpp>
-
 #include <algorithm>
 
 void add_exclusion(Particle &p, int p_id) {
-  if (Utils::contains(p.exclusions(), p_id))
+  auto &el = p.exclusions();
+  auto const pos = std::lower_bound(el.begin(), el.end(), p_id);
+  if (pos != el.end() and *pos == p_id)
     return;
 
-  p.exclusions().push_back(p_id);
+  el.insert(pos, p_id);
 }
 
 void delete_exclusion(Particle &p, int p_id) {
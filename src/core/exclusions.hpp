@@ -34,15 +34,16 @@
  */
 inline bool do_nonbonded(Particle const &p1, Particle const &p2) {
   /* check for particle 2 in particle 1's exclusion list. The exclusion list is
-   * symmetric, so this is sufficient. */
-  return std::none_of(p1.exclusions().begin(), p1.exclusions().end(),
-                      [&p2](int id) { return p2.id() == id; });
+   * symmetric, so this is sufficient. It is kept sorted by
+   * @ref add_exclusion. */
+  auto const &el = p1.exclusions();
+  return el.empty() or not std::binary_search(el.begin(), el.end(), p2.id());
 }
 
 /** Remove exclusion from particle if possible */
 void delete_exclusion(Particle &p, int p_id);
 
-/** Insert an exclusion if not already set */
+/** Insert an exclusion if not already set, keeping the list sorted */
 void add_exclusion(Particle &p, int p_id);
 
 #endif // EXCLUSIONS
@@ -41,12 +41,14 @@
 #include "grid_based_algorithms/lb_interface.hpp"
 #include "grid_based_algorithms/lb_particle_coupling.hpp"
 #include "immersed_boundaries.hpp"
+#include "instrumentation.hpp"
 #include "integrate.hpp"
 #include "interactions.hpp"
 #include "magnetostatics/dipoles.hpp"
 #include "nonbonded_interactions/VerletCriterion.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
 #include "npt.hpp"
+#include "random.hpp"
 #include "rotation.hpp"
 #include "short_range_loop.hpp"
 #include "thermostat.hpp"
@@ -57,7 +59,12 @@
 
 #include <profiler/profiler.hpp>
 
+#include <utils/Span.hpp>
+#include <utils/Vector.hpp>
+
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <memory>
 
 std::shared_ptr<ComFixed> comfixed = std::make_shared<ComFixed>();
@@ -87,28 +94,63 @@ inline ParticleForce external_force(Particle const &p) {
   return f;
 }
 
-inline ParticleForce thermostat_force(Particle const &p, double time_step,
-                                      double kT) {
-  extern LangevinThermostat langevin;
-  if (!(thermo_switch & THERMO_LANGEVIN)) {
-    return {};
-  }
-
+/** Langevin thermostat forces of a particle, from pre-drawn noise */
+inline ParticleForce thermostat_force(LangevinThermostat const &langevin,
+                                      Particle const &p, double time_step,
+                                      double kT, Utils::Vector3d const &noise,
+                                      Utils::Vector3d const &noise_rot) {
 #ifdef ROTATION
-  return {friction_thermo_langevin(langevin, p, time_step, kT),
+  return {friction_thermo_langevin(langevin, p, time_step, kT, noise),
           p.can_rotate() ? convert_vector_body_to_space(
                                p, friction_thermo_langevin_rotation(
-                                      langevin, p, time_step, kT))
+                                      langevin, p, time_step, kT, noise_rot))
                          : Utils::Vector3d{}};
 #else
-  return friction_thermo_langevin(langevin, p, time_step, kT);
+  return friction_thermo_langevin(langevin, p, time_step, kT, noise);
 #endif
 }
 
-/** Initialize the forces for a real particle */
-inline ParticleForce init_real_particle_force(Particle const &p,
-                                              double time_step, double kT) {
-  return thermostat_force(p, time_step, kT) + external_force(p);
+/** Initialize the forces of real particles with the Langevin thermostat.
+ *  The noise is drawn for chunks of particles at once with the batched
+ *  Philox generator, which gives the same values as the per-particle one.
+ */
+static void init_forces_langevin(const ParticleRange &particles,
+                                 double time_step, double kT) {
+  extern LangevinThermostat langevin;
+  constexpr std::size_t chunk_size = 64u;
+  std::array<Particle *, chunk_size> chunk;
+  std::array<int, chunk_size> ids;
+  std::array<Utils::Vector3d, chunk_size> noise;
+  std::array<Utils::Vector3d, chunk_size> noise_rot{};
+
+  auto const apply = [&](std::size_t n) {
+    auto const keys = Utils::Span<const int>(ids.data(), n);
+    Random::noise_uniform_batch<RNGSalt::LANGEVIN>(
+        langevin.rng_counter(), langevin.rng_seed(), keys, {},
+        Utils::make_span(noise.data(), n));
+#ifdef ROTATION
+    Random::noise_uniform_batch<RNGSalt::LANGEVIN_ROT>(
+        langevin.rng_counter(), langevin.rng_seed(), keys, {},
+        Utils::make_span(noise_rot.data(), n));
+#endif
+    for (std::size_t i = 0u; i < n; ++i) {
+      auto &p = *chunk[i];
+      p.f = thermostat_force(langevin, p, time_step, kT, noise[i],
+                             noise_rot[i]) +
+            external_force(p);
+    }
+  };
+
+  std::size_t n = 0u;
+  for (auto &p : particles) {
+    chunk[n] = &p;
+    ids[n] = p.id();
+    if (++n == chunk_size) {
+      apply(n);
+      n = 0u;
+    }
+  }
+  apply(n);
 }
 
 static void init_forces(const ParticleRange &particles,
@@ -126,8 +168,12 @@ static void init_forces(const ParticleRange &particles,
      or zero depending on the thermostat
      set torque to zero for all and rescale quaternions
   */
-  for (auto &p : particles) {
-    p.f = init_real_particle_force(p, time_step, kT);
+  if (thermo_switch & THERMO_LANGEVIN) {
+    init_forces_langevin(particles, time_step, kT);
+  } else {
+    for (auto &p : particles) {
+      p.f = external_force(p);
+    }
   }
 
   /* initialize ghost forces with zero
@@ -146,6 +192,7 @@ void init_forces_ghosts(const ParticleRange &particles) {
 
 void force_calc(CellStructure &cell_structure, double time_step, double kT) {
   ESPRESSO_PROFILER_CXX_MARK_FUNCTION;
+  Instrumentation::ScopedTimer timer(Instrumentation::Timer::FORCE_CALC);
 
   auto &espresso_system = EspressoSystemInterface::Instance();
   espresso_system.update();
@@ -154,6 +201,9 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
   prepare_local_collision_queue();
 #endif
   BondBreakage::clear_queue();
+#ifdef DPD
+  dpd_clear_queue();
+#endif
   auto particles = cell_structure.local_particles();
   auto ghost_particles = cell_structure.ghost_particles();
 #ifdef ELECTROSTATICS
@@ -166,7 +216,10 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
 #endif
   init_forces(particles, ghost_particles, time_step, kT);
 
-  calc_long_range_forces(particles);
+  {
+    Instrumentation::ScopedTimer timer(Instrumentation::Timer::LONG_RANGE);
+    calc_long_range_forces(particles);
+  }
 
   auto const elc_kernel = Coulomb::pair_force_elc_kernel();
   auto const coulomb_kernel = Coulomb::pair_force_kernel();
@@ -184,42 +237,67 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
   auto const dipole_cutoff = INACTIVE_CUTOFF;
 #endif
 
-  short_range_loop(
-      [coulomb_kernel_ptr = coulomb_kernel.get_ptr()](
-          Particle &p1, int bond_id, Utils::Span<Particle *> partners) {
-        return add_bonded_force(p1, bond_id, partners, coulomb_kernel_ptr);
-      },
-      [coulomb_kernel_ptr = coulomb_kernel.get_ptr(),
-       dipoles_kernel_ptr = dipoles_kernel.get_ptr(),
-       elc_kernel_ptr = elc_kernel.get_ptr()](Particle &p1, Particle &p2,
-                                              Distance const &d) {
-        add_non_bonded_pair_force(p1, p2, d.vec21, sqrt(d.dist2), d.dist2,
-                                  coulomb_kernel_ptr, dipoles_kernel_ptr,
-                                  elc_kernel_ptr);
+  auto const pair_cutoff = maximal_cutoff(n_nodes);
+  auto const verlet_criterion =
+      VerletCriterion<>{skin, interaction_range(), coulomb_cutoff,
+                        dipole_cutoff, collision_detection_cutoff()};
+
+#ifdef DPD
+  // Draw the DPD noise in blocks ahead of the short-range loop, which
+  // visits the pairs in the same order and adds the forces pair by pair
+  if ((thermo_switch & THERMO_DPD) and pair_cutoff > 0.) {
+    cell_structure.non_bonded_loop(
+        [](Particle const &p1, Particle const &p2, Distance const &d) {
+          auto const &ia_entry = get_ia_pair_entry(p1.type(), p2.type());
+          if (ia_entry.kernels & NB_DPD) {
+            dpd_queue_pair(p1, p2, *ia_entry.params, sqrt(d.dist2));
+          }
+        },
+        verlet_criterion);
+    dpd_generate_queued_noise();
+  }
+#endif
+
+  std::size_t n_pairs = 0;
+  {
+    Instrumentation::ScopedTimer timer(Instrumentation::Timer::SHORT_RANGE);
+    short_range_loop(
+        [coulomb_kernel_ptr = coulomb_kernel.get_ptr(),
+         iaparams = static_cast<Bonded_IA_Parameters const *>(nullptr),
+         iaparams_id = -1](Particle &p1, int bond_id,
+                           Utils::Span<Particle *> partners) mutable {
+          // bonds arrive grouped by id, look up the parameters once per group
+          if (bond_id != iaparams_id) {
+            iaparams = bonded_ia_params.at(bond_id).get();
+            iaparams_id = bond_id;
+          }
+          return add_bonded_force(p1, bond_id, *iaparams, partners,
+                                  coulomb_kernel_ptr);
+        },
+        [coulomb_kernel_ptr = coulomb_kernel.get_ptr(),
+         dipoles_kernel_ptr = dipoles_kernel.get_ptr(),
+         elc_kernel_ptr = elc_kernel.get_ptr(),
+         &n_pairs](Particle &p1, Particle &p2, Distance const &d) {
+          ++n_pairs;
+          add_non_bonded_pair_force(p1, p2, d.vec21, sqrt(d.dist2), d.dist2,
+                                    coulomb_kernel_ptr, dipoles_kernel_ptr,
+                                    elc_kernel_ptr);
 #ifdef COLLISION_DETECTION
-        if (collision_params.mode != CollisionModeType::OFF)
-          detect_collision(p1, p2, d.dist2);
+          if (collision_params.mode != CollisionModeType::OFF)
+            detect_collision(p1, p2, d.dist2);
 #endif
-      },
-      maximal_cutoff(n_nodes), maximal_cutoff_bonded(),
-      VerletCriterion<>{skin, interaction_range(), coulomb_cutoff,
-                        dipole_cutoff, collision_detection_cutoff()});
+        },
+        pair_cutoff, maximal_cutoff_bonded(), verlet_criterion);
+  }
+  Instrumentation::count(Instrumentation::Counter::PAIRS, n_pairs);
 
   Constraints::constraints.add_forces(particles, get_sim_time());
 
   if (max_oif_objects) {
     // There are two global quantities that need to be evaluated:
     // object's surface and object's volume.
-    for (int i = 0; i < max_oif_objects; i++) {
-      auto const area_volume = boost::mpi::all_reduce(
-          comm_cart, calc_oif_global(i, cell_structure), std::plus<>());
-      auto const oif_part_area = std::abs(area_volume[0]);
-      auto const oif_part_vol = std::abs(area_volume[1]);
-      if (oif_part_area < 1e-100 and oif_part_vol < 1e-100) {
-        break;
-      }
-      add_oif_global_forces(area_volume, i, cell_structure);
-    }
+    auto const area_volume = calc_oif_global(max_oif_objects, cell_structure);
+    add_oif_global_forces(area_volume, cell_structure);
   }
 
   // Must be done here. Forces need to be ghost-communicated
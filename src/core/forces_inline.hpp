@@ -36,23 +36,10 @@
 #include "immersed_boundary/ibm_tribend.hpp"
 #include "immersed_boundary/ibm_triel.hpp"
 #include "magnetostatics/dipoles_inline.hpp"
-#include "nonbonded_interactions/bmhtf-nacl.hpp"
-#include "nonbonded_interactions/buckingham.hpp"
-#include "nonbonded_interactions/gaussian.hpp"
+#include "nonbonded_interactions/central_pair_potential.hpp"
 #include "nonbonded_interactions/gay_berne.hpp"
-#include "nonbonded_interactions/hat.hpp"
-#include "nonbonded_interactions/hertzian.hpp"
-#include "nonbonded_interactions/lj.hpp"
-#include "nonbonded_interactions/ljcos.hpp"
-#include "nonbonded_interactions/ljcos2.hpp"
-#include "nonbonded_interactions/ljgen.hpp"
-#include "nonbonded_interactions/morse.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
-#include "nonbonded_interactions/nonbonded_tab.hpp"
-#include "nonbonded_interactions/smooth_step.hpp"
-#include "nonbonded_interactions/soft_sphere.hpp"
 #include "nonbonded_interactions/thole.hpp"
-#include "nonbonded_interactions/wca.hpp"
 #include "object-in-fluid/oif_global_forces.hpp"
 #include "object-in-fluid/oif_local_forces.hpp"
 
@@ -75,75 +62,22 @@
 #include <tuple>
 
 inline ParticleForce calc_non_bonded_pair_force(
-    Particle const &p1, Particle const &p2, IA_parameters const &ia_params,
+    Particle const &p1, Particle const &p2, IA_pair_entry const &ia_entry,
     Utils::Vector3d const &d, double const dist,
     Coulomb::ShortRangeForceKernel::kernel_type const *coulomb_kernel) {
 
   ParticleForce pf{};
-  double force_factor = 0;
-/* Lennard-Jones */
-#ifdef LENNARD_JONES
-  force_factor += lj_pair_force_factor(ia_params, dist);
-#endif
-/* WCA */
-#ifdef WCA
-  force_factor += wca_pair_force_factor(ia_params, dist);
-#endif
-/* Lennard-Jones generic */
-#ifdef LENNARD_JONES_GENERIC
-  force_factor += ljgen_pair_force_factor(ia_params, dist);
-#endif
-/* smooth step */
-#ifdef SMOOTH_STEP
-  force_factor += SmSt_pair_force_factor(ia_params, dist);
-#endif
-/* Hertzian force */
-#ifdef HERTZIAN
-  force_factor += hertzian_pair_force_factor(ia_params, dist);
-#endif
-/* Gaussian force */
-#ifdef GAUSSIAN
-  force_factor += gaussian_pair_force_factor(ia_params, dist);
-#endif
-/* BMHTF NaCl */
-#ifdef BMHTF_NACL
-  force_factor += BMHTF_pair_force_factor(ia_params, dist);
-#endif
-/* Buckingham*/
-#ifdef BUCKINGHAM
-  force_factor += buck_pair_force_factor(ia_params, dist);
-#endif
-/* Morse*/
-#ifdef MORSE
-  force_factor += morse_pair_force_factor(ia_params, dist);
-#endif
-/*soft-sphere potential*/
-#ifdef SOFT_SPHERE
-  force_factor += soft_pair_force_factor(ia_params, dist);
-#endif
-/*hat potential*/
-#ifdef HAT
-  force_factor += hat_pair_force_factor(ia_params, dist);
-#endif
-/* Lennard-Jones cosine */
-#ifdef LJCOS
-  force_factor += ljcos_pair_force_factor(ia_params, dist);
-#endif
-/* Lennard-Jones cosine */
-#ifdef LJCOS2
-  force_factor += ljcos2_pair_force_factor(ia_params, dist);
-#endif
+  auto const force_factor = central_pair_force_factor(ia_entry, dist);
 /* Thole damping */
 #ifdef THOLE
-  pf.f += thole_pair_force(p1, p2, ia_params, d, dist, coulomb_kernel);
-#endif
-/* tabulated */
-#ifdef TABULATED
-  force_factor += tabulated_pair_force_factor(ia_params, dist);
+  if (ia_entry.kernels & NB_THOLE)
+    pf.f += thole_pair_force(p1, p2, *ia_entry.params, d, dist,
+                             coulomb_kernel);
 #endif
 /* Gay-Berne */
 #ifdef GAY_BERNE
-  pf += gb_pair_force(p1.quat(), p2.quat(), ia_params, d, dist);
+  if (ia_entry.kernels & NB_GAY_BERNE)
+    pf += gb_pair_force(p1.quat(), p2.quat(), *ia_entry.params, d, dist);
 #endif
   pf.f += force_factor * d;
   return pf;
@@ -180,18 +114,18 @@ inline void add_non_bonded_pair_force(
     Coulomb::ShortRangeForceKernel::kernel_type const *coulomb_kernel,
     Dipoles::ShortRangeForceKernel::kernel_type const *dipoles_kernel,
     Coulomb::ShortRangeForceCorrectionsKernel::kernel_type const *elc_kernel) {
-  auto const &ia_params = get_ia_param(p1.type(), p2.type());
+  auto const &ia_entry = get_ia_pair_entry(p1.type(), p2.type());
   ParticleForce pf{};
 
   /***********************************************/
   /* non-bonded pair potentials                  */
   /***********************************************/
 
-  if (dist < ia_params.max_cut) {
+  if (dist < ia_entry.max_cut) {
 #ifdef EXCLUSIONS
     if (do_nonbonded(p1, p2))
 #endif
-      pf += calc_non_bonded_pair_force(p1, p2, ia_params, d, dist,
+      pf += calc_non_bonded_pair_force(p1, p2, ia_entry, d, dist,
                                        coulomb_kernel);
   }
 
@@ -225,8 +159,9 @@ inline void add_non_bonded_pair_force(
 
   /* The inter dpd force should not be part of the virial */
 #ifdef DPD
-  if (thermo_switch & THERMO_DPD) {
-    auto const force = dpd_pair_force(p1, p2, ia_params, d, dist, dist2);
+  if ((thermo_switch & THERMO_DPD) and (ia_entry.kernels & NB_DPD)) {
+    auto const force =
+        dpd_queued_pair_force(p1, p2, *ia_entry.params, d, dist, dist2);
     p1.force() += force;
     p2.force() -= force;
   }
@@ -411,7 +346,9 @@ inline bool add_bonded_four_body_force(Bonded_IA_Parameters const &iaparams,
 }
 
 inline bool
-add_bonded_force(Particle &p1, int bond_id, Utils::Span<Particle *> partners,
+add_bonded_force(Particle &p1, int bond_id,
+                 Bonded_IA_Parameters const &iaparams,
+                 Utils::Span<Particle *> partners,
                  Coulomb::ShortRangeForceKernel::kernel_type const *kernel) {
 
   // Consider for bond breakage
@@ -422,8 +359,6 @@ add_bonded_force(Particle &p1, int bond_id, Utils::Span<Particle *> partners,
       return false;
   }
 
-  auto const &iaparams = *bonded_ia_params.at(bond_id);
-
   switch (number_of_partners(iaparams)) {
   case 0:
     return false;
@@ -440,4 +375,11 @@ add_bonded_force(Particle &p1, int bond_id, Utils::Span<Particle *> partners,
   }
 }
 
+inline bool
+add_bonded_force(Particle &p1, int bond_id, Utils::Span<Particle *> partners,
+                 Coulomb::ShortRangeForceKernel::kernel_type const *kernel) {
+  return add_bonded_force(p1, bond_id, *bonded_ia_params.at(bond_id), partners,
+                          kernel);
+}
+
 #endif // CORE_FORCES_INLINE_HPP
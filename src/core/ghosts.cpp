@@ -30,6 +30,7 @@
  */
 #include "ghosts.hpp"
 #include "Particle.hpp"
+#include "instrumentation.hpp"
 
 #include <utils/Span.hpp>
 #include <utils/serialization/memcpy_archive.hpp>
@@ -426,6 +427,7 @@ void ghost_communicator(const GhostCommunicator &gcr, unsigned int data_parts) {
   if (GHOSTTRANS_NONE == data_parts)
     return;
 
+  Instrumentation::ScopedTimer timer(Instrumentation::Timer::GHOST_COMM);
   static CommBuf send_buffer, recv_buffer;
 
   auto const &comm = gcr.mpi_comm;
@@ -482,12 +484,16 @@ void ghost_communicator(const GhostCommunicator &gcr, unsigned int data_parts) {
       comm.send(node, REQ_GHOST_SEND, send_buffer.data(),
                 static_cast<int>(send_buffer.size()));
       comm.send(node, REQ_GHOST_SEND, send_buffer.bonds());
+      Instrumentation::count(Instrumentation::Counter::GHOST_BYTES_SENT,
+                             send_buffer.size() + send_buffer.bonds().size());
       break;
     case GHOST_BCST:
       if (node == comm.rank()) {
         boost::mpi::broadcast(comm, send_buffer.data(),
                               static_cast<int>(send_buffer.size()), node);
         boost::mpi::broadcast(comm, send_buffer.bonds(), node);
+        Instrumentation::count(Instrumentation::Counter::GHOST_BYTES_SENT,
+                               send_buffer.size() + send_buffer.bonds().size());
       } else {
         boost::mpi::broadcast(comm, recv_buffer.data(),
                               static_cast<int>(recv_buffer.size()), node);
@@ -38,11 +38,16 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
 
 BoxGeometry box_geo;
 LocalBox<double> local_geo;
 
 Utils::Vector3i node_grid{};
+NodeGridSplits node_grid_splits{};
 
 void init_node_grid() { grid_changed_n_nodes(); }
 
@@ -51,7 +56,17 @@ int map_position_node_array(const Utils::Vector3d &pos) {
 
   Utils::Vector3i im;
   for (int i = 0; i < 3; i++) {
-    im[i] = static_cast<int>(std::floor(f_pos[i] / local_geo.length()[i]));
+    auto const &splits = node_grid_splits[i];
+    if (splits.empty()) {
+      im[i] = static_cast<int>(std::floor(f_pos[i] / local_geo.length()[i]));
+    } else {
+      // first inner boundary above the position
+      auto const length = box_geo.length()[i];
+      auto const it = std::upper_bound(
+          splits.begin() + 1, splits.end() - 1, f_pos[i],
+          [length](double pos, double split) { return pos < split * length; });
+      im[i] = static_cast<int>(std::distance(splits.begin(), it)) - 1;
+    }
     im[i] = std::clamp(im[i], 0, node_grid[i] - 1);
   }
 
@@ -69,13 +84,20 @@ calc_node_neighbors(const boost::mpi::communicator &comm) {
 
 LocalBox<double> regular_decomposition(const BoxGeometry &box,
                                        Utils::Vector3i const &node_pos,
-                                       Utils::Vector3i const &node_grid_par) {
+                                       Utils::Vector3i const &node_grid_par,
+                                       NodeGridSplits const &splits) {
   Utils::Vector3d local_length;
   Utils::Vector3d my_left;
 
   for (int i = 0; i < 3; i++) {
-    local_length[i] = box.length()[i] / node_grid_par[i];
-    my_left[i] = node_pos[i] * local_length[i];
+    if (splits[i].empty()) {
+      local_length[i] = box.length()[i] / node_grid_par[i];
+      my_left[i] = node_pos[i] * local_length[i];
+    } else {
+      auto const k = static_cast<std::size_t>(node_pos[i]);
+      my_left[i] = splits[i][k] * box.length()[i];
+      local_length[i] = splits[i][k + 1] * box.length()[i] - my_left[i];
+    }
   }
 
   Utils::Array<int, 6> boundaries;
@@ -91,13 +113,16 @@ LocalBox<double> regular_decomposition(const BoxGeometry &box,
 }
 
 void grid_changed_box_l(const BoxGeometry &box) {
-  local_geo = regular_decomposition(box, calc_node_pos(comm_cart), node_grid);
+  local_geo = regular_decomposition(box, calc_node_pos(comm_cart), node_grid,
+                                    node_grid_splits);
 }
 
 void grid_changed_n_nodes() {
   comm_cart =
       Utils::Mpi::cart_create(comm_cart, node_grid, /* reorder */ false);
 
+  node_grid_splits = {};
+
   this_node = comm_cart.rank();
 
   calc_node_neighbors(comm_cart);
@@ -110,6 +135,24 @@ void set_node_grid(Utils::Vector3i const &value) {
   on_node_grid_change();
 }
 
+void set_node_grid_splits(NodeGridSplits const &value) {
+  for (int i = 0; i < 3; i++) {
+    auto const &splits = value[i];
+    if (splits.empty()) {
+      continue;
+    }
+    if (splits.size() != static_cast<std::size_t>(node_grid[i]) + 1u or
+        splits.front() != 0. or splits.back() != 1. or
+        std::adjacent_find(splits.begin(), splits.end(),
+                           std::greater_equal<>()) != splits.end()) {
+      throw std::invalid_argument("Subdomain boundaries in direction " +
+                                  std::to_string(i) + " are not valid");
+    }
+  }
+  ::node_grid_splits = value;
+  on_node_grid_splits_change();
+}
+
 void set_box_length(Utils::Vector3d const &value) {
   ::box_geo.set_length(value);
   on_boxl_change();
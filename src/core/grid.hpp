@@ -38,12 +38,22 @@
 
 #include <boost/mpi/communicator.hpp>
 
+#include <array>
+#include <vector>
+
 extern BoxGeometry box_geo;
 extern LocalBox<double> local_geo;
 
 /** The number of nodes in each spatial dimension. */
 extern Utils::Vector3i node_grid;
 
+/** Boundaries of the subdomains along each direction, in units of the box
+ *  length. Direction @c i holds <tt>node_grid[i] + 1</tt> increasing values
+ *  from 0 to 1, or is empty if all subdomains have the same size.
+ */
+using NodeGridSplits = std::array<std::vector<double>, 3>;
+extern NodeGridSplits node_grid_splits;
+
 /** Make sure that the node grid is set, eventually
  *  determine one automatically.
  */
@@ -95,18 +105,24 @@ inline Utils::Vector3d unfolded_position(const Utils::Vector3d &pos,
 }
 
 /**
- * @brief Composition of the simulation box into equal parts for each node.
+ * @brief Composition of the simulation box into parts for each node.
  *
  * @param box Geometry of the simulation box
  * @param node_pos Position of node in the node grid
  * @param node_grid Nodes in each direction
+ * @param splits Subdomain boundaries, equal parts for empty directions
  * @return Geometry for the node
  */
 LocalBox<double> regular_decomposition(const BoxGeometry &box,
                                        Utils::Vector3i const &node_pos,
-                                       Utils::Vector3i const &node_grid);
+                                       Utils::Vector3i const &node_grid,
+                                       NodeGridSplits const &splits = {});
 
 void set_node_grid(Utils::Vector3i const &value);
+/** @brief Move the subdomain boundaries, see @ref node_grid_splits.
+ *  Setting the node grid restores subdomains of equal size.
+ */
+void set_node_grid_splits(NodeGridSplits const &value);
 void set_box_length(Utils::Vector3d const &value);
 
 #endif
@@ -16,3 +16,1295 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
+
+/** @file
+ *  CPU implementation of the electrokinetics method, used when ESPResSo is
+ *  built without CUDA.
+ *
+ *  The species densities and the electrostatic potential are stored on the
+ *  lattice of the CPU LB, including its halo, and are distributed over the
+ *  MPI ranks in the same way. Every rank computes the link fluxes of its own
+ *  nodes from the densities in the halo, so that a flux leaving a node is
+ *  computed bit-identically on the rank owning the neighbor and no fluxes
+ *  have to be sent back. The Poisson equation is solved with the parallel
+ *  FFT of P3M.
+ *
+ *  The link-centered stencil with the ideal fluid coupling, advection and
+ *  the electrostatic coupling to charged particles are supported; thermal
+ *  fluctuations, the node-centered stencil and EK boundaries require the
+ *  GPU implementation.
+ */
+
+#include "config/config.hpp"
+
+#if defined(ELECTROKINETICS) && !defined(CUDA)
+
+#include "grid_based_algorithms/electrokinetics.hpp"
+
+#include "MpiCallbacks.hpp"
+#include "Particle.hpp"
+#include "cells.hpp"
+#include "communication.hpp"
+#include "errorhandling.hpp"
+#include "grid.hpp"
+#include "grid_based_algorithms/halo.hpp"
+#include "grid_based_algorithms/lattice.hpp"
+#include "grid_based_algorithms/lb.hpp"
+#include "grid_based_algorithms/lb_collective_interface.hpp"
+#include "grid_based_algorithms/lb_interface.hpp"
+#include "grid_based_algorithms/lb_particle_coupling.hpp"
+#include "integrate.hpp"
+#include "p3m/fft.hpp"
+
+#include <utils/Vector.hpp>
+#include <utils/constants.hpp>
+#include <utils/index.hpp>
+#include <utils/math/int_pow.hpp>
+#include <utils/math/sqr.hpp>
+
+#include <boost/mpi/collectives/gather.hpp>
+#include <boost/optional.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using Utils::get_linear_index;
+
+EKParameters ek_parameters = {
+    // agrid
+    -1.0,
+    // time_step
+    -1.0,
+    // lb_density
+    -1.0,
+    // dim_x
+    0,
+    // dim_x_padded
+    0,
+    // dim_y
+    0,
+    // dim_z
+    0,
+    // number_of_nodes
+    0,
+    // viscosity
+    -1.0,
+    // bulk_viscosity
+    -1.0,
+    // gamma_odd
+    0.0,
+    // gamma_even
+    0.0,
+    // friction
+    0.0,
+    // T
+    -1.0,
+    // prefactor
+    -1.0,
+    // lb_ext_force_density
+    {0.0, 0.0, 0.0},
+    // number_of_species
+    0,
+    // reaction_species
+    {-1, -1, -1},
+    // rho_reactant_reservoir
+    -1.0,
+    // rho_product0_reservoir
+    -1.0,
+    // rho_product1_reservoir
+    -1.0,
+    // reaction_ct_rate
+    -1.0,
+    // reaction_fraction_0
+    -1.0,
+    // reaction_fraction_1
+    -1.0,
+    // mass_reactant
+    -1.0,
+    // mass_product0
+    -1.0,
+    // mass_product1
+    -1.0,
+    // stencil
+    0,
+    // number_of_boundary_nodes
+    -1,
+    // fluctuation_amplitude
+    -1.0,
+    // fluctuation
+    false,
+    // advection
+    true,
+    // fluidcoupling_ideal_contribution
+    true,
+    // es_coupling
+    false,
+    // charge_potential_buffer
+    nullptr,
+    // electric_field
+    nullptr,
+    // charge_potential
+    nullptr,
+    // j
+    nullptr,
+    // lb_force_density_previous
+    nullptr,
+#ifdef EK_DEBUG
+    // j_fluc
+    nullptr,
+#endif
+    // rho
+    {},
+    // species_index
+    {-1},
+    // density
+    {},
+    // D
+    {},
+    // d
+    {},
+    // valency
+    {},
+    // ext_force_density
+    {},
+    // node_is_catalyst
+    nullptr,
+};
+
+bool ek_initialized = false;
+
+namespace {
+
+/** Number of links carrying a diffusive flux (faces and edges). */
+constexpr int n_diffusive_links = 9;
+
+/** Directions of the links stored with a node, in the order of the
+ *  @c EK_LINK_xyz constants. The links in the opposite directions are
+ *  numbered <tt>13 + i</tt>.
+ */
+constexpr std::array<std::array<int, 3>, 13> link_directions = {
+    {{{1, 0, 0}}, {{0, 1, 0}}, {{0, 0, 1}}, {{1, 1, 0}}, {{1, -1, 0}},
+     {{1, 0, 1}}, {{1, 0, -1}}, {{0, 1, 1}}, {{0, 1, -1}}, {{1, 1, 1}},
+     {{1, 1, -1}}, {{1, -1, 1}}, {{1, -1, -1}}}};
+
+/** A link between a node and its upper neighbor. */
+struct Link {
+  /** direction from the lower to the upper node */
+  Utils::Vector3d c;
+  /** unit vector along the link */
+  Utils::Vector3d c_hat;
+  /** inverse of the link length */
+  double inv_length;
+  /** distance of the upper node in the linear index of the halo lattice */
+  Lattice::index_t offset;
+};
+
+/** Node-local data of the CPU implementation. All fields are stored in the
+ *  layout of the LB lattice, including the halo.
+ */
+struct EKLocalData {
+  /** number of particles per node, for every species */
+  std::vector<std::vector<double>> rho;
+  /** buffer for the propagated densities */
+  std::vector<double> rho_next;
+  /** electrostatic potential */
+  std::vector<double> potential;
+  /** electrostatic potential of the species alone, for the coupling to
+   *  charged particles
+   */
+  std::vector<double> particle_potential;
+  /** Cartesian components of the electric field of the species */
+  std::array<std::vector<double>, 3> electric_field;
+  /** buffer for the charge per node */
+  std::vector<double> charge;
+  /** fluid displacement per time step in lattice units, for advection */
+  std::vector<Utils::Vector3d> displacement;
+  std::array<Link, 13> links;
+
+  /** halo communication of a single scalar field */
+  HaloCommunicator halo_comm{0};
+  bool halo_comm_ready = false;
+
+  /** @name Poisson solver */
+  /**@{*/
+  fft_data_struct fft;
+  int ks_pnum = 0;
+  fft_vector<double> mesh;
+  std::vector<double> greens_function;
+  /**@}*/
+};
+
+EKLocalData ek_local;
+
+/** Quantities that can be read from the lattice. */
+enum class EKField : int {
+  DENSITY,
+  FLUX,
+  POTENTIAL,
+  PARTICLE_POTENTIAL,
+  LB_DENSITY,
+  LB_VELOCITY
+};
+
+std::size_t ek_field_size(EKField field) {
+  if (field == EKField::FLUX or field == EKField::LB_VELOCITY) {
+    return 3u;
+  }
+  return 1u;
+}
+
+bool is_boundary(Lattice::index_t index) {
+#ifdef LB_BOUNDARIES
+  return lbfields[index].boundary != 0;
+#else
+  return false;
+#endif
+}
+
+/** Call @p kernel with the linear index and the local lattice position of
+ *  every node of this rank, halo excluded, with x running fastest.
+ */
+template <class Kernel> void for_each_local_node(Kernel &&kernel) {
+  for (int z = 1; z <= lblattice.grid[2]; z++) {
+    for (int y = 1; y <= lblattice.grid[1]; y++) {
+      for (int x = 1; x <= lblattice.grid[0]; x++) {
+        kernel(get_linear_index(x, y, z, lblattice.halo_grid),
+               Utils::Vector3i{{x, y, z}});
+      }
+    }
+  }
+}
+
+void halo_exchange(std::vector<double> &field) {
+  halo_communication(ek_local.halo_comm,
+                     reinterpret_cast<char *>(field.data()));
+}
+
+/** Diffusive and migrative flux of a species along a link, from the lower
+ *  node @p a to the upper node @p b, in particles per time step.
+ */
+double diffusive_flux(int species_index, std::vector<double> const &rho,
+                      Lattice::index_t a, Lattice::index_t b,
+                      Link const &link) {
+  if (is_boundary(a) or is_boundary(b)) {
+    return 0.;
+  }
+  auto const &phi = ek_local.potential;
+  auto const agrid_inv = 1. / ek_parameters.agrid;
+  auto const inv_length = link.inv_length * agrid_inv;
+  Utils::Vector3d const ext_force{
+      {ek_parameters.ext_force_density[0][species_index],
+       ek_parameters.ext_force_density[1][species_index],
+       ek_parameters.ext_force_density[2][species_index]}};
+
+  auto const force =
+      ek_parameters.valency[species_index] * (phi[a] - phi[b]) * inv_length +
+      ext_force * link.c_hat;
+  auto flux = (rho[a] - rho[b]) * inv_length +
+              force * (rho[a] + rho[b]) / (2. * ek_parameters.T);
+  flux *= ek_parameters.d[species_index] * agrid_inv;
+
+  return flux * ek_parameters.time_step;
+}
+
+/** Fraction of the particles of a node that the fluid moves to the
+ *  neighbor in direction @p e within one time step.
+ */
+double advected_fraction(Utils::Vector3d const &displacement,
+                         Utils::Vector3i const &e) {
+  auto fraction = 1.;
+  for (unsigned int i = 0; i < 3; i++) {
+    auto const d = displacement[i];
+    if (e[i] == 0) {
+      fraction *= 1. - std::abs(d);
+    } else if ((e[i] > 0) != std::signbit(d)) {
+      fraction *= std::abs(d);
+    } else {
+      return 0.;
+    }
+  }
+  return fraction;
+}
+
+/** Call @p kernel with the direction, the neighbor index and the number of
+ *  particles of a species leaving node @p index towards each of its 26
+ *  neighbors within one time step. The diffusive part of the flux is
+ *  passed separately for the fluid coupling.
+ */
+template <class Kernel>
+void for_each_link_flux(int species_index, Lattice::index_t index,
+                        Kernel &&kernel) {
+  auto const &rho = ek_local.rho[species_index];
+  for (int l = 0; l < 13; l++) {
+    auto const &link = ek_local.links[l];
+    for (int const sign : {1, -1}) {
+      auto const neighbor = index + sign * link.offset;
+      auto const e = sign * Utils::Vector3i{link_directions[l]};
+
+      auto j_diffusive = 0.;
+      if (l < n_diffusive_links) {
+        j_diffusive =
+            (sign == 1)
+                ? diffusive_flux(species_index, rho, index, neighbor, link)
+                : -diffusive_flux(species_index, rho, neighbor, index, link);
+      }
+
+      auto j_advective = 0.;
+      if (ek_parameters.advection and not is_boundary(index) and
+          not is_boundary(neighbor)) {
+        j_advective =
+            rho[index] * advected_fraction(ek_local.displacement[index], e) -
+            rho[neighbor] *
+                advected_fraction(ek_local.displacement[neighbor], -e);
+      }
+
+      kernel(e, j_diffusive, j_diffusive + j_advective);
+    }
+  }
+}
+
+/** Particle flux density of a species at a node. */
+Utils::Vector3d node_flux(int species_index, Lattice::index_t index) {
+  Utils::Vector3d flux{};
+  for_each_link_flux(species_index, index,
+                     [&flux](Utils::Vector3i const &e, double, double j) {
+                       flux += 0.5 * j * Utils::Vector3d(e);
+                     });
+  return flux / (ek_parameters.time_step * Utils::sqr(ek_parameters.agrid));
+}
+
+/** Fluid velocity of all nodes in lattice units, halo included. */
+void update_displacement() {
+  auto const n_nodes = static_cast<std::size_t>(lblattice.halo_grid_volume);
+  for (std::size_t i = 0; i < n_nodes; i++) {
+    auto const index = static_cast<Lattice::index_t>(i);
+    if (is_boundary(index)) {
+      ek_local.displacement[i] = Utils::Vector3d{};
+      continue;
+    }
+    auto const modes = lb_calc_modes(index, lbfluid);
+    auto const density = lb_calc_density(modes, lbpar);
+    ek_local.displacement[i] =
+        lb_calc_momentum_density(modes, Utils::Vector3d{}) / density;
+  }
+}
+
+void integrate_species(int species_index) {
+  auto &rho = ek_local.rho[species_index];
+  auto &rho_next = ek_local.rho_next;
+  auto const D = ek_parameters.D[species_index];
+  auto const force_conversion =
+      (D > 0.f) ? ek_parameters.T * ek_parameters.time_step / D : 0.;
+
+  std::copy(rho.begin(), rho.end(), rho_next.begin());
+  for_each_local_node([&](Lattice::index_t index, Utils::Vector3i const &) {
+    Utils::Vector3d force{};
+    auto outflow = 0.;
+    for_each_link_flux(species_index, index,
+                       [&](Utils::Vector3i const &e, double j_diffusive,
+                           double j) {
+                         force += 0.5 * force_conversion * j_diffusive *
+                                  Utils::Vector3d(e);
+                         outflow += j;
+                       });
+    rho_next[index] = rho[index] - outflow;
+    lbfields[index].force_density += force;
+  });
+  std::swap(rho, rho_next);
+  halo_exchange(rho);
+}
+
+/** Call @p kernel with the index and the weight of the nodes of the linear
+ *  interpolation at @p pos, which has to be in the local domain or halo.
+ */
+template <class Kernel>
+void for_each_interpolation_node(Utils::Vector3d const &pos,
+                                 Kernel &&kernel) {
+  Utils::Vector<std::size_t, 8> node_index{};
+  Utils::Vector6d delta{};
+  lblattice.map_position_to_lattice(pos, node_index, delta);
+  for (int z = 0; z < 2; z++) {
+    for (int y = 0; y < 2; y++) {
+      for (int x = 0; x < 2; x++) {
+        kernel(static_cast<Lattice::index_t>(node_index[(z * 2 + y) * 2 + x]),
+               delta[3 * x + 0] * delta[3 * y + 1] * delta[3 * z + 2]);
+      }
+    }
+  }
+}
+
+/** Add the charges of the particles to the nodes. Like in the LB particle
+ *  coupling, every rank spreads the images of the local and ghost particles
+ *  that overlap with its domain, hence the local nodes receive all charges
+ *  without a communication of the halo.
+ */
+void add_particle_charges(std::vector<double> &charge) {
+  std::unordered_set<int> coupled_ghost_particles;
+  auto const add_charge = [&](Particle const &p) {
+    if (p.q() == 0. or not should_be_coupled(p, coupled_ghost_particles)) {
+      return;
+    }
+    for (auto const &pos : positions_in_halo(p.pos(), box_geo)) {
+      for_each_interpolation_node(
+          pos, [&](Lattice::index_t index, double weight) {
+            charge[index] += p.q() * weight;
+          });
+    }
+  };
+  for (auto const &p : cell_structure.local_particles()) {
+    add_charge(p);
+  }
+  for (auto const &p : cell_structure.ghost_particles()) {
+    add_charge(p);
+  }
+}
+
+/** Solve the Poisson equation for the charge per node of the local nodes
+ *  and store the potential, including the halo.
+ */
+void solve_poisson(std::vector<double> const &charge,
+                   std::vector<double> &potential) {
+  auto &mesh = ek_local.mesh;
+  auto const node_volume = Utils::int_pow<3>(ek_parameters.agrid);
+
+  /* the FFT mesh is stored with z running fastest */
+  auto const &grid = lblattice.grid;
+  auto const for_each_mesh_node = [&grid](auto &&kernel) {
+    std::size_t ind = 0;
+    for (int x = 1; x <= grid[0]; x++) {
+      for (int y = 1; y <= grid[1]; y++) {
+        for (int z = 1; z <= grid[2]; z++) {
+          kernel(ind++, get_linear_index(x, y, z, lblattice.halo_grid));
+        }
+      }
+    }
+  };
+
+  for_each_mesh_node([&](std::size_t ind, Lattice::index_t index) {
+    mesh[ind] = charge[index] / node_volume;
+  });
+
+  fft_perform_forw(mesh.data(), ek_local.fft, comm_cart);
+  auto const &greens_function = ek_local.greens_function;
+  for (std::size_t i = 0; i < greens_function.size(); i++) {
+    mesh[2 * i + 0] *= greens_function[i];
+    mesh[2 * i + 1] *= greens_function[i];
+  }
+  fft_perform_back(mesh.data(), false, ek_local.fft, comm_cart);
+
+  for_each_mesh_node([&](std::size_t ind, Lattice::index_t index) {
+    potential[index] = mesh[ind];
+  });
+  halo_exchange(potential);
+}
+
+/** Electric field of the particle potential at the nodes, including the
+ *  halo, from central differences.
+ */
+void update_electric_field() {
+  auto const &phi = ek_local.particle_potential;
+  auto const prefactor = -0.5 / ek_parameters.agrid;
+  for_each_local_node([&](Lattice::index_t index, Utils::Vector3i const &) {
+    for (unsigned int i = 0u; i < 3u; i++) {
+      auto const offset = ek_local.links[i].offset;
+      ek_local.electric_field[i][index] =
+          prefactor * (phi[index + offset] - phi[index - offset]);
+    }
+  });
+  for (auto &component : ek_local.electric_field) {
+    halo_exchange(component);
+  }
+}
+
+void init_greens_function() {
+  auto const &plan = ek_local.fft.plan[3];
+  auto const &global_grid = lblattice.global_grid;
+  auto const n_nodes = static_cast<double>(Utils::product(global_grid));
+  auto const prefactor =
+      -2. * Utils::pi() * ek_parameters.prefactor *
+      Utils::sqr(static_cast<double>(ek_parameters.agrid)) / n_nodes;
+
+  ek_local.greens_function.resize(static_cast<std::size_t>(plan.new_size));
+  std::size_t ind = 0;
+  int j[3];
+  for (j[0] = 0; j[0] < plan.new_mesh[0]; j[0]++) {
+    for (j[1] = 0; j[1] < plan.new_mesh[1]; j[1]++) {
+      for (j[2] = 0; j[2] < plan.new_mesh[2]; j[2]++) {
+        auto denominator = -3.;
+        auto is_zero_mode = true;
+        for (int d = 0; d < 3; d++) {
+          auto const d_rs = (d + ek_local.ks_pnum) % 3;
+          auto const k = j[d] + plan.start[d];
+          denominator += std::cos(2. * Utils::pi() * k / global_grid[d_rs]);
+          is_zero_mode &= (k == 0);
+        }
+        // the zero mode is dropped, which enforces charge neutrality
+        ek_local.greens_function[ind++] =
+            (is_zero_mode) ? 0. : prefactor / denominator;
+      }
+    }
+  }
+}
+
+void init_local_data() {
+  auto const n_nodes = static_cast<std::size_t>(lblattice.halo_grid_volume);
+  ek_local.rho.resize(ek_parameters.number_of_species);
+  for (auto &rho : ek_local.rho) {
+    rho.resize(n_nodes);
+  }
+  ek_local.rho_next.resize(n_nodes);
+  ek_local.potential.resize(n_nodes);
+  ek_local.charge.resize(n_nodes);
+  if (ek_parameters.es_coupling) {
+    ek_local.particle_potential.resize(n_nodes);
+    for (auto &component : ek_local.electric_field) {
+      component.resize(n_nodes);
+    }
+  }
+  ek_local.displacement.resize(n_nodes);
+
+  auto const &halo_grid = lblattice.halo_grid;
+  for (std::size_t l = 0; l < ek_local.links.size(); l++) {
+    auto const c = Utils::Vector3i{link_directions[l]};
+    auto &link = ek_local.links[l];
+    link.c = Utils::Vector3d(c);
+    link.c_hat = link.c / link.c.norm();
+    link.inv_length = 1. / link.c.norm();
+    link.offset = c[0] + halo_grid[0] * (c[1] + halo_grid[1] * c[2]);
+  }
+
+  if (not ek_local.halo_comm_ready) {
+    prepare_halo_communication(ek_local.halo_comm, lblattice, MPI_DOUBLE,
+                               node_grid);
+    ek_local.halo_comm_ready = true;
+  }
+
+  if (not ek_local.fft.init_tag) {
+    int const margin[6] = {0, 0, 0, 0, 0, 0};
+    auto const mesh_size = fft_init(
+        lblattice.grid, margin, lblattice.global_grid, Utils::Vector3d{},
+        ek_local.ks_pnum, ek_local.fft, node_grid, comm_cart);
+    ek_local.mesh.resize(static_cast<std::size_t>(mesh_size));
+    init_greens_function();
+  }
+}
+
+void mpi_ek_init_local(bool init_species_densities) {
+  // the parameters are plain data, the device pointers are unused
+  MPI_Bcast(&ek_parameters, sizeof(EKParameters), MPI_BYTE, 0, comm_cart);
+  ek_initialized = true;
+  init_local_data();
+
+  if (init_species_densities) {
+    auto const node_volume = Utils::int_pow<3>(ek_parameters.agrid);
+    for (std::size_t s = 0; s < ek_local.rho.size(); s++) {
+      std::fill(ek_local.rho[s].begin(), ek_local.rho[s].end(),
+                ek_parameters.density[s] * node_volume);
+    }
+    ek_integrate_electrostatics();
+  }
+}
+
+/** Value of a lattice quantity at a node, appended to @p values. */
+void append_node_value(EKField field, int species_index,
+                       Lattice::index_t index, std::vector<double> &values) {
+  switch (field) {
+  case EKField::DENSITY:
+    values.emplace_back(ek_local.rho[species_index][index] /
+                        Utils::int_pow<3>(ek_parameters.agrid));
+    break;
+  case EKField::FLUX: {
+    auto const flux = node_flux(species_index, index);
+    values.insert(values.end(), flux.begin(), flux.end());
+    break;
+  }
+  case EKField::POTENTIAL:
+    values.emplace_back(ek_local.potential[index]);
+    break;
+  case EKField::PARTICLE_POTENTIAL:
+    values.emplace_back(ek_local.particle_potential[index]);
+    break;
+  case EKField::LB_DENSITY: {
+    auto const modes = lb_calc_modes(index, lbfluid);
+    values.emplace_back(lb_calc_density(modes, lbpar) /
+                        Utils::int_pow<3>(lbpar.agrid));
+    break;
+  }
+  case EKField::LB_VELOCITY: {
+    auto const modes = lb_calc_modes(index, lbfluid);
+    auto const density = lb_calc_density(modes, lbpar);
+    auto const velocity =
+        lb_calc_momentum_density(modes, lbfields[index].force_density) /
+        density * (lbpar.agrid / lbpar.tau);
+    values.insert(values.end(), velocity.begin(), velocity.end());
+    break;
+  }
+  }
+}
+
+boost::optional<std::vector<double>>
+mpi_ek_get_node_value(EKField field, int species_index,
+                      Utils::Vector3i const &node) {
+  if (not lblattice.is_local(node)) {
+    return {};
+  }
+  auto const index =
+      get_linear_index(lblattice.local_index(node), lblattice.halo_grid);
+  std::vector<double> values;
+  append_node_value(field, species_index, index, values);
+  return values;
+}
+
+/** Collect a lattice quantity of all nodes on the head node, with x running
+ *  fastest.
+ */
+std::vector<double> mpi_ek_get_field(EKField field, int species_index) {
+  std::vector<double> local_values;
+  std::vector<int> local_indices;
+  auto const &global_grid = lblattice.global_grid;
+  for_each_local_node([&](Lattice::index_t index, Utils::Vector3i const &pos) {
+    auto const global_pos = pos - Utils::Vector3i::broadcast(1) +
+                            lblattice.local_index_offset;
+    local_indices.emplace_back(get_linear_index(global_pos, global_grid));
+    append_node_value(field, species_index, index, local_values);
+  });
+
+  std::vector<std::vector<double>> all_values;
+  std::vector<std::vector<int>> all_indices;
+  boost::mpi::gather(comm_cart, local_values, all_values, 0);
+  boost::mpi::gather(comm_cart, local_indices, all_indices, 0);
+
+  std::vector<double> values;
+  if (this_node == 0) {
+    auto const n_comp = ek_field_size(field);
+    values.resize(static_cast<std::size_t>(Utils::product(global_grid)) *
+                  n_comp);
+    for (std::size_t rank = 0; rank < all_indices.size(); ++rank) {
+      auto const &indices = all_indices[rank];
+      auto const &rank_values = all_values[rank];
+      for (std::size_t i = 0; i < indices.size(); ++i) {
+        std::copy_n(rank_values.begin() + static_cast<long>(i * n_comp),
+                    n_comp,
+                    values.begin() + static_cast<long>(
+                                         static_cast<std::size_t>(indices[i]) *
+                                         n_comp));
+      }
+    }
+  }
+  return values;
+}
+
+void mpi_ek_set_node_density(int species_index, Utils::Vector3i const &node,
+                             double density) {
+  auto &rho = ek_local.rho[species_index];
+  if (lblattice.is_local(node)) {
+    auto const index =
+        get_linear_index(lblattice.local_index(node), lblattice.halo_grid);
+    rho[index] = density * Utils::int_pow<3>(ek_parameters.agrid);
+  }
+  halo_exchange(rho);
+}
+
+double mpi_ek_calculate_net_charge_local() {
+  auto charge = 0.;
+  for_each_local_node([&](Lattice::index_t index, Utils::Vector3i const &) {
+    for (std::size_t s = 0; s < ek_local.rho.size(); s++) {
+      charge += ek_parameters.valency[s] * ek_local.rho[s][index];
+    }
+  });
+  return charge;
+}
+
+int mpi_ek_count_runtime_errors_local() {
+  return check_runtime_errors_local();
+}
+
+unsigned int mpi_ek_calculate_boundary_mass_local() {
+  unsigned int n_boundary_nodes = 0;
+  for_each_local_node([&](Lattice::index_t index, Utils::Vector3i const &) {
+    if (is_boundary(index)) {
+      n_boundary_nodes++;
+    }
+  });
+  return n_boundary_nodes;
+}
+
+} // namespace
+
+REGISTER_CALLBACK(mpi_ek_init_local)
+REGISTER_CALLBACK_ONE_RANK(mpi_ek_get_node_value)
+REGISTER_CALLBACK_MAIN_RANK(mpi_ek_get_field)
+REGISTER_CALLBACK(mpi_ek_set_node_density)
+REGISTER_CALLBACK_REDUCTION(mpi_ek_calculate_net_charge_local, std::plus<>())
+REGISTER_CALLBACK_REDUCTION(mpi_ek_count_runtime_errors_local, std::plus<int>())
+REGISTER_CALLBACK_REDUCTION(mpi_ek_calculate_boundary_mass_local,
+                            std::plus<>())
+
+void ek_integrate() {
+  if (ek_parameters.advection) {
+    update_displacement();
+  }
+
+  /* Integrate diffusion-advection */
+  for (std::size_t s = 0; s < ek_local.rho.size(); s++) {
+    integrate_species(static_cast<int>(s));
+  }
+
+  /* Integrate electrostatics */
+  ek_integrate_electrostatics();
+
+  /* Integrate Navier-Stokes */
+  lb_integrate();
+}
+
+void ek_integrate_electrostatics() {
+  auto &charge = ek_local.charge;
+  std::fill(charge.begin(), charge.end(), 0.);
+  for_each_local_node([&](Lattice::index_t index, Utils::Vector3i const &) {
+    auto node_charge = 0.;
+    for (std::size_t s = 0; s < ek_local.rho.size(); s++) {
+      node_charge += ek_parameters.valency[s] * ek_local.rho[s][index];
+    }
+    charge[index] = node_charge;
+  });
+
+  if (ek_parameters.es_coupling) {
+    /* the particles only feel the field of the species */
+    solve_poisson(charge, ek_local.particle_potential);
+    update_electric_field();
+    add_particle_charges(charge);
+  }
+
+  solve_poisson(charge, ek_local.potential);
+}
+
+void ek_calculate_electrostatic_coupling() {
+  if (!ek_parameters.es_coupling || !ek_initialized) {
+    return;
+  }
+  for (auto &p : cell_structure.local_particles()) {
+    if (p.q() == 0.) {
+      continue;
+    }
+    auto const positions = positions_in_halo(p.pos(), box_geo);
+    if (positions.empty()) {
+      continue;
+    }
+    Utils::Vector3d field{};
+    for_each_interpolation_node(
+        positions.front(), [&field](Lattice::index_t index, double weight) {
+          for (unsigned int i = 0u; i < 3u; i++) {
+            field[i] += weight * ek_local.electric_field[i][index];
+          }
+        });
+    p.force() += p.q() * field;
+  }
+}
+
+/** Lattice spacing of the LB fluid. The EK parameters are stored in single
+ *  precision, hence the spacing is rounded to the nearest divisor of the
+ *  box length, e.g. for <tt>agrid = 1/3</tt>.
+ */
+static double lattice_spacing() {
+  auto const box_l = box_geo.length()[0];
+  return box_l / std::round(box_l / static_cast<double>(ek_parameters.agrid));
+}
+
+int ek_init() {
+  if (ek_parameters.agrid < 0.0 || ek_parameters.viscosity < 0.0 ||
+      ek_parameters.T < 0.0 || ek_parameters.prefactor < 0.0) {
+
+    fprintf(stderr, "ERROR: invalid agrid, viscosity, T or prefactor\n");
+
+    return 1;
+  }
+
+  if (ek_parameters.stencil != 0 ||
+      !ek_parameters.fluidcoupling_ideal_contribution ||
+      ek_parameters.fluctuations) {
+    fprintf(stderr, "ERROR: The CPU implementation of electrokinetics only "
+                    "supports the link-centered stencil with ideal fluid "
+                    "coupling, without fluctuations.\n");
+
+    return 1;
+  }
+
+  if (!ek_initialized) {
+    for (auto &val : ek_parameters.species_index) {
+      val = -1;
+    }
+
+    if (lattice_switch != ActiveLB::NONE) {
+      fprintf(stderr,
+              "ERROR: Electrokinetics automatically initializes the LB on the "
+              "CPU and can therefore not be used in conjunction with LB.\n");
+      fprintf(stderr, "ERROR: Please run either electrokinetics or LB.\n");
+
+      return 1;
+    }
+
+    auto const time_step = get_time_step();
+    auto const agrid = lattice_spacing();
+    lb_lbfluid_set_lattice_switch(ActiveLB::CPU);
+
+    // Convert the parameters (given in MD units) to LB units
+    lbpar.agrid = agrid;
+    lbpar.tau = time_step;
+    lbpar.density = (ek_parameters.lb_density < 0.0)
+                        ? 1.0
+                        : ek_parameters.lb_density * Utils::int_pow<3>(agrid);
+    lbpar.viscosity = ek_parameters.viscosity * time_step / Utils::sqr(agrid);
+    lbpar.bulk_viscosity =
+        ek_parameters.bulk_viscosity * time_step / Utils::sqr(agrid);
+    lbpar.ext_force_density =
+        Utils::Vector3d{{ek_parameters.lb_ext_force_density[0],
+                         ek_parameters.lb_ext_force_density[1],
+                         ek_parameters.lb_ext_force_density[2]}} *
+        Utils::sqr(agrid * time_step);
+    lbpar.is_TRT = true;
+    lbpar.kT = 0.;
+    mpi_bcast_lb_params(LBParam::AGRID);
+    if (mpi_call(Communication::Result::reduction, std::plus<int>(),
+                 mpi_ek_count_runtime_errors_local)) {
+      lb_lbfluid_set_lattice_switch(ActiveLB::NONE);
+      return 1;
+    }
+    lb_lbcoupling_set_gamma(ek_parameters.friction);
+
+    ek_parameters.time_step = static_cast<float>(time_step);
+    ek_parameters.dim_x = static_cast<unsigned>(lblattice.global_grid[0]);
+    ek_parameters.dim_x_padded = (ek_parameters.dim_x / 2 + 1) * 2;
+    ek_parameters.dim_y = static_cast<unsigned>(lblattice.global_grid[1]);
+    ek_parameters.dim_z = static_cast<unsigned>(lblattice.global_grid[2]);
+    ek_parameters.number_of_nodes =
+        ek_parameters.dim_x * ek_parameters.dim_y * ek_parameters.dim_z;
+
+    mpi_call_all(mpi_ek_init_local, false);
+  } else {
+    auto const not_close = [](double a, double b) {
+      return std::abs(a - b) > std::numeric_limits<float>::epsilon();
+    };
+    auto const agrid = lattice_spacing();
+    auto const time_step = static_cast<double>(ek_parameters.time_step);
+    if (not_close(lbpar.agrid, agrid) ||
+        not_close(lbpar.viscosity, ek_parameters.viscosity * time_step /
+                                       Utils::sqr(agrid)) ||
+        not_close(lbpar.bulk_viscosity, ek_parameters.bulk_viscosity *
+                                            time_step / Utils::sqr(agrid)) ||
+        not_close(lb_lbcoupling_get_gamma(), ek_parameters.friction) ||
+        (ek_parameters.lb_density >= 0.0 &&
+         not_close(lbpar.density,
+                   ek_parameters.lb_density * Utils::int_pow<3>(agrid)))) {
+      fprintf(stderr,
+              "ERROR: The LB parameters on the CPU cannot be reinitialized.\n");
+
+      return 1;
+    }
+
+    mpi_call_all(mpi_ek_init_local, true);
+  }
+  return 0;
+}
+
+static void ek_init_species(int species) {
+  if (!ek_initialized) {
+    ek_init();
+  }
+
+  if (ek_parameters.species_index[species] == -1) {
+    auto const index = static_cast<int>(ek_parameters.number_of_species);
+    ek_parameters.species_index[species] = index;
+    ek_parameters.number_of_species++;
+
+    ek_parameters.density[index] = 0.0;
+    ek_parameters.D[index] = 0.0;
+    ek_parameters.valency[index] = 0.0;
+    ek_parameters.ext_force_density[0][index] = 0.0;
+    ek_parameters.ext_force_density[1][index] = 0.0;
+    ek_parameters.ext_force_density[2][index] = 0.0;
+    ek_parameters.d[index] =
+        ek_parameters.D[index] / (1.0f + 2.0f * std::sqrt(2.0f));
+  }
+}
+
+unsigned int ek_calculate_boundary_mass() {
+  return mpi_call(Communication::Result::reduction, std::plus<>(),
+                  mpi_ek_calculate_boundary_mass_local);
+}
+
+static int ek_print_vtk_field(EKField field, int species_index,
+                              char const *name, char *filename) {
+  auto const values = mpi_call(Communication::Result::main_rank,
+                               mpi_ek_get_field, field, species_index);
+
+  FILE *fp = fopen(filename, "w");
+
+  if (fp == nullptr) {
+    return 1;
+  }
+
+  auto const n_comp = ek_field_size(field);
+  fprintf(fp, "\
+# vtk DataFile Version 2.0\n\
+%s\n\
+ASCII\n\
+\n\
+DATASET STRUCTURED_POINTS\n\
+DIMENSIONS %u %u %u\n\
+ORIGIN %f %f %f\n\
+SPACING %f %f %f\n\
+\n\
+POINT_DATA %u\n\
+SCALARS %s float %u\n\
+LOOKUP_TABLE default\n",
+          name, ek_parameters.dim_x, ek_parameters.dim_y, ek_parameters.dim_z,
+          ek_parameters.agrid * 0.5f, ek_parameters.agrid * 0.5f,
+          ek_parameters.agrid * 0.5f, ek_parameters.agrid, ek_parameters.agrid,
+          ek_parameters.agrid, ek_parameters.number_of_nodes, name,
+          static_cast<unsigned>(n_comp));
+
+  for (std::size_t i = 0; i < values.size(); i += n_comp) {
+    if (n_comp == 1) {
+      fprintf(fp, "%e\n", values[i]);
+    } else {
+      fprintf(fp, "%e %e %e\n", values[i], values[i + 1], values[i + 2]);
+    }
+  }
+
+  fclose(fp);
+
+  return 0;
+}
+
+static int ek_print_vtk_unsupported(char const *name) {
+  fprintf(stderr,
+          "ERROR: Writing the %s is not supported by the CPU implementation "
+          "of electrokinetics.\n",
+          name);
+  return 1;
+}
+
+int ek_print_vtk_density(int species, char *filename) {
+  if (ek_parameters.species_index[species] == -1) {
+    return 1;
+  }
+  return ek_print_vtk_field(EKField::DENSITY,
+                            ek_parameters.species_index[species],
+                            "density_1", filename);
+}
+
+int ek_print_vtk_flux(int species, char *filename) {
+  if (ek_parameters.species_index[species] == -1) {
+    return 1;
+  }
+  return ek_print_vtk_field(EKField::FLUX,
+                            ek_parameters.species_index[species], "flux_1",
+                            filename);
+}
+
+int ek_print_vtk_flux_fluc(int, char *) {
+  return ek_print_vtk_unsupported("flux fluctuations");
+}
+
+int ek_print_vtk_flux_link(int, char *) {
+  return ek_print_vtk_unsupported("link fluxes");
+}
+
+int ek_print_vtk_potential(char *filename) {
+  return ek_print_vtk_field(EKField::POTENTIAL, -1, "potential", filename);
+}
+
+int ek_print_vtk_particle_potential(char *filename) {
+  if (!ek_parameters.es_coupling) {
+    return 1;
+  }
+  return ek_print_vtk_field(EKField::PARTICLE_POTENTIAL, -1, "potential",
+                            filename);
+}
+
+int ek_print_vtk_lbforce_density(char *) {
+  return ek_print_vtk_unsupported("LB force density");
+}
+
+int ek_lb_print_vtk_density(char *filename) {
+  return ek_print_vtk_field(EKField::LB_DENSITY, -1, "density_lb", filename);
+}
+
+int ek_lb_print_vtk_velocity(char *filename) {
+  return ek_print_vtk_field(EKField::LB_VELOCITY, -1, "velocity", filename);
+}
+
+int ek_node_get_density(int species, int x, int y, int z, double *density) {
+  if (ek_parameters.species_index[species] == -1) {
+    return 1;
+  }
+  auto const values = mpi_call(
+      Communication::Result::one_rank, mpi_ek_get_node_value, EKField::DENSITY,
+      ek_parameters.species_index[species], Utils::Vector3i{{x, y, z}});
+  *density = values[0];
+  return 0;
+}
+
+int ek_node_get_flux(int species, int x, int y, int z, double *flux) {
+  if (ek_parameters.species_index[species] == -1) {
+    return 1;
+  }
+  auto const values = mpi_call(
+      Communication::Result::one_rank, mpi_ek_get_node_value, EKField::FLUX,
+      ek_parameters.species_index[species], Utils::Vector3i{{x, y, z}});
+  std::copy(values.begin(), values.end(), flux);
+  return 0;
+}
+
+int ek_node_get_potential(int x, int y, int z, double *potential) {
+  auto const values =
+      mpi_call(Communication::Result::one_rank, mpi_ek_get_node_value,
+               EKField::POTENTIAL, -1, Utils::Vector3i{{x, y, z}});
+  *potential = values[0];
+  return 0;
+}
+
+int ek_node_set_density(int species, int x, int y, int z, double density) {
+  if (ek_parameters.species_index[species] == -1) {
+    return 1;
+  }
+  mpi_call_all(mpi_ek_set_node_density, ek_parameters.species_index[species],
+               Utils::Vector3i{{x, y, z}}, density);
+  return 0;
+}
+
+float ek_calculate_net_charge() {
+  return static_cast<float>(mpi_call(Communication::Result::reduction,
+                                     std::plus<>(),
+                                     mpi_ek_calculate_net_charge_local));
+}
+
+int ek_neutralize_system(int species) {
+  int species_index = ek_parameters.species_index[species];
+
+  if (species_index == -1)
+    return 1;
+
+  if (ek_parameters.valency[species_index] == 0.0f)
+    return 2;
+
+  float compensating_species_density = 0.0f;
+
+  for (unsigned i = 0; i < ek_parameters.number_of_species; i++)
+    compensating_species_density +=
+        ek_parameters.density[i] * ek_parameters.valency[i];
+
+  compensating_species_density =
+      ek_parameters.density[species_index] -
+      compensating_species_density / ek_parameters.valency[species_index];
+
+  if (compensating_species_density < 0.0f)
+    return 3;
+
+  ek_parameters.density[species_index] = compensating_species_density;
+
+  return 0;
+}
+
+void ek_print_parameters() {
+
+  printf("ek_parameters {\n");
+
+  printf("  float agrid = %f;\n", ek_parameters.agrid);
+  printf("  float time_step = %f;\n", ek_parameters.time_step);
+  printf("  float lb_density = %f;\n", ek_parameters.lb_density);
+  printf("  unsigned int dim_x = %u;\n", ek_parameters.dim_x);
+  printf("  unsigned int dim_y = %u;\n", ek_parameters.dim_y);
+  printf("  unsigned int dim_z = %u;\n", ek_parameters.dim_z);
+  printf("  unsigned int number_of_nodes = %u;\n",
+         ek_parameters.number_of_nodes);
+  printf("  float viscosity = %f;\n", ek_parameters.viscosity);
+  printf("  float bulk_viscosity = %f;\n", ek_parameters.bulk_viscosity);
+  printf("  float friction = %f;\n", ek_parameters.friction);
+  printf("  float T = %f;\n", ek_parameters.T);
+  printf("  float prefactor = %f;\n", ek_parameters.prefactor);
+  printf("  float lb_ext_force_density[] = {%f, %f, %f};\n",
+         ek_parameters.lb_ext_force_density[0],
+         ek_parameters.lb_ext_force_density[1],
+         ek_parameters.lb_ext_force_density[2]);
+  printf("  unsigned int number_of_species = %u;\n",
+         ek_parameters.number_of_species);
+  printf("  bool advection = %d;\n",
+         static_cast<int>(ek_parameters.advection));
+
+  for (unsigned i = 0; i < ek_parameters.number_of_species; i++) {
+    printf("  species %u: density = %f, D = %f, valency = %f, "
+           "ext_force_density = {%f, %f, %f};\n",
+           i, ek_parameters.density[i], ek_parameters.D[i],
+           ek_parameters.valency[i], ek_parameters.ext_force_density[0][i],
+           ek_parameters.ext_force_density[1][i],
+           ek_parameters.ext_force_density[2][i]);
+  }
+
+  printf("}\n");
+}
+
+void ek_print_lbpar() {
+
+  printf("lbpar {\n");
+
+  printf("    double density = %f;\n", lbpar.density);
+  printf("    double viscosity = %f;\n", lbpar.viscosity);
+  printf("    double bulk_viscosity = %f;\n", lbpar.bulk_viscosity);
+  printf("    double gamma_shear = %f;\n", lbpar.gamma_shear);
+  printf("    double gamma_bulk = %f;\n", lbpar.gamma_bulk);
+  printf("    double gamma_odd = %f;\n", lbpar.gamma_odd);
+  printf("    double gamma_even = %f;\n", lbpar.gamma_even);
+  printf("    double agrid = %f;\n", lbpar.agrid);
+  printf("    double tau = %f;\n", lbpar.tau);
+  printf("    int dim[3] = {%d, %d, %d};\n", lblattice.global_grid[0],
+         lblattice.global_grid[1], lblattice.global_grid[2]);
+  printf("    double ext_force_density[3] = {%f, %f, %f};\n",
+         lbpar.ext_force_density[0], lbpar.ext_force_density[1],
+         lbpar.ext_force_density[2]);
+
+  printf("}\n");
+}
+
+inline void ek_setter_throw_if_initialized() {
+  if (ek_initialized)
+    throw std::runtime_error(
+        "Electrokinetics parameters cannot be set after initialisation");
+}
+
+void ek_set_agrid(float agrid) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.agrid = agrid;
+}
+
+void ek_set_lb_density(float lb_density) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.lb_density = lb_density;
+}
+
+void ek_set_prefactor(float prefactor) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.prefactor = prefactor;
+}
+
+void ek_set_electrostatics_coupling(bool electrostatics_coupling) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.es_coupling = electrostatics_coupling;
+}
+
+void ek_set_viscosity(float viscosity) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.viscosity = viscosity;
+}
+
+void ek_set_lb_ext_force_density(float lb_ext_force_dens_x,
+                                 float lb_ext_force_dens_y,
+                                 float lb_ext_force_dens_z) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.lb_ext_force_density[0] = lb_ext_force_dens_x;
+  ek_parameters.lb_ext_force_density[1] = lb_ext_force_dens_y;
+  ek_parameters.lb_ext_force_density[2] = lb_ext_force_dens_z;
+}
+
+void ek_set_friction(float friction) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.friction = friction;
+}
+
+void ek_set_bulk_viscosity(float bulk_viscosity) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.bulk_viscosity = bulk_viscosity;
+}
+
+void ek_set_gamma_odd(float gamma_odd) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.gamma_odd = gamma_odd;
+}
+
+void ek_set_gamma_even(float gamma_even) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.gamma_even = gamma_even;
+}
+
+void ek_set_stencil(int stencil) {
+  ek_setter_throw_if_initialized();
+  if (!ek_parameters.fluidcoupling_ideal_contribution)
+    throw std::runtime_error(
+        "Combination of stencil and fluid coupling not implemented.");
+  ek_parameters.stencil = stencil;
+}
+
+void ek_set_advection(bool advection) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.advection = advection;
+}
+
+void ek_set_fluctuations(bool fluctuations) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.fluctuations = fluctuations;
+}
+
+void ek_set_fluctuation_amplitude(float fluctuation_amplitude) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.fluctuation_amplitude = fluctuation_amplitude;
+}
+
+void ek_set_fluidcoupling(bool ideal_contribution) {
+  ek_setter_throw_if_initialized();
+  if (ek_parameters.stencil != 0)
+    throw std::runtime_error(
+        "Combination of stencil and fluid coupling not implemented.");
+  ek_parameters.fluidcoupling_ideal_contribution = ideal_contribution;
+}
+
+void ek_set_T(float T) {
+  ek_setter_throw_if_initialized();
+  ek_parameters.T = T;
+}
+
+void ek_set_density(int species, float density) {
+  ek_init_species(species);
+  ek_parameters.density[ek_parameters.species_index[species]] = density;
+}
+
+void ek_set_D(int species, float D) {
+  ek_init_species(species);
+  ek_parameters.D[ek_parameters.species_index[species]] = D;
+  ek_parameters.d[ek_parameters.species_index[species]] =
+      D / (1.0f + 2.0f * std::sqrt(2.0f));
+}
+
+void ek_set_valency(int species, float valency) {
+  ek_init_species(species);
+  ek_parameters.valency[ek_parameters.species_index[species]] = valency;
+}
+
+void ek_set_ext_force_density(int species, float ext_force_density_x,
+                              float ext_force_density_y,
+                              float ext_force_density_z) {
+  ek_init_species(species);
+  ek_parameters.ext_force_density[0][ek_parameters.species_index[species]] =
+      ext_force_density_x;
+  ek_parameters.ext_force_density[1][ek_parameters.species_index[species]] =
+      ext_force_density_y;
+  ek_parameters.ext_force_density[2][ek_parameters.species_index[species]] =
+      ext_force_density_z;
+}
+
+/* The CPU implementation is deterministic. */
+void ek_set_rng_state(uint64_t) {}
+
+#endif /* ELECTROKINETICS && !CUDA */
@@ -26,7 +26,9 @@
 // note that we need to declare the ek_parameters struct and instantiate it for
 // LB_GPU to compile when electrokinetics is not compiled in. This seemed more
 // elegant than ifdeffing multiple versions of the kernel integrate.
-#ifdef CUDA
+// Without CUDA, the struct holds the parameters of the CPU implementation
+// and the device pointers are unused.
+#if defined(CUDA) || defined(ELECTROKINETICS)
 
 #define MAX_NUMBER_OF_SPECIES 10
 
@@ -187,6 +189,6 @@ void ek_init_species_density_wallcharge(float *wallcharge_species_density,
                                         int wallcharge_species);
 #endif
 
-#endif /* CUDA */
+#endif /* ELECTROKINETICS */
 
 #endif /* CORE_GRID_BASED_ALGORITHMS_ELECTROKINETICS_HPP */
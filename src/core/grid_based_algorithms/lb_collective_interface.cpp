@@ -21,6 +21,7 @@
 #include "communication.hpp"
 #include "config/config.hpp"
 #include "grid.hpp"
+#include "lb-d3q19.hpp"
 #include "lb.hpp"
 #include "lb_constants.hpp"
 #include "lb_interpolation.hpp"
@@ -28,7 +29,19 @@
 #include <utils/Vector.hpp>
 #include <utils/index.hpp>
 
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/collectives/gather.hpp>
 #include <boost/optional.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
 
 using Utils::get_linear_index;
 
@@ -163,6 +176,218 @@ auto mpi_lb_get_pressure_tensor(Utils::Vector3i const &index) {
 
 REGISTER_CALLBACK_ONE_RANK(mpi_lb_get_pressure_tensor)
 
+namespace detail {
+/** @brief Number of components per node of a lattice plane field. */
+std::size_t lb_plane_field_size(LBPlaneField field) {
+  switch (field) {
+  case LBPlaneField::POPULATIONS:
+    return D3Q19::n_vel;
+  case LBPlaneField::VELOCITY:
+    return 3ul;
+  case LBPlaneField::BOUNDARY:
+    return 1ul;
+  }
+  return 0ul;
+}
+
+/** @brief In-plane axes of a lattice plane normal to @p axis. */
+std::array<int, 2> lb_plane_axes(int axis) {
+  return {{(axis == 0) ? 1 : 0, (axis == 2) ? 1 : 2}};
+}
+
+/**
+ * @brief Visit the local lattice nodes of a plane.
+ * The kernel is called with the linear index of the node and its position
+ * in the global plane, the second in-plane axis running fastest.
+ */
+template <typename Kernel>
+void lb_plane_for_each(int axis, int slice, Kernel kernel) {
+  auto const offset = lblattice.local_index_offset;
+  auto const grid = lblattice.grid;
+  if (slice < offset[axis] or slice >= offset[axis] + grid[axis]) {
+    return;
+  }
+  auto const axes = lb_plane_axes(axis);
+  auto const n_v = lblattice.global_grid[axes[1]];
+  Utils::Vector3i index{};
+  index[axis] = slice;
+  for (int u = 0; u < grid[axes[0]]; ++u) {
+    index[axes[0]] = offset[axes[0]] + u;
+    for (int v = 0; v < grid[axes[1]]; ++v) {
+      index[axes[1]] = offset[axes[1]] + v;
+      auto const linear_index =
+          get_linear_index(lblattice.local_index(index), lblattice.halo_grid);
+      auto const plane_index = static_cast<std::size_t>(index[axes[0]]) *
+                                   static_cast<std::size_t>(n_v) +
+                               static_cast<std::size_t>(index[axes[1]]);
+      kernel(linear_index, plane_index);
+    }
+  }
+}
+} // namespace detail
+
+std::vector<double> mpi_lb_get_plane(LBPlaneField field, int axis,
+                                     int slice) {
+  auto const n_comp = detail::lb_plane_field_size(field);
+  std::vector<double> local_values;
+  std::vector<std::size_t> local_indices;
+  detail::lb_plane_for_each(axis, slice, [&](auto index, auto plane_index) {
+    local_indices.emplace_back(plane_index);
+    switch (field) {
+    case LBPlaneField::POPULATIONS: {
+      auto const pop = lb_get_population(index);
+      local_values.insert(local_values.end(), pop.begin(), pop.end());
+      break;
+    }
+    case LBPlaneField::VELOCITY: {
+      auto const modes = lb_calc_modes(index, lbfluid);
+      auto const density = lb_calc_density(modes, lbpar);
+      auto const momentum_density =
+          lb_calc_momentum_density(modes, lbfields[index].force_density);
+      auto const velocity = momentum_density / density;
+      local_values.insert(local_values.end(), velocity.begin(),
+                          velocity.end());
+      break;
+    }
+    case LBPlaneField::BOUNDARY:
+#ifdef LB_BOUNDARIES
+      local_values.emplace_back(lbfields[index].boundary);
+#else
+      local_values.emplace_back(0.);
+#endif
+      break;
+    }
+  });
+
+  std::vector<std::vector<double>> all_values;
+  std::vector<std::vector<std::size_t>> all_indices;
+  boost::mpi::gather(comm_cart, local_values, all_values, 0);
+  boost::mpi::gather(comm_cart, local_indices, all_indices, 0);
+
+  std::vector<double> plane;
+  if (this_node == 0) {
+    auto const axes = detail::lb_plane_axes(axis);
+    auto const &global_grid = lblattice.global_grid;
+    plane.resize(static_cast<std::size_t>(global_grid[axes[0]]) *
+                 static_cast<std::size_t>(global_grid[axes[1]]) * n_comp);
+    for (std::size_t rank = 0; rank < all_indices.size(); ++rank) {
+      auto const &indices = all_indices[rank];
+      auto const &values = all_values[rank];
+      for (std::size_t i = 0; i < indices.size(); ++i) {
+        std::copy_n(values.begin() + static_cast<long>(i * n_comp), n_comp,
+                    plane.begin() + static_cast<long>(indices[i] * n_comp));
+      }
+    }
+  }
+  return plane;
+}
+
+REGISTER_CALLBACK_MAIN_RANK(mpi_lb_get_plane)
+
+void mpi_lb_set_populations_plane(int axis, int slice,
+                                  std::vector<double> const &plane) {
+  detail::lb_plane_for_each(axis, slice, [&](auto index, auto plane_index) {
+    Utils::Vector19d pop;
+    std::copy_n(plane.begin() + static_cast<long>(plane_index * pop.size()),
+                pop.size(), pop.begin());
+    lb_set_population(index, pop);
+  });
+}
+
+REGISTER_CALLBACK(mpi_lb_set_populations_plane)
+
+namespace detail {
+/**
+ * @brief Collectively access the populations in a binary file with MPI-IO.
+ * The populations are stored in row-major order of the global lattice
+ * (x slowest, populations fastest) after a header of @p header_size bytes.
+ * Each rank accesses its local subdomain through a subarray file view.
+ */
+bool lb_access_populations(std::string const &filename, long header_size,
+                           bool write) {
+  auto const n_vel = static_cast<int>(D3Q19::n_vel);
+  auto const &grid = lblattice.grid;
+  auto const &offset = lblattice.local_index_offset;
+  auto const &global_grid = lblattice.global_grid;
+  int const sizes[4] = {global_grid[0], global_grid[1], global_grid[2], n_vel};
+  int const subsizes[4] = {grid[0], grid[1], grid[2], n_vel};
+  int const starts[4] = {offset[0], offset[1], offset[2], 0};
+
+  std::vector<double> buffer(static_cast<std::size_t>(Utils::product(grid)) *
+                             D3Q19::n_vel);
+  auto const for_each_local_node = [&](auto const &kernel) {
+    std::size_t i = 0;
+    Utils::Vector3i index;
+    for (index[0] = 0; index[0] < grid[0]; ++index[0]) {
+      for (index[1] = 0; index[1] < grid[1]; ++index[1]) {
+        for (index[2] = 0; index[2] < grid[2]; ++index[2]) {
+          auto const linear_index = get_linear_index(
+              index + Utils::Vector3i::broadcast(lblattice.halo_size),
+              lblattice.halo_grid);
+          kernel(linear_index, buffer.begin() + static_cast<long>(i));
+          i += D3Q19::n_vel;
+        }
+      }
+    }
+  };
+
+  if (write) {
+    for_each_local_node([](auto index, auto it) {
+      auto const pop = lb_get_population(index);
+      std::copy(pop.begin(), pop.end(), it);
+    });
+  }
+
+  MPI_Datatype filetype;
+  MPI_Type_create_subarray(4, sizes, subsizes, starts, MPI_ORDER_C,
+                           MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+
+  MPI_File f;
+  auto const mode = write ? MPI_MODE_WRONLY : MPI_MODE_RDONLY;
+  auto ret = MPI_File_open(comm_cart, const_cast<char *>(filename.c_str()),
+                           mode, MPI_INFO_NULL, &f);
+  if (ret == MPI_SUCCESS) {
+    ret = MPI_File_set_view(f, static_cast<MPI_Offset>(header_size),
+                            MPI_DOUBLE, filetype, const_cast<char *>("native"),
+                            MPI_INFO_NULL);
+    auto const count = static_cast<int>(buffer.size());
+    if (write) {
+      ret |= MPI_File_write_all(f, buffer.data(), count, MPI_DOUBLE,
+                                MPI_STATUS_IGNORE);
+    } else {
+      ret |= MPI_File_read_all(f, buffer.data(), count, MPI_DOUBLE,
+                               MPI_STATUS_IGNORE);
+    }
+    MPI_File_close(&f);
+  }
+  MPI_Type_free(&filetype);
+
+  auto const success = boost::mpi::all_reduce(
+      comm_cart, ret == MPI_SUCCESS, std::logical_and<bool>());
+  if (success and not write) {
+    for_each_local_node([](auto index, auto it) {
+      Utils::Vector19d pop;
+      std::copy_n(it, pop.size(), pop.begin());
+      lb_set_population(index, pop);
+    });
+  }
+  return success;
+}
+} // namespace detail
+
+bool mpi_lb_write_populations(std::string const &filename, long header_size) {
+  return detail::lb_access_populations(filename, header_size, true);
+}
+
+REGISTER_CALLBACK_MAIN_RANK(mpi_lb_write_populations)
+
+bool mpi_lb_read_populations(std::string const &filename, long header_size) {
+  return detail::lb_access_populations(filename, header_size, false);
+}
+
+REGISTER_CALLBACK_MAIN_RANK(mpi_lb_read_populations)
+
 void mpi_bcast_lb_params_local(LBParam field, LB_Parameters const &params) {
   lbpar = params;
   lb_on_param_change(field);
@@ -24,6 +24,9 @@
 #include <boost/optional.hpp>
 #include <utils/Vector.hpp>
 
+#include <string>
+#include <vector>
+
 /* collective getter functions */
 boost::optional<Utils::Vector3d>
 mpi_lb_get_interpolated_velocity(Utils::Vector3d const &pos);
@@ -38,6 +41,15 @@ mpi_lb_get_momentum_density(Utils::Vector3i const &index);
 boost::optional<Utils::Vector6d>
 mpi_lb_get_pressure_tensor(Utils::Vector3i const &index);
 
+/* collective plane-wise functions */
+std::vector<double> mpi_lb_get_plane(LBPlaneField field, int axis, int slice);
+void mpi_lb_set_populations_plane(int axis, int slice,
+                                  std::vector<double> const &plane);
+
+/* collective MPI-IO functions */
+bool mpi_lb_write_populations(std::string const &filename, long header_size);
+bool mpi_lb_read_populations(std::string const &filename, long header_size);
+
 /* collective setter functions */
 void mpi_lb_set_population(Utils::Vector3i const &index,
                            Utils::Vector19d const &population);
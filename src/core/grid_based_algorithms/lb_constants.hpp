@@ -40,4 +40,11 @@ enum class LBParam {
   TAU                /**< LB time step */
 };
 
+/** @brief Node fields that can be gathered one lattice plane at a time. */
+enum class LBPlaneField {
+  POPULATIONS, /**< populations (19 components) */
+  VELOCITY,    /**< fluid velocity (3 components) */
+  BOUNDARY     /**< boundary flag (1 component) */
+};
+
 #endif /* LB_CONSTANTS_HPP */
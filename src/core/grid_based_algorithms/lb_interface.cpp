@@ -35,7 +35,10 @@
 
 #include <utils/Vector.hpp>
 
+#include <boost/serialization/vector.hpp>
+
 #include <cmath>
+#include <cstddef>
 #include <fstream>
 #include <limits>
 #include <sstream>
@@ -52,9 +55,50 @@ struct NoLBActive : public std::exception {
   const char *what() const noexcept override { return "LB not activated"; }
 };
 
+/**
+ * @brief Node accessor for the CPU fluid on the head node.
+ * Nodes are gathered collectively one lattice plane normal to @c axis
+ * at a time; the last plane is cached, such that loops with the normal
+ * axis outermost only trigger one collective call per plane.
+ */
+class LBPlaneCache {
+  LBPlaneField m_field;
+  int m_axis;
+  int m_slice = -1;
+  int m_stride;
+  std::vector<double> m_plane;
+
+public:
+  LBPlaneCache(LBPlaneField field, int axis) : m_field(field), m_axis(axis) {
+    auto const grid_size = lb_lbfluid_get_shape();
+    m_stride = grid_size[(axis == 2) ? 1 : 2];
+  }
+
+  template <std::size_t N> Utils::Vector<double, N> get(Utils::Vector3i pos) {
+    if (pos[m_axis] != m_slice) {
+      m_slice = pos[m_axis];
+      m_plane = mpi_call(::Communication::Result::main_rank, mpi_lb_get_plane,
+                         m_field, m_axis, m_slice);
+    }
+    auto const u = pos[(m_axis == 0) ? 1 : 0];
+    auto const v = pos[(m_axis == 2) ? 1 : 2];
+    auto const offset = static_cast<std::size_t>(u * m_stride + v) * N;
+    auto const it = m_plane.begin() + static_cast<long>(offset);
+    return Utils::Vector<double, N>(it, it + N);
+  }
+};
+
 void lb_lbfluid_integrate() {
   if (lattice_switch == ActiveLB::CPU) {
-    lb_integrate();
+#if defined(ELECTROKINETICS) && !defined(CUDA)
+    if (ek_initialized) {
+      ek_integrate();
+    } else {
+#endif
+      lb_integrate();
+#if defined(ELECTROKINETICS) && !defined(CUDA)
+    }
+#endif
   } else if (lattice_switch == ActiveLB::GPU and this_node == 0) {
 #ifdef CUDA
 #ifdef ELECTROKINETICS
@@ -511,11 +555,12 @@ void lb_lbfluid_print_vtk_boundary(const std::string &filename) {
   } else {
     vtk_writer("lbboundaries", [&]() {
       auto const grid_size = lb_lbfluid_get_shape();
+      LBPlaneCache boundaries(LBPlaneField::BOUNDARY, 2);
       Utils::Vector3i pos;
       for (pos[2] = 0; pos[2] < grid_size[2]; pos[2]++)
         for (pos[1] = 0; pos[1] < grid_size[1]; pos[1]++)
           for (pos[0] = 0; pos[0] < grid_size[0]; pos[0]++)
-            cpfile << lb_lbnode_get_boundary(pos) << "\n";
+            cpfile << static_cast<int>(boundaries.get<1>(pos)[0]) << "\n";
     });
   }
   cpfile.close();
@@ -590,7 +635,10 @@ void lb_lbfluid_print_vtk_velocity(const std::string &filename,
     });
 #endif //  CUDA
   } else {
-    vtk_writer("lbfluid_cpu", lb_lbnode_get_velocity);
+    LBPlaneCache velocities(LBPlaneField::VELOCITY, 2);
+    vtk_writer("lbfluid_cpu", [&velocities](Utils::Vector3i const &pos) {
+      return velocities.get<3>(pos);
+    });
   }
   cpfile.close();
 }
@@ -627,11 +675,12 @@ void lb_lbfluid_print_boundary(const std::string &filename) {
     auto const shift = Vector3d{{0.5, 0.5, 0.5}};
     auto const agrid = lb_lbfluid_get_agrid();
     auto const grid_size = lb_lbfluid_get_shape();
+    LBPlaneCache boundaries(LBPlaneField::BOUNDARY, 2);
     Utils::Vector3i pos;
     for (pos[2] = 0; pos[2] < grid_size[2]; pos[2]++)
       for (pos[1] = 0; pos[1] < grid_size[1]; pos[1]++)
         for (pos[0] = 0; pos[0] < grid_size[0]; pos[0]++) {
-          auto const flag = (lb_lbnode_get_boundary(pos) != 0) ? 1 : 0;
+          auto const flag = (boundaries.get<1>(pos)[0] != 0.) ? 1 : 0;
           cpfile << vtk_format << (pos + shift) * agrid << " " << flag << "\n";
         }
   }
@@ -674,12 +723,13 @@ void lb_lbfluid_print_velocity(const std::string &filename) {
     auto const agrid = lb_lbfluid_get_agrid();
     auto const grid_size = lb_lbfluid_get_shape();
     auto const lattice_speed = lb_lbfluid_get_lattice_speed();
+    LBPlaneCache velocities(LBPlaneField::VELOCITY, 2);
     Utils::Vector3i pos;
     for (pos[2] = 0; pos[2] < grid_size[2]; pos[2]++)
       for (pos[1] = 0; pos[1] < grid_size[1]; pos[1]++)
         for (pos[0] = 0; pos[0] < grid_size[0]; pos[0]++)
           cpfile << vtk_format << (pos + shift) * agrid << " " << vtk_format
-                 << lb_lbnode_get_velocity(pos) * lattice_speed << "\n";
+                 << velocities.get<3>(pos) * lattice_speed << "\n";
   }
 
   cpfile.close();
@@ -782,13 +832,24 @@ void lb_lbfluid_save_checkpoint(const std::string &filename, bool binary) {
       auto const grid_size = lb_lbfluid_get_shape();
       cpfile.write(grid_size);
 
+      if (binary) {
+        // each rank writes its own subdomain behind the header
+        auto const header_size = static_cast<long>(cpfile.stream.tellp());
+        cpfile.stream.close();
+        if (not mpi_call(::Communication::Result::main_rank,
+                         mpi_lb_write_populations, filename, header_size)) {
+          throw std::runtime_error(err_msg + "could not write data to " +
+                                   filename);
+        }
+        return;
+      }
+
+      LBPlaneCache populations(LBPlaneField::POPULATIONS, 0);
       for (int i = 0; i < grid_size[0]; i++) {
         for (int j = 0; j < grid_size[1]; j++) {
           for (int k = 0; k < grid_size[2]; k++) {
             auto const ind = Utils::Vector3i{{i, j, k}};
-            auto const pop = mpi_call(::Communication::Result::one_rank,
-                                      mpi_lb_get_populations, ind);
-            cpfile.write(pop);
+            cpfile.write(populations.get<D3Q19::n_vel>(ind));
           }
         }
       }
@@ -841,15 +902,37 @@ void lb_lbfluid_load_checkpoint(const std::string &filename, bool binary) {
       mpi_bcast_lb_params(LBParam::DENSITY);
       check_header(gridsize);
 
-      Utils::Vector19d pop;
-      for (int i = 0; i < gridsize[0]; i++) {
-        for (int j = 0; j < gridsize[1]; j++) {
-          for (int k = 0; k < gridsize[2]; k++) {
-            auto const ind = Utils::Vector3i{{i, j, k}};
-            cpfile.read(pop);
-            lb_lbnode_set_pop(ind, pop);
-          }
+      if (binary) {
+        // check the file size before each rank reads its own subdomain
+        auto const header_size = static_cast<long>(cpfile.stream.tellg());
+        cpfile.stream.seekg(0, std::ios_base::end);
+        auto const data_size = static_cast<long>(cpfile.stream.tellg()) -
+                               header_size;
+        cpfile.stream.close();
+        auto const expected_size =
+            static_cast<long>(Utils::product(gridsize)) *
+            static_cast<long>(D3Q19::n_vel * sizeof(double));
+        if (data_size < expected_size) {
+          throw std::runtime_error(err_msg + "EOF found.");
+        }
+        if (data_size > expected_size) {
+          throw std::runtime_error(err_msg + "extra data found, expected EOF.");
+        }
+        if (not mpi_call(::Communication::Result::main_rank,
+                         mpi_lb_read_populations, filename, header_size)) {
+          throw std::runtime_error(err_msg + "could not read data from " +
+                                   filename);
         }
+        return;
+      }
+
+      auto const plane_size = static_cast<std::size_t>(gridsize[1]) *
+                              static_cast<std::size_t>(gridsize[2]) *
+                              D3Q19::n_vel;
+      std::vector<double> plane(plane_size);
+      for (int i = 0; i < gridsize[0]; i++) {
+        cpfile.read(plane);
+        mpi_call_all(mpi_lb_set_populations_plane, 0, i, plane);
       }
     } else {
       throw std::runtime_error(
@@ -1137,14 +1220,13 @@ lb_lbfluid_get_interpolated_velocity(const Utils::Vector3d &pos) {
 #endif
   }
   if (lattice_switch == ActiveLB::CPU) {
-    switch (interpolation_order) {
-    case (InterpolationOrder::quadratic):
-      throw std::runtime_error("The non-linear interpolation scheme is not "
-                               "implemented for the CPU LB.");
-    case (InterpolationOrder::linear):
-      return mpi_call(::Communication::Result::one_rank,
-                      mpi_lb_get_interpolated_velocity, folded_pos);
+    if (interpolation_order == InterpolationOrder::quadratic and
+        n_nodes > 1) {
+      throw std::runtime_error("The non-linear interpolation scheme is only "
+                               "implemented for the CPU LB on one MPI rank.");
     }
+    return mpi_call(::Communication::Result::one_rank,
+                    mpi_lb_get_interpolated_velocity, folded_pos);
   }
   throw NoLBActive();
 }
@@ -1157,14 +1239,13 @@ double lb_lbfluid_get_interpolated_density(const Utils::Vector3d &pos) {
         "Density interpolation is not implemented for the GPU LB.");
   }
   if (lattice_switch == ActiveLB::CPU) {
-    switch (interpolation_order) {
-    case (InterpolationOrder::quadratic):
-      throw std::runtime_error("The non-linear interpolation scheme is not "
-                               "implemented for the CPU LB.");
-    case (InterpolationOrder::linear):
-      return mpi_call(::Communication::Result::one_rank,
-                      mpi_lb_get_interpolated_density, folded_pos);
+    if (interpolation_order == InterpolationOrder::quadratic and
+        n_nodes > 1) {
+      throw std::runtime_error("The non-linear interpolation scheme is only "
+                               "implemented for the CPU LB on one MPI rank.");
     }
+    return mpi_call(::Communication::Result::one_rank,
+                    mpi_lb_get_interpolated_density, folded_pos);
   }
   throw NoLBActive();
 }
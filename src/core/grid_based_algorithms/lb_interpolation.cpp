@@ -25,10 +25,13 @@
 #include "lb.hpp"
 
 #include <utils/Vector.hpp>
+#include <utils/index.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 
 namespace {
 InterpolationOrder interpolation_order = InterpolationOrder::linear;
@@ -51,8 +54,8 @@ InterpolationOrder lb_lbinterpolation_get_interpolation_order() {
 
 namespace {
 template <typename Op>
-void lattice_interpolation(Lattice const &lattice, Utils::Vector3d const &pos,
-                           Op &&op) {
+void lattice_interpolation_linear(Lattice const &lattice,
+                                  Utils::Vector3d const &pos, Op &&op) {
   Utils::Vector<std::size_t, 8> node_index{};
   Utils::Vector6d delta{};
 
@@ -71,6 +74,77 @@ void lattice_interpolation(Lattice const &lattice, Utils::Vector3d const &pos,
   }
 }
 
+/** Interpolation kernel of the 3-point scheme, see @cite dunweg09a.
+ *  @param u Distance to the grid point in units of agrid
+ */
+double three_point_polynomial(double u) {
+  auto const abs_u = std::fabs(u);
+  if (abs_u <= 0.5) {
+    return (1. + std::sqrt(1. - 3. * u * u)) / 3.;
+  }
+  return (5. - 3. * abs_u - std::sqrt(-2. + 6. * abs_u - 3. * u * u)) / 6.;
+}
+
+/**
+ * @brief Quadratic interpolation on the 27 nodes closest to @p pos.
+ * The stencil wraps around the periodic box, which requires the local
+ * lattice to span the whole box, i.e. a single MPI rank.
+ */
+template <typename Op>
+void lattice_interpolation_quadratic(Lattice const &lattice,
+                                     Utils::Vector3d const &pos, Op &&op) {
+  if (Utils::product(lattice.node_grid) != 1) {
+    throw std::runtime_error("The non-linear interpolation scheme is only "
+                             "implemented for the CPU LB on one MPI rank.");
+  }
+  Utils::Vector3i center{};
+  Utils::Vector<Utils::Vector3d, 3> weights{};
+  for (int dir = 0; dir < 3; dir++) {
+    auto const left = lattice.my_right[dir] - lattice.local_box[dir];
+    auto const lpos = pos[dir] - left;
+    auto const rel = lpos / lattice.agrid + lattice.offset - lattice.halo_size;
+    auto const node = std::floor(rel + 0.5);
+    if (not(node >= -1. and node <= lattice.grid[dir])) {
+      throw std::runtime_error("position outside local LB domain");
+    }
+    auto const dist = rel - node;
+    center[dir] = static_cast<int>(node);
+    weights[dir] = {three_point_polynomial(dist + 1.),
+                    three_point_polynomial(dist),
+                    three_point_polynomial(dist - 1.)};
+  }
+  auto const fold = [&lattice](int ind, int dir) {
+    auto const dim = lattice.grid[dir];
+    return (ind + dim) % dim + lattice.halo_size;
+  };
+  for (int z = 0; z < 3; z++) {
+    for (int y = 0; y < 3; y++) {
+      for (int x = 0; x < 3; x++) {
+        auto const node = Utils::Vector3i{{fold(center[0] + x - 1, 0),
+                                           fold(center[1] + y - 1, 1),
+                                           fold(center[2] + z - 1, 2)}};
+        auto const index = Utils::get_linear_index(node, lattice.halo_grid);
+        auto const w = weights[0][x] * weights[1][y] * weights[2][z];
+
+        op(static_cast<Lattice::index_t>(index), w);
+      }
+    }
+  }
+}
+
+template <typename Op>
+void lattice_interpolation(Lattice const &lattice, Utils::Vector3d const &pos,
+                           Op &&op) {
+  switch (interpolation_order) {
+  case (InterpolationOrder::quadratic):
+    lattice_interpolation_quadratic(lattice, pos, std::forward<Op>(op));
+    break;
+  case (InterpolationOrder::linear):
+    lattice_interpolation_linear(lattice, pos, std::forward<Op>(op));
+    break;
+  }
+}
+
 Utils::Vector3d node_u(Lattice::index_t index) {
 #ifdef LB_BOUNDARIES
   if (lbfields[index].boundary) {
@@ -99,7 +173,7 @@ lb_lbinterpolation_get_interpolated_velocity(const Utils::Vector3d &pos) {
   Utils::Vector3d interpolated_u{};
 
   /* Calculate fluid velocity at particle's position.
-     This is done by linear interpolation (eq. (11) @cite ahlrichs99a) */
+     This is done by interpolation (eq. (11) @cite ahlrichs99a) */
   lattice_interpolation(lblattice, pos,
                         [&interpolated_u](Lattice::index_t index, double w) {
                           interpolated_u += w * node_u(index);
@@ -112,7 +186,7 @@ double lb_lbinterpolation_get_interpolated_density(const Utils::Vector3d &pos) {
   double interpolated_dens = 0.;
 
   /* Calculate fluid density at the position.
-     This is done by linear interpolation (eq. (11) @cite ahlrichs99a) */
+     This is done by interpolation (eq. (11) @cite ahlrichs99a) */
   lattice_interpolation(lblattice, pos,
                         [&interpolated_dens](Lattice::index_t index, double w) {
                           interpolated_dens += w * node_dens(index);
@@ -123,16 +197,9 @@ double lb_lbinterpolation_get_interpolated_density(const Utils::Vector3d &pos) {
 
 void lb_lbinterpolation_add_force_density(
     const Utils::Vector3d &pos, const Utils::Vector3d &force_density) {
-  switch (interpolation_order) {
-  case (InterpolationOrder::quadratic):
-    throw std::runtime_error("The non-linear interpolation scheme is not "
-                             "implemented for the CPU LB.");
-  case (InterpolationOrder::linear):
-    lattice_interpolation(lblattice, pos,
-                          [&force_density](Lattice::index_t index, double w) {
-                            auto &field = lbfields[index];
-                            field.force_density += w * force_density;
-                          });
-    break;
-  }
+  lattice_interpolation(lblattice, pos,
+                        [&force_density](Lattice::index_t index, double w) {
+                          auto &field = lbfields[index];
+                          field.force_density += w * force_density;
+                        });
 }
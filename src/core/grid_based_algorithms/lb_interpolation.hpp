@@ -23,7 +23,8 @@
 
 /**
  * @brief Interpolation order for the LB fluid interpolation.
- * @note For the CPU LB only linear interpolation is available.
+ * @note For the CPU LB, quadratic interpolation is only available
+ * on a single MPI rank.
  */
 enum class InterpolationOrder { linear, quadratic };
 
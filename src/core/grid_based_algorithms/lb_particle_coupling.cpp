@@ -35,6 +35,7 @@
 #include <utils/Counter.hpp>
 #include <utils/Vector.hpp>
 
+#include <boost/container/static_vector.hpp>
 #include <boost/mpi.hpp>
 
 #include <algorithm>
@@ -197,26 +198,48 @@ bool in_local_halo(Utils::Vector3d const &pos) {
   return in_local_domain(pos, halo);
 }
 
-/** @brief Return a vector of positions shifted by +,- box length in each
- ** coordinate */
-std::vector<Utils::Vector3d> positions_in_halo(Utils::Vector3d pos,
-                                               const BoxGeometry &box) {
-  std::vector<Utils::Vector3d> res;
-  for (int i : {-1, 0, 1}) {
-    for (int j : {-1, 0, 1}) {
-      for (int k : {-1, 0, 1}) {
-        Utils::Vector3d shift{{double(i), double(j), double(k)}};
-        Utils::Vector3d pos_shifted =
-            pos + Utils::hadamard_product(box.length(), shift);
-        if (in_local_halo(pos_shifted)) {
-          res.push_back(pos_shifted);
-        }
+/** @brief Return the positions shifted by +,- box length in each
+ ** coordinate that lie in the local LB domain plus halo */
+HaloPositions positions_in_halo(Utils::Vector3d const &pos,
+                                const BoxGeometry &box) {
+  auto const halo = Utils::Vector3d::broadcast(0.5 * lb_lbfluid_get_agrid());
+  auto const lower = local_geo.my_left() - halo;
+  auto const upper = local_geo.my_right() + halo;
+
+  /* the halo test factorizes over the Cartesian directions, hence only
+     the shifted coordinates have to be tested, not the 27 images */
+  Utils::Vector<boost::container::static_vector<double, 3>, 3> coords;
+  for (int dir = 0; dir < 3; dir++) {
+    for (int i : {-1, 0, 1}) {
+      auto const x = pos[dir] + i * box.length()[dir];
+      if (x >= lower[dir] and x < upper[dir]) {
+        coords[dir].push_back(x);
+      }
+    }
+  }
+
+  HaloPositions res;
+  for (auto const x : coords[0]) {
+    for (auto const y : coords[1]) {
+      for (auto const z : coords[2]) {
+        res.push_back({x, y, z});
       }
     }
   }
   return res;
 }
 
+/** @brief Return the positions at which a particle couples to the fluid.
+ ** The quadratic stencil wraps around the periodic box (single MPI rank
+ ** only), hence the particle couples once at its folded position. */
+static HaloPositions coupling_positions(Utils::Vector3d const &pos) {
+  if (lb_lbinterpolation_get_interpolation_order() ==
+      InterpolationOrder::quadratic) {
+    return {folded_position(pos, box_geo)};
+  }
+  return positions_in_halo(pos, box_geo);
+}
+
 /** @brief Return if locally there exists a physical particle
  ** for a given (ghost) particle */
 bool is_ghost_for_local_particle(const Particle &p) {
@@ -255,7 +278,7 @@ void add_swimmer_force(Particle const &p, double time_step) {
 
     // couple positions including shifts by one box length to add forces
     // to ghost layers
-    for (auto pos : positions_in_halo(source_position, box_geo)) {
+    for (auto const &pos : coupling_positions(source_position)) {
       add_md_force(pos, force, time_step);
     }
   }
@@ -293,47 +316,45 @@ void lb_lbcoupling_calc_particle_lattice_ia(bool couple_virtual,
                                    "if using more than one MPI node");
         }
       }
-      switch (lb_lbinterpolation_get_interpolation_order()) {
-      case (InterpolationOrder::quadratic):
-        throw std::runtime_error("The non-linear interpolation scheme is not "
-                                 "implemented for the CPU LB.");
-      case (InterpolationOrder::linear): {
-        auto const kT = lb_lbfluid_get_kT();
-        /* Eq. (16) @cite ahlrichs99a.
-         * The factor 12 comes from the fact that we use random numbers
-         * from -0.5 to 0.5 (equally distributed) which have variance 1/12.
-         * time_step comes from the discretization.
-         */
-        auto const noise_amplitude =
-            (kT > 0.) ? std::sqrt(12. * 2. * lb_lbcoupling_get_gamma() * kT /
-                                  time_step)
-                      : 0.0;
-
-        auto f_random = [noise_amplitude](int id) -> Utils::Vector3d {
-          if (noise_amplitude > 0.0) {
-            return Random::noise_uniform<RNGSalt::PARTICLES>(
-                lb_particle_coupling.rng_counter_coupling->value(), 0, id);
-          }
-          return {};
-        };
+      if (lb_lbinterpolation_get_interpolation_order() ==
+              InterpolationOrder::quadratic and
+          n_nodes > 1) {
+        throw std::runtime_error("The non-linear interpolation scheme is only "
+                                 "implemented for the CPU LB on one MPI rank.");
+      }
+      auto const kT = lb_lbfluid_get_kT();
+      /* Eq. (16) @cite ahlrichs99a.
+       * The factor 12 comes from the fact that we use random numbers
+       * from -0.5 to 0.5 (equally distributed) which have variance 1/12.
+       * time_step comes from the discretization.
+       */
+      auto const noise_amplitude =
+          (kT > 0.) ? std::sqrt(12. * 2. * lb_lbcoupling_get_gamma() * kT /
+                                time_step)
+                    : 0.0;
+
+      auto f_random = [noise_amplitude](int id) -> Utils::Vector3d {
+        if (noise_amplitude > 0.0) {
+          return Random::noise_uniform<RNGSalt::PARTICLES>(
+              lb_particle_coupling.rng_counter_coupling->value(), 0, id);
+        }
+        return {};
+      };
 
-        auto couple_particle = [&](Particle &p) -> void {
-          if (p.is_virtual() and !couple_virtual)
-            return;
+      auto couple_particle = [&](Particle &p) -> void {
+        if (p.is_virtual() and !couple_virtual)
+          return;
 
+        // positions including shifts by one box length, all of them
+        // in the local LB domain plus halo
+        auto const positions = coupling_positions(p.pos());
+        if (not positions.empty()) {
           // Calculate coupling force
-          Utils::Vector3d force = {};
-          for (auto pos : positions_in_halo(p.pos(), box_geo)) {
-            if (in_local_halo(pos)) {
-              force = lb_viscous_coupling(p, pos,
-                                          noise_amplitude * f_random(p.id()));
-              break;
-            }
-          }
+          auto const force = lb_viscous_coupling(
+              p, positions.front(), noise_amplitude * f_random(p.id()));
 
-          // couple positions including shifts by one box length to add
-          // forces to ghost layers
-          for (auto pos : positions_in_halo(p.pos(), box_geo)) {
+          // couple all positions to add forces to ghost layers
+          for (auto const &pos : positions) {
             if (in_local_domain(pos)) {
               /* if the particle is in our LB volume, this node
                * is responsible to adding its force */
@@ -341,29 +362,26 @@ void lb_lbcoupling_calc_particle_lattice_ia(bool couple_virtual,
             }
             add_md_force(pos, force, time_step);
           }
+        }
 
 #ifdef ENGINE
-          add_swimmer_force(p, time_step);
+        add_swimmer_force(p, time_step);
 #endif
-        };
+      };
 
-        std::unordered_set<int> coupled_ghost_particles;
+      std::unordered_set<int> coupled_ghost_particles;
 
-        /* Couple particles ranges */
-        for (auto &p : particles) {
-          if (should_be_coupled(p, coupled_ghost_particles)) {
-            couple_particle(p);
-          }
+      /* Couple particles ranges */
+      for (auto &p : particles) {
+        if (should_be_coupled(p, coupled_ghost_particles)) {
+          couple_particle(p);
         }
+      }
 
-        for (auto &p : more_particles) {
-          if (should_be_coupled(p, coupled_ghost_particles)) {
-            couple_particle(p);
-          }
+      for (auto &p : more_particles) {
+        if (should_be_coupled(p, coupled_ghost_particles)) {
+          couple_particle(p);
         }
-
-        break;
-      }
       }
     }
   }
@@ -23,6 +23,9 @@
 #include "OptionalCounter.hpp"
 #include "ParticleRange.hpp"
 
+#include <utils/Vector.hpp>
+
+#include <boost/container/static_vector.hpp>
 #include <boost/serialization/access.hpp>
 
 #include <cstdint>
@@ -95,9 +98,12 @@ bool in_box(Utils::Vector<T, N> const &pos, Box<T, N> const &box) {
   return (pos >= box.first) and (pos < box.second);
 }
 
+/** @brief Periodic images of a position, stored without heap allocation. */
+using HaloPositions = boost::container::static_vector<Utils::Vector3d, 27>;
+
 bool in_local_halo(Utils::Vector3d const &pos);
-std::vector<Utils::Vector3d> positions_in_halo(Utils::Vector3d pos,
-                                               const BoxGeometry &box);
+HaloPositions positions_in_halo(Utils::Vector3d const &pos,
+                                const BoxGeometry &box);
 bool is_ghost_for_local_particle(const Particle &p);
 bool should_be_coupled(const Particle &p,
                        std::unordered_set<int> &coupled_ghost_particles);
@@ -104,10 +104,13 @@ void ImmersedBoundaries::calc_volumes(CellStructure &cs) {
   // Loop over all particles on local node
   cs.bond_loop([&tempVol](Particle &p1, int bond_id,
                           Utils::Span<Particle *> partners) {
+    // Only look up the volume conservation bond for triangles, since the
+    // search over the bond list is more expensive than the type check
+    if (boost::get<IBMTriel>(bonded_ia_params.at(bond_id).get()) == nullptr)
+      return false;
     auto vol_cons_params = vol_cons_parameters(p1);
 
-    if (vol_cons_params &&
-        boost::get<IBMTriel>(bonded_ia_params.at(bond_id).get()) != nullptr) {
+    if (vol_cons_params) {
       // Our particle is the leading particle of a triel
       // Get second and third particle of the triangle
       Particle &p2 = *partners[0];
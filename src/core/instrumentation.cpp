@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "instrumentation.hpp"
+
+#include <boost/mpi/collectives/reduce.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/operations.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Instrumentation {
+namespace detail {
+std::array<double, n_timers> timers{};
+std::array<unsigned long long, n_counters> counters{};
+} // namespace detail
+
+double local_time(Timer timer) {
+  return detail::timers[static_cast<std::size_t>(timer)];
+}
+
+unsigned long long local_count(Counter counter) {
+  return detail::counters[static_cast<std::size_t>(counter)];
+}
+
+void reset() {
+  detail::timers.fill(0.);
+  detail::counters.fill(0u);
+}
+
+std::string name(Timer timer) {
+  switch (timer) {
+  case Timer::INTEGRATE:
+    return "integrate";
+  case Timer::FORCE_CALC:
+    return "force_calc";
+  case Timer::SHORT_RANGE:
+    return "short_range";
+  case Timer::LONG_RANGE:
+    return "long_range";
+  case Timer::GHOST_COMM:
+    return "ghost_communication";
+  case Timer::FFT:
+    return "fft";
+  case Timer::MPI_WAIT:
+    return "mpi_wait";
+  case Timer::LB:
+    return "lb";
+  default:
+    break;
+  }
+  throw std::out_of_range("Unknown timer");
+}
+
+std::string name(Counter counter) {
+  switch (counter) {
+  case Counter::STEPS:
+    return "steps";
+  case Counter::PAIRS:
+    return "pairs";
+  case Counter::VERLET_REBUILDS:
+    return "verlet_rebuilds";
+  case Counter::GHOST_BYTES_SENT:
+    return "ghost_bytes_sent";
+  default:
+    break;
+  }
+  throw std::out_of_range("Unknown counter");
+}
+
+Report reduce_report(boost::mpi::communicator const &comm) {
+  // timers and counters in one buffer, to reduce each statistic at once
+  std::vector<double> local(n_timers + n_counters);
+  std::copy(detail::timers.begin(), detail::timers.end(), local.begin());
+  std::copy(detail::counters.begin(), detail::counters.end(),
+            local.begin() + n_timers);
+
+  auto const n = static_cast<int>(local.size());
+  std::vector<double> min(local.size()), max(local.size()), sum(local.size());
+  if (comm.rank() == 0) {
+    boost::mpi::reduce(comm, local.data(), n, min.data(),
+                       boost::mpi::minimum<double>(), 0);
+    boost::mpi::reduce(comm, local.data(), n, max.data(),
+                       boost::mpi::maximum<double>(), 0);
+    boost::mpi::reduce(comm, local.data(), n, sum.data(), std::plus<double>(),
+                       0);
+  } else {
+    boost::mpi::reduce(comm, local.data(), n, boost::mpi::minimum<double>(),
+                       0);
+    boost::mpi::reduce(comm, local.data(), n, boost::mpi::maximum<double>(),
+                       0);
+    boost::mpi::reduce(comm, local.data(), n, std::plus<double>(), 0);
+  }
+
+  auto const statistics = [&](std::size_t i) {
+    return Statistics{min[i], sum[i] / static_cast<double>(comm.size()),
+                      max[i]};
+  };
+  Report report;
+  for (std::size_t i = 0; i < n_timers; ++i) {
+    report.timers[i] = statistics(i);
+  }
+  for (std::size_t i = 0; i < n_counters; ++i) {
+    report.counters[i] = statistics(n_timers + i);
+  }
+  return report;
+}
+
+} // namespace Instrumentation
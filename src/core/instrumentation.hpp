@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_INSTRUMENTATION_HPP
+#define CORE_INSTRUMENTATION_HPP
+/** @file
+ *  Built-in timers and counters of the integration phases.
+ *
+ *  Unlike the Caliper annotations of @c profiler.hpp, this instrumentation
+ *  is always compiled in. Every rank accumulates the wall-clock time spent
+ *  in each phase and the number of events of each kind in fixed arrays;
+ *  the values are aggregated over all ranks only on request, which makes
+ *  it cheap enough to leave on in production runs. Timers of nested phases
+ *  are inclusive, e.g. the short-range time is part of the force time.
+ */
+
+#include <boost/mpi/communicator.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace Instrumentation {
+
+/** Timed phases. */
+enum class Timer : int {
+  INTEGRATE,   ///< whole call to @ref integrate
+  FORCE_CALC,  ///< force calculation, including the long-range solvers
+  SHORT_RANGE, ///< bonded and non-bonded loops, including Verlet lists
+  LONG_RANGE,  ///< long-range solvers
+  GHOST_COMM,  ///< ghost communication
+  FFT,         ///< parallel FFTs of the mesh-based solvers
+  MPI_WAIT,    ///< end-of-step synchronization, i.e. waiting for other ranks
+  LB,          ///< lattice-Boltzmann propagation
+  N_TIMERS
+};
+
+/** Counted events. */
+enum class Counter : int {
+  STEPS,            ///< integration steps
+  PAIRS,            ///< pairs passed to the non-bonded force kernel
+  VERLET_REBUILDS,  ///< Verlet list rebuilds
+  GHOST_BYTES_SENT, ///< bytes sent by the ghost communication
+  N_COUNTERS
+};
+
+constexpr auto n_timers = static_cast<std::size_t>(Timer::N_TIMERS);
+constexpr auto n_counters = static_cast<std::size_t>(Counter::N_COUNTERS);
+
+namespace detail {
+extern std::array<double, n_timers> timers;
+extern std::array<unsigned long long, n_counters> counters;
+} // namespace detail
+
+/** Add @p n events to a counter of the local rank. */
+inline void count(Counter counter, std::size_t n = 1) {
+  detail::counters[static_cast<std::size_t>(counter)] += n;
+}
+
+/** Add the lifetime of the object to a timer of the local rank. */
+class ScopedTimer {
+  using clock = std::chrono::steady_clock;
+
+public:
+  explicit ScopedTimer(Timer timer) : m_timer(timer), m_start(clock::now()) {}
+  ~ScopedTimer() {
+    std::chrono::duration<double> const elapsed = clock::now() - m_start;
+    detail::timers[static_cast<std::size_t>(m_timer)] += elapsed.count();
+  }
+  ScopedTimer(ScopedTimer const &) = delete;
+  ScopedTimer &operator=(ScopedTimer const &) = delete;
+
+private:
+  Timer m_timer;
+  clock::time_point m_start;
+};
+
+/** Accumulated time in seconds of a timer on the local rank. */
+double local_time(Timer timer);
+/** Accumulated number of events of a counter on the local rank. */
+unsigned long long local_count(Counter counter);
+/** Reset all timers and counters of the local rank. */
+void reset();
+
+/** Identifiers used by the script interface. */
+std::string name(Timer timer);
+std::string name(Counter counter);
+
+/** Distribution of a value over the ranks. */
+struct Statistics {
+  double min;
+  double avg;
+  double max;
+};
+
+struct Report {
+  std::array<Statistics, n_timers> timers;
+  std::array<Statistics, n_counters> counters;
+};
+
+/** Aggregate the timers and counters of all ranks.
+ *  Has to be called on all ranks of @p comm; the result is only
+ *  valid on rank 0.
+ */
+Report reduce_report(boost::mpi::communicator const &comm);
+
+} // namespace Instrumentation
+
+#endif
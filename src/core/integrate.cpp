@@ -46,6 +46,7 @@
 #include "grid.hpp"
 #include "grid_based_algorithms/lb_interface.hpp"
 #include "grid_based_algorithms/lb_particle_coupling.hpp"
+#include "instrumentation.hpp"
 #include "interactions.hpp"
 #include "lees_edwards/lees_edwards.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
@@ -58,10 +59,13 @@
 
 #include <profiler/profiler.hpp>
 
+#include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/collectives/reduce.hpp>
+#include <boost/mpi/operations.hpp>
 #include <boost/range/algorithm/min_element.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <csignal>
@@ -103,6 +107,42 @@ void notify_sig_int() {
 }
 } // namespace
 
+namespace {
+/** @brief Events queued during a time step on any node. */
+struct EventQueues {
+  bool any_collision;
+  bool any_breakage;
+  int max_seen_particle;
+};
+
+/** @brief Find out which event queues have entries on any node.
+ *
+ *  Collisions and bond breakages are queued on the node that detects them.
+ *  A single reduction per time step tells all nodes whether a queue has to
+ *  be exchanged, and syncs the largest particle id from which the virtual
+ *  sites created on collision take their ids. Time steps without events
+ *  need no further communication.
+ */
+EventQueues sync_event_queues() {
+  auto exchanged = BondBreakage::is_active();
+  std::array<int, 3> local = {0, static_cast<int>(!BondBreakage::queue_empty()),
+                              cell_structure.get_max_local_particle_id()};
+#ifdef COLLISION_DETECTION
+  exchanged |= collision_queues_are_exchanged();
+  local[0] = static_cast<int>(!local_collision_queue_empty());
+#endif
+  if (not exchanged)
+    return {false, false, local[2]};
+
+  std::array<int, 3> global;
+  boost::mpi::all_reduce(comm_cart, local.data(),
+                         static_cast<int>(local.size()), global.data(),
+                         boost::mpi::maximum<int>());
+  return {static_cast<bool>(global[0]), static_cast<bool>(global[1]),
+          global[2]};
+}
+} // namespace
+
 namespace LeesEdwards {
 /** @brief Currently active Lees-Edwards protocol. */
 static std::shared_ptr<ActiveProtocol> protocol = nullptr;
@@ -190,6 +230,28 @@ static void resort_particles_if_needed(ParticleRange const &particles) {
   }
 }
 
+/** @brief First Velocity Verlet step with the Lees-Edwards push and the
+ *  Verlet list displacement check fused into the propagation sweep.
+ */
+static void velocity_verlet_step_1_fused(ParticleRange const &particles) {
+  auto const offset = LeesEdwards::verlet_list_offset(
+      box_geo, cell_structure.get_le_pos_offset_at_last_resort());
+  auto const threshold = CellStructure::resort_threshold(skin, offset);
+  bool resort_required;
+  if (box_geo.type() == BoxType::LEES_EDWARDS) {
+    auto const kernel = LeesEdwards::Push{box_geo, time_step};
+    resort_required =
+        velocity_verlet_step_1(particles, time_step, kernel, threshold);
+  } else {
+    auto const kernel = [](Particle const &) {};
+    resort_required =
+        velocity_verlet_step_1(particles, time_step, kernel, threshold);
+  }
+  if (resort_required) {
+    cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+  }
+}
+
 /** @brief Calls the hook for propagation kernels before the force calculation
  *  @return whether or not to stop the integration loop early.
  */
@@ -200,7 +262,7 @@ static bool integrator_step_1(ParticleRange const &particles) {
     early_exit = steepest_descent_step(particles);
     break;
   case INTEG_METHOD_NVT:
-    velocity_verlet_step_1(particles, time_step);
+    velocity_verlet_step_1_fused(particles);
     break;
 #ifdef NPT
   case INTEG_METHOD_NPT_ISO:
@@ -253,6 +315,7 @@ static void integrator_step_2(ParticleRange const &particles, double kT) {
 
 int integrate(int n_steps, int reuse_forces) {
   ESPRESSO_PROFILER_CXX_MARK_FUNCTION;
+  Instrumentation::ScopedTimer timer(Instrumentation::Timer::INTEGRATE);
 
   // Prepare particle structure and run sanity checks of all active algorithms
   on_integration_start(time_step);
@@ -313,13 +376,16 @@ int integrate(int n_steps, int reuse_forces) {
     if (early_exit)
       break;
 
-    LeesEdwards::run_kernel<LeesEdwards::Push>();
+    // the VV integrator already applied the push and the resort check
+    if (integ_switch != INTEG_METHOD_NVT) {
+      LeesEdwards::run_kernel<LeesEdwards::Push>();
 
 #ifdef NPT
-    if (integ_switch != INTEG_METHOD_NPT_ISO)
+      if (integ_switch != INTEG_METHOD_NPT_ISO)
 #endif
-    {
-      resort_particles_if_needed(particles);
+      {
+        resort_particles_if_needed(particles);
+      }
     }
 
     // Propagate philox RNG counters
@@ -366,6 +432,7 @@ int integrate(int n_steps, int reuse_forces) {
             static_cast<int>(std::round(tau / time_step));
         fluid_step += 1;
         if (fluid_step >= lb_steps_per_md_step) {
+          Instrumentation::ScopedTimer lb_timer(Instrumentation::Timer::LB);
           fluid_step = 0;
           lb_lbfluid_propagate();
         }
@@ -376,16 +443,22 @@ int integrate(int n_steps, int reuse_forces) {
       virtual_sites()->after_lb_propagation(time_step);
 #endif
 
+      auto const events = sync_event_queues();
 #ifdef COLLISION_DETECTION
-      handle_collisions();
+      handle_collisions(events.any_collision, events.max_seen_particle);
 #endif
-      BondBreakage::process_queue();
+      BondBreakage::process_queue(events.any_breakage);
     }
 
     integrated_steps++;
+    Instrumentation::count(Instrumentation::Counter::STEPS);
 
-    if (check_runtime_errors(comm_cart))
-      break;
+    {
+      // all ranks synchronize here, so this is where imbalance shows up
+      Instrumentation::ScopedTimer wait(Instrumentation::Timer::MPI_WAIT);
+      if (check_runtime_errors(comm_cart))
+        break;
+    }
 
     // Check if SIGINT has been caught.
     if (ctrl_C == 1) {
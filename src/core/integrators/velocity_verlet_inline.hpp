@@ -27,67 +27,97 @@
 #include "integrate.hpp"
 #include "rotation.hpp"
 
-/** Propagate the velocities and positions. Integration steps before force
- *  calculation of the Velocity Verlet integrator: <br> \f[ v(t+0.5 \Delta t) =
- *  v(t) + 0.5 \Delta t f(t)/m \f] <br> \f[ p(t+\Delta t) = p(t) + \Delta t
- *  v(t+0.5 \Delta t) \f]
+/** Propagate the velocities and positions of a single particle.
+ *  Integration steps before force calculation of the Velocity Verlet
+ *  integrator: <br> \f[ v(t+0.5 \Delta t) = v(t) + 0.5 \Delta t f(t)/m \f]
+ *  <br> \f[ p(t+\Delta t) = p(t) + \Delta t v(t+0.5 \Delta t) \f]
  */
-inline void velocity_verlet_propagate_vel_pos(const ParticleRange &particles,
-                                              double time_step) {
-
-  for (auto &p : particles) {
+inline void velocity_verlet_propagate_vel_pos_particle(Particle &p,
+                                                       double time_step) {
 #ifdef ROTATION
-    propagate_omega_quat_particle(p, time_step);
+  propagate_omega_quat_particle(p, time_step);
 #endif
 
-    // Don't propagate translational degrees of freedom of vs
-    if (p.is_virtual())
-      continue;
-    for (int j = 0; j < 3; j++) {
-      if (!p.is_fixed_along(j)) {
-        /* Propagate velocities: v(t+0.5*dt) = v(t) + 0.5 * dt * a(t) */
-        p.v()[j] += 0.5 * time_step * p.force()[j] / p.mass();
+  // Don't propagate translational degrees of freedom of vs
+  if (p.is_virtual())
+    return;
+
+  // Fast path: without fixed coordinates all components are propagated
+  if (!p.has_fixed_coordinates()) {
+    p.v() += 0.5 * time_step * p.force() / p.mass();
+    p.pos() += time_step * p.v();
+    return;
+  }
 
-        /* Propagate positions (only NVT): p(t + dt)   = p(t) + dt *
-         * v(t+0.5*dt) */
-        p.pos()[j] += time_step * p.v()[j];
-      }
+  for (int j = 0; j < 3; j++) {
+    if (!p.is_fixed_along(j)) {
+      /* Propagate velocities: v(t+0.5*dt) = v(t) + 0.5 * dt * a(t) */
+      p.v()[j] += 0.5 * time_step * p.force()[j] / p.mass();
+
+      /* Propagate positions (only NVT): p(t + dt)   = p(t) + dt *
+       * v(t+0.5*dt) */
+      p.pos()[j] += time_step * p.v()[j];
     }
   }
 }
 
-/** Final integration step of the Velocity Verlet integrator
+/** Final integration step of the Velocity Verlet integrator for a single
+ *  particle
  *  \f[ v(t+\Delta t) = v(t+0.5 \Delta t) + 0.5 \Delta t f(t+\Delta t)/m \f]
  */
-inline void velocity_verlet_propagate_vel_final(const ParticleRange &particles,
-                                                double time_step) {
+inline void velocity_verlet_propagate_vel_final_particle(Particle &p,
+                                                         double time_step) {
+  // Virtual sites are not propagated during integration
+  if (p.is_virtual())
+    return;
 
-  for (auto &p : particles) {
-    // Virtual sites are not propagated during integration
-    if (p.is_virtual())
-      continue;
+  if (!p.has_fixed_coordinates()) {
+    p.v() += 0.5 * time_step * p.force() / p.mass();
+    return;
+  }
 
-    for (int j = 0; j < 3; j++) {
-      if (!p.is_fixed_along(j)) {
-        /* Propagate velocity: v(t+dt) = v(t+0.5*dt) + 0.5*dt * a(t+dt) */
-        p.v()[j] += 0.5 * time_step * p.force()[j] / p.mass();
-      }
+  for (int j = 0; j < 3; j++) {
+    if (!p.is_fixed_along(j)) {
+      /* Propagate velocity: v(t+dt) = v(t+0.5*dt) + 0.5*dt * a(t+dt) */
+      p.v()[j] += 0.5 * time_step * p.force()[j] / p.mass();
     }
   }
 }
 
-inline void velocity_verlet_step_1(const ParticleRange &particles,
-                                   double time_step) {
-  velocity_verlet_propagate_vel_pos(particles, time_step);
+/** First integration step of the Velocity Verlet integrator, fused with
+ *  the boundary kernel and the Verlet list displacement check, such that
+ *  the particle data is traversed only once.
+ *  @param particles         Particles to propagate
+ *  @param time_step         Time step
+ *  @param boundary_kernel   Kernel applied to each particle after the
+ *                           propagation (e.g. the Lees-Edwards push)
+ *  @param resort_threshold  Squared displacement above which a resort is
+ *                           required, see @ref CellStructure::resort_threshold
+ *  @return Whether a particle has left the Verlet skin.
+ */
+template <class BoundaryKernel>
+bool velocity_verlet_step_1(const ParticleRange &particles, double time_step,
+                            BoundaryKernel const &boundary_kernel,
+                            double resort_threshold) {
+  bool resort_required = false;
+  for (auto &p : particles) {
+    velocity_verlet_propagate_vel_pos_particle(p, time_step);
+    boundary_kernel(p);
+    resort_required |=
+        CellStructure::exceeds_resort_threshold(p, resort_threshold);
+  }
   increment_sim_time(time_step);
+  return resort_required;
 }
 
 inline void velocity_verlet_step_2(const ParticleRange &particles,
                                    double time_step) {
-  velocity_verlet_propagate_vel_final(particles, time_step);
+  for (auto &p : particles) {
+    velocity_verlet_propagate_vel_final_particle(p, time_step);
 #ifdef ROTATION
-  convert_torques_propagate_omega(particles, time_step);
+    convert_torque_propagate_omega_particle(p, time_step);
 #endif
+  }
 }
 
 #endif
@@ -52,8 +52,14 @@
 
 #include "Particle.hpp"
 #include "bonded_interactions/bonded_interaction_data.hpp"
+#include "cell_system/CellStructureType.hpp"
 #include "cells.hpp"
+#include "communication.hpp"
 #include "errorhandling.hpp"
+#include "event.hpp"
+#include "grid.hpp"
+#include "nonbonded_interactions/nonbonded_interaction_data.hpp"
+#include "particle_node.hpp"
 
 #include <utils/Vector.hpp>
 
@@ -62,6 +68,10 @@
 #include <boost/iostreams/device/array.hpp>
 #include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/stream.hpp>
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/collectives/all_to_all.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/serialization/vector.hpp>
 
 #include <mpi.h>
 
@@ -69,9 +79,13 @@
 #include <cassert>
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <limits>
+#include <numeric>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <sys/stat.h>
 #include <tuple>
@@ -373,33 +387,142 @@ static unsigned read_head(const std::string &fn, int rank) {
 
 /**
  * @brief Read the pref file.
- * Needs to be called by all processes.
+ * Needs to be called by all processes. Every process reads the prefixes
+ * of all ranks at the time of writing.
  *
  * @param fn The file name of the prefs file
+ * @param nproc The number of ranks at the time of writing
+ * @param nglobalpart The global amount of particles
+ * @return The particle prefixes of all writer ranks, followed by
+ *         @p nglobalpart.
+ */
+static std::vector<unsigned long>
+read_prefs(const std::string &fn, unsigned long nproc,
+           unsigned long nglobalpart) {
+  std::vector<unsigned long> prefs(nproc + 1ul);
+  mpiio_read_array<unsigned long>(fn, prefs.data(), nproc, 0ul,
+                                  MPI_UNSIGNED_LONG);
+  prefs.back() = nglobalpart;
+  return prefs;
+}
+
+/**
+ * @brief Partition the particles in contiguous blocks of equal size,
+ * independently of the number of ranks at the time of writing.
+ *
+ * @param nglobalpart The global amount of particles
  * @param rank The rank of the current process in @c MPI_COMM_WORLD
  * @param size The size of @c MPI_COMM_WORLD
- * @param nglobalpart The global amount of particles
  * @return The prefix and the local number of particles.
  */
 static std::tuple<unsigned long, unsigned long>
-read_prefs(const std::string &fn, int rank, int size,
-           unsigned long nglobalpart) {
-  auto const pref_offset = static_cast<unsigned long>(rank);
-  unsigned long pref = 0ul;
-  unsigned long nlocalpart = 0ul;
-  mpiio_read_array<unsigned long>(fn, &pref, 1ul, pref_offset,
-                                  MPI_UNSIGNED_LONG);
-  if (rank > 0)
-    MPI_Send(&pref, 1, MPI_UNSIGNED_LONG, rank - 1, 0, MPI_COMM_WORLD);
-  if (rank < size - 1)
-    MPI_Recv(&nlocalpart, 1, MPI_UNSIGNED_LONG, rank + 1, MPI_ANY_TAG,
-             MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-  else
-    nlocalpart = nglobalpart;
-  nlocalpart -= pref;
+block_partition(unsigned long nglobalpart, int rank, int size) {
+  auto const r = static_cast<unsigned long>(rank);
+  auto const n = static_cast<unsigned long>(size);
+  auto const base = nglobalpart / n;
+  auto const remainder = nglobalpart % n;
+  auto const pref = r * base + std::min(r, remainder);
+  auto const nlocalpart = base + ((r < remainder) ? 1ul : 0ul);
   return {pref, nlocalpart};
 }
 
+/**
+ * @brief Read the bonds of a contiguous block of particles.
+ * Bonds are stored as one archive per rank at the time of writing, hence
+ * all archives overlapping with the block are read in one chunk, and the
+ * particles preceding the block in the first archive are skipped.
+ * Needs to be called by all processes.
+ *
+ * @param prefix Filepath prefix
+ * @param prefs Particle prefixes of all writer ranks
+ * @param pref The prefix of the local block
+ * @param particles The particles of the local block
+ */
+static void read_bonds(const std::string &prefix,
+                       std::vector<unsigned long> const &prefs,
+                       unsigned long pref, std::vector<Particle> &particles) {
+  auto const nproc = prefs.size() - 1ul;
+  auto const pref_end = pref + particles.size();
+
+  // 1.boff
+  // 1 long int per writer rank
+  std::vector<unsigned long> bonds_prefs(nproc + 1ul, 0ul);
+  mpiio_read_array<unsigned long>(prefix + ".boff", bonds_prefs.data() + 1,
+                                  nproc, 0ul, MPI_UNSIGNED_LONG);
+  std::partial_sum(bonds_prefs.begin(), bonds_prefs.end(),
+                   bonds_prefs.begin());
+
+  // writer ranks whose particles overlap with the local block
+  auto w_first = nproc;
+  auto w_last = nproc;
+  for (std::size_t w = 0ul; w < nproc; ++w) {
+    if (prefs[w] < pref_end and prefs[w + 1ul] > pref) {
+      if (w_first == nproc) {
+        w_first = w;
+      }
+      w_last = w + 1ul;
+    }
+  }
+  auto const bonds_offset = bonds_prefs[w_first];
+  auto const bonds_size = bonds_prefs[w_last] - bonds_offset;
+
+  // 1.bond
+  // bytes of all overlapping archives
+  std::vector<char> bond(bonds_size);
+  mpiio_read_array<char>(prefix + ".bond", bond.data(), bonds_size,
+                         bonds_offset, MPI_CHAR);
+
+  auto p_it = particles.begin();
+  for (auto w = w_first; w < w_last; ++w) {
+    auto const archive_begin = bonds_prefs[w] - bonds_offset;
+    auto const archive_size = bonds_prefs[w + 1ul] - bonds_prefs[w];
+    boost::iostreams::array_source src(bond.data() + archive_begin,
+                                       archive_size);
+    boost::iostreams::stream<boost::iostreams::array_source> ss(src);
+    boost::archive::binary_iarchive ia(ss);
+
+    for (auto i = prefs[w]; i < std::min(prefs[w + 1ul], pref_end); ++i) {
+      if (i < pref) {
+        BondList skipped;
+        ia >> skipped;
+      } else {
+        ia >> p_it->bonds();
+        ++p_it;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Send the particles to the rank owning their position in a single
+ * all-to-all exchange, and insert them in the local cells.
+ * Needs to be called by all processes.
+ *
+ * @param particles The particles read by the current process
+ * @param route Whether to route the particles by position
+ */
+static void insert_particles(std::vector<Particle> &particles, bool route) {
+  if (not route) {
+    for (auto &p : particles) {
+      cell_structure.add_particle(std::move(p));
+    }
+    return;
+  }
+
+  std::vector<std::vector<Particle>> sendbuf(comm_cart.size());
+  for (auto &p : particles) {
+    sendbuf[map_position_node_array(p.pos())].emplace_back(std::move(p));
+  }
+  std::vector<std::vector<Particle>> recvbuf;
+  boost::mpi::all_to_all(comm_cart, sendbuf, recvbuf);
+
+  for (auto &received : recvbuf) {
+    for (auto &p : received) {
+      cell_structure.add_particle(std::move(p));
+    }
+  }
+}
+
 void mpi_mpiio_common_read(const std::string &prefix, unsigned fields) {
   cell_structure.remove_all_particles();
 
@@ -408,10 +531,10 @@ void mpi_mpiio_common_read(const std::string &prefix, unsigned fields) {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   auto const nproc = get_num_elem(prefix + ".pref", sizeof(unsigned long));
   auto const nglobalpart = get_num_elem(prefix + ".id", sizeof(int));
-
-  if (rank == 0 && nproc != static_cast<unsigned long>(size)) {
-    fatal_error("Trying to read a file with a different COMM "
-                "size than at point of writing.");
+  // Any number of ranks can read the dump, but the bond archives can only
+  // be located when the prefixes of the writer ranks are available.
+  if (nproc == 0ul and nglobalpart != 0ul) {
+    fatal_error("No writer rank found in", prefix + ".pref");
   }
 
   // 1.head on head node:
@@ -423,14 +546,13 @@ void mpi_mpiio_common_read(const std::string &prefix, unsigned fields) {
   }
 
   // 1.pref on all nodes:
-  // Read own prefix (1 int at prefix rank).
-  // Communicate own prefix to rank-1
-  // Determine nlocalpart (prefix of rank+1 - own prefix) on every node.
-  auto const [pref, nlocalpart] =
-      read_prefs(prefix + ".pref", rank, size, nglobalpart);
+  // Read the prefixes of all writer ranks, which are only needed to
+  // locate the bond archives. Each rank reads a contiguous block of
+  // particles, whose size doesn't depend on the number of writer ranks.
+  auto const prefs = read_prefs(prefix + ".pref", nproc, nglobalpart);
+  auto const [pref, nlocalpart] = block_partition(nglobalpart, rank, size);
 
   std::vector<Particle> particles(nlocalpart);
-
   {
     // 1.id on all nodes:
     // Read nlocalpart ints at defined prefix.
@@ -487,31 +609,215 @@ void mpi_mpiio_common_read(const std::string &prefix, unsigned fields) {
   }
 
   if (fields & MPIIO_OUT_BND) {
-    // 1.boff
-    // 1 long int per process
-    auto const pref_offset = static_cast<unsigned long>(rank);
-    unsigned long bonds_size = 0u;
-    mpiio_read_array<unsigned long>(prefix + ".boff", &bonds_size, 1ul,
-                                    pref_offset, MPI_UNSIGNED_LONG);
-    auto const bonds_offset = mpi_calculate_file_offset(bonds_size);
+    read_bonds(prefix, prefs, pref, particles);
+  }
 
-    // 1.bond
-    // nlocalbonds ints per process
-    std::vector<char> bond(bonds_size);
-    mpiio_read_array<char>(prefix + ".bond", bond.data(), bonds_size,
-                           bonds_offset, MPI_CHAR);
+  // particles without positions stay on the reading rank until the
+  // next global resort
+  auto const route = (fields & MPIIO_OUT_POS) and
+                     local_geo.cell_structure_type() ==
+                         CellStructureType::CELL_STRUCTURE_REGULAR;
+  insert_particles(particles, route);
+}
+
+namespace {
+/** @brief Header of the particle checkpoint container. */
+struct CheckpointHeader {
+  char magic[8];
+  std::uint64_t version;
+  /** Size of the particle struct, to detect incompatible feature sets. */
+  std::uint64_t particle_size;
+  std::uint64_t n_writers;
+};
+
+constexpr char checkpoint_magic[8] = {'E', 'S', 'P', 'R', 'P', 'C', 'P', 'T'};
+constexpr std::uint64_t checkpoint_version = 1u;
+} // namespace
+
+/**
+ * @brief Collective read or write of a contiguous range of bytes.
+ * The element count of MPI-IO calls is an @c int, hence ranges beyond
+ * 2 GiB are split into chunks. All ranks issue the same number of
+ * collective calls; ranks with fewer chunks take part with empty ones.
+ * @param f            File handle.
+ * @param offset       Offset of the range in the file, in bytes.
+ * @param data         Start of the range in memory.
+ * @param n_bytes      Size of the range.
+ * @param io           @c MPI_File_write_at_all or @c MPI_File_read_at_all.
+ * @return Bitwise or of the MPI error codes.
+ */
+template <typename T, typename IOFunction>
+static int bytes_at_all(MPI_File f, MPI_Offset offset, T *data,
+                        std::size_t n_bytes, IOFunction io) {
+  constexpr auto max_chunk =
+      static_cast<std::size_t>(std::numeric_limits<int>::max());
+  auto const n_chunks = (n_bytes + max_chunk - 1ul) / max_chunk;
+  auto const n_calls = boost::mpi::all_reduce(
+      comm_cart, n_chunks, boost::mpi::maximum<std::size_t>());
+  auto ret = 0;
+  for (std::size_t i = 0ul; i < n_calls; ++i) {
+    auto const begin = std::min(i * max_chunk, n_bytes);
+    auto const count = std::min(max_chunk, n_bytes - begin);
+    ret |= io(f, offset + static_cast<MPI_Offset>(begin), data + begin,
+              static_cast<int>(count), MPI_CHAR, MPI_STATUS_IGNORE);
+  }
+  return ret;
+}
+
+static void mpi_write_particle_checkpoint_local(std::string const &fn) {
+  int size, rank;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto const particles = cell_structure.local_particles();
+
+  std::vector<char> buffer;
+  {
+    namespace io = boost::iostreams;
+    io::stream_buffer<io::back_insert_device<std::vector<char>>> os{
+        io::back_inserter(buffer)};
+    boost::archive::binary_oarchive oa{os};
+    for (auto const &p : particles) {
+      oa << p;
+    }
+  }
+
+  // table of contents: number of particles and archive size of each rank
+  std::uint64_t const entry[2] = {particles.size(), buffer.size()};
+  std::vector<std::uint64_t> table(2ul * static_cast<std::size_t>(size));
+  MPI_Allgather(entry, 2, MPI_UINT64_T, table.data(), 2, MPI_UINT64_T,
+                MPI_COMM_WORLD);
+  auto offset = static_cast<MPI_Offset>(sizeof(CheckpointHeader) +
+                                        table.size() * sizeof(std::uint64_t));
+  for (int r = 0; r < rank; ++r) {
+    offset += static_cast<MPI_Offset>(table[2 * r + 1]);
+  }
+
+  MPI_File f;
+  auto ret = MPI_File_open(MPI_COMM_WORLD, const_cast<char *>(fn.c_str()),
+                           MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL,
+                           &f);
+  if (ret) {
+    fatal_error("Could not open file", fn, &f, ret);
+  }
+  ret = MPI_File_set_size(f, 0);
+  if (rank == 0) {
+    CheckpointHeader header{};
+    std::copy_n(checkpoint_magic, sizeof header.magic, header.magic);
+    header.version = checkpoint_version;
+    header.particle_size = sizeof(Particle);
+    header.n_writers = static_cast<std::uint64_t>(size);
+    ret |= MPI_File_write_at(f, 0, &header, sizeof header, MPI_BYTE,
+                             MPI_STATUS_IGNORE);
+    ret |= MPI_File_write_at(f, sizeof header, table.data(),
+                             static_cast<int>(table.size()), MPI_UINT64_T,
+                             MPI_STATUS_IGNORE);
+  }
+  ret |= bytes_at_all(f, offset, buffer.data(), buffer.size(),
+                      MPI_File_write_at_all);
+  static_cast<void>(ret and fatal_error("Could not write file", fn, &f, ret));
+  MPI_File_close(&f);
+}
+
+REGISTER_CALLBACK(mpi_write_particle_checkpoint_local)
+
+static void mpi_read_particle_checkpoint_local(std::string const &fn) {
+  int size, rank;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  MPI_File f;
+  auto ret = MPI_File_open(MPI_COMM_WORLD, const_cast<char *>(fn.c_str()),
+                           MPI_MODE_RDONLY, MPI_INFO_NULL, &f);
+  if (ret) {
+    fatal_error("Could not open file", fn, &f, ret);
+  }
+  CheckpointHeader header{};
+  ret = MPI_File_read_at_all(f, 0, &header, sizeof header, MPI_BYTE,
+                             MPI_STATUS_IGNORE);
+  static_cast<void>(ret and fatal_error("Could not read file", fn, &f, ret));
+  if (not std::equal(std::begin(checkpoint_magic), std::end(checkpoint_magic),
+                     std::begin(header.magic))) {
+    MPI_File_close(&f);
+    fatal_error("Not a particle checkpoint file", fn);
+  }
+  if (header.version != checkpoint_version) {
+    MPI_File_close(&f);
+    fatal_error("Unsupported particle checkpoint version in", fn);
+  }
+  if (header.particle_size != sizeof(Particle)) {
+    MPI_File_close(&f);
+    fatal_error("Particle checkpoint was written with different features",
+                fn);
+  }
+
+  // table of contents of all writer ranks
+  auto const n_writers = static_cast<std::size_t>(header.n_writers);
+  std::vector<std::uint64_t> table(2ul * n_writers);
+  ret = MPI_File_read_at_all(f, sizeof header, table.data(),
+                             static_cast<int>(table.size()), MPI_UINT64_T,
+                             MPI_STATUS_IGNORE);
+  static_cast<void>(ret and fatal_error("Could not read file", fn, &f, ret));
+  std::vector<MPI_Offset> archive_offsets(n_writers + 1ul);
+  archive_offsets[0] = static_cast<MPI_Offset>(
+      sizeof header + table.size() * sizeof(std::uint64_t));
+  for (std::size_t w = 0ul; w < n_writers; ++w) {
+    archive_offsets[w + 1ul] =
+        archive_offsets[w] + static_cast<MPI_Offset>(table[2ul * w + 1ul]);
+  }
 
-    boost::iostreams::array_source src(bond.data(), bond.size());
+  // each rank reads a contiguous block of archives
+  auto const [w_first, n_archives] = block_partition(n_writers, rank, size);
+  auto const w_last = w_first + n_archives;
+  auto const bytes_offset = archive_offsets[w_first];
+  auto const n_bytes =
+      static_cast<std::size_t>(archive_offsets[w_last] - bytes_offset);
+  std::vector<char> buffer(n_bytes);
+  ret = bytes_at_all(f, bytes_offset, buffer.data(), n_bytes,
+                     MPI_File_read_at_all);
+  static_cast<void>(ret and fatal_error("Could not read file", fn, &f, ret));
+  MPI_File_close(&f);
+
+  std::vector<Particle> particles;
+  auto max_type = -1;
+  for (auto w = w_first; w < w_last; ++w) {
+    boost::iostreams::array_source src(
+        buffer.data() + (archive_offsets[w] - bytes_offset),
+        static_cast<std::size_t>(table[2ul * w + 1ul]));
     boost::iostreams::stream<boost::iostreams::array_source> ss(src);
     boost::archive::binary_iarchive ia(ss);
-
-    for (auto &p : particles) {
-      ia >> p.bonds();
+    for (std::uint64_t i = 0u; i < table[2ul * w]; ++i) {
+      Particle p;
+      ia >> p;
+      max_type = std::max(max_type, p.type());
+      particles.emplace_back(std::move(p));
     }
   }
 
-  for (auto &p : particles) {
-    cell_structure.add_particle(std::move(p));
+  max_type = boost::mpi::all_reduce(comm_cart, max_type,
+                                    boost::mpi::maximum<int>());
+  if (max_type >= 0) {
+    make_particle_type_exist_local(max_type);
   }
+  auto const route = local_geo.cell_structure_type() ==
+                     CellStructureType::CELL_STRUCTURE_REGULAR;
+  insert_particles(particles, route);
+  cell_structure.set_resort_particles(Cells::RESORT_GLOBAL);
+  on_particle_change();
 }
+
+REGISTER_CALLBACK(mpi_read_particle_checkpoint_local)
+
+void mpi_write_particle_checkpoint(std::string const &fn) {
+  mpi_call_all(mpi_write_particle_checkpoint_local, fn);
+}
+
+void mpi_read_particle_checkpoint(std::string const &fn) {
+  if (get_n_part() != 0) {
+    throw std::runtime_error("Particle checkpoints can only be loaded in a "
+                             "system without particles");
+  }
+  mpi_call_all(mpi_read_particle_checkpoint_local, fn);
+  clear_particle_node();
+}
+
 } // namespace Mpiio
@@ -59,6 +59,9 @@ void mpi_mpiio_common_write(const std::string &prefix, unsigned fields,
 
 /**
  * @brief Parallel binary input using MPI-IO.
+ * The number of MPI ranks may differ from the one at the time of writing:
+ * each rank reads a contiguous block of particles, which are then sent
+ * to the rank owning their position in a single all-to-all exchange.
  * To be called by all MPI processes. Aborts ESPResSo if an error occurs.
  * On 1 MPI rank, the error is converted to a runtime error and can be
  * recovered.
@@ -68,6 +71,31 @@ void mpi_mpiio_common_write(const std::string &prefix, unsigned fields,
  */
 void mpi_mpiio_common_read(const std::string &prefix, unsigned fields);
 
+/**
+ * @brief Write the complete state of all particles to a checkpoint file.
+ * Each rank serializes its local particles, including bonds and
+ * exclusions, into a binary archive. The archives are written in parallel
+ * to a single versioned container, after a table of contents which stores
+ * the number of particles and the archive size of each rank.
+ * The file can only be read by an ESPResSo build with the same features
+ * on a machine with the same architecture.
+ * To be called by the head node only. Aborts ESPResSo if an error occurs.
+ *
+ * @param fn Filepath.
+ */
+void mpi_write_particle_checkpoint(std::string const &fn);
+
+/**
+ * @brief Load particles from a checkpoint file.
+ * The number of MPI ranks may differ from the one at the time of writing:
+ * each rank reads a contiguous block of archives and the particles are
+ * then sent to the rank owning their position.
+ * To be called by the head node only. Aborts ESPResSo if an error occurs.
+ *
+ * @param fn Filepath.
+ */
+void mpi_read_particle_checkpoint(std::string const &fn);
+
 } // namespace Mpiio
 
 #endif
@@ -31,16 +31,18 @@
 #include <utils/Vector.hpp>
 
 #include <boost/mpi/collectives.hpp>
+#include <boost/multi_array.hpp>
 
 #include <mpi.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <fstream>
-#include <functional>
 #include <iterator>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Writer {
@@ -163,8 +165,9 @@ static std::vector<hsize_t> create_dims(hsize_t rank, hsize_t data_dim) {
   }
 }
 
-static std::vector<hsize_t> create_chunk_dims(hsize_t rank, hsize_t data_dim) {
-  hsize_t chunk_size = (rank > 1) ? 1000 : 1;
+static std::vector<hsize_t> create_chunk_dims(hsize_t rank, hsize_t data_dim,
+                                              hsize_t n_part_chunk) {
+  hsize_t chunk_size = (rank > 1) ? n_part_chunk : 1;
   switch (rank) {
   case 3:
     return {1, chunk_size, data_dim};
@@ -185,8 +188,9 @@ void File::create_datasets() {
       continue;
     auto maxdims = std::vector<hsize_t>(d.rank, H5S_UNLIMITED);
     auto dataspace = h5xx::dataspace(create_dims(d.rank, d.data_dim), maxdims);
-    auto storage = hps::chunked(create_chunk_dims(d.rank, d.data_dim))
-                       .set(hps::fill_value(-10));
+    auto const chunk_dims = create_chunk_dims(
+        d.rank, d.data_dim, static_cast<hsize_t>(m_chunk_size));
+    auto storage = hps::chunked(chunk_dims).set(hps::fill_value(-10));
     datasets[d.path()] = h5xx::dataset(m_h5md_file, d.path(), d.type, dataspace,
                                        storage, H5P_DEFAULT, H5P_DEFAULT);
   }
@@ -277,6 +281,7 @@ void File::create_file(const std::string &file_path) {
 }
 
 void File::close() {
+  write_frames();
   if (m_comm.rank() == 0)
     boost::filesystem::remove(m_backup_filename);
 }
@@ -286,192 +291,323 @@ namespace detail {
 template <std::size_t rank> struct slice_info {};
 
 template <> struct slice_info<3> {
-  static auto extent(hsize_t n_part_diff) {
-    return Vector3hs{1, n_part_diff, 0};
+  static auto extent(hsize_t n_frames, hsize_t n_part_diff) {
+    return Vector3hs{n_frames, n_part_diff, 0};
   }
-  static constexpr auto count() { return Vector3hs{1, 1, 3}; }
+  static auto count(hsize_t n_part) { return Vector3hs{1, n_part, 3}; }
   static auto offset(hsize_t n_time_steps, hsize_t prefix) {
     return Vector3hs{n_time_steps, prefix, 0};
   }
+  template <typename T> static auto buffer(std::vector<T> const &values) {
+    boost::multi_array<T, 3> out(boost::extents[1][values.size() / 3][3]);
+    std::copy(values.begin(), values.end(), out.data());
+    return out;
+  }
 };
 
 template <> struct slice_info<2> {
-  static auto extent(hsize_t n_part_diff) { return Vector2hs{1, n_part_diff}; }
-  static constexpr auto count() { return Vector2hs{1, 1}; }
+  static auto extent(hsize_t n_frames, hsize_t n_part_diff) {
+    return Vector2hs{n_frames, n_part_diff};
+  }
+  static auto count(hsize_t n_part) { return Vector2hs{1, n_part}; }
   static auto offset(hsize_t n_time_steps, hsize_t prefix) {
     return Vector2hs{n_time_steps, prefix};
   }
+  template <typename T> static auto buffer(std::vector<T> const &values) {
+    boost::multi_array<T, 2> out(boost::extents[1][values.size()]);
+    std::copy(values.begin(), values.end(), out.data());
+    return out;
+  }
 };
 
 } // namespace detail
 
-template <std::size_t dim, typename Op>
-void write_td_particle_property(hsize_t prefix, hsize_t n_part_global,
-                                ParticleRange const &particles,
-                                h5xx::dataset &dataset, Op op) {
+/**
+ * @brief Write one particle property for a batch of frames.
+ * The dataset is extended once for the whole batch, and each rank writes
+ * its particles of each frame as one contiguous hyperslab.
+ */
+template <std::size_t dim, typename T>
+static void write_td_particle_property(std::vector<Frame> const &frames,
+                                       std::vector<T> Frame::*member,
+                                       std::vector<int> const &prefixes,
+                                       std::vector<int> const &totals,
+                                       h5xx::dataset &dataset) {
+  using info = detail::slice_info<dim>;
   auto const old_extents = static_cast<h5xx::dataspace>(dataset).extents();
+  auto const n_frames = static_cast<hsize_t>(frames.size());
+  auto const n_part_global =
+      static_cast<hsize_t>(*std::max_element(totals.begin(), totals.end()));
   auto const extent_particle_number =
       std::max(n_part_global, old_extents[1]) - old_extents[1];
-  extend_dataset(dataset,
-                 detail::slice_info<dim>::extent(extent_particle_number));
-  auto const count = detail::slice_info<dim>::count();
-  auto offset = detail::slice_info<dim>::offset(old_extents[0], prefix);
-  for (auto const &p : particles) {
-    h5xx::write_dataset(dataset, op(p), h5xx::slice(offset, count));
-    // advance in the particle dimension
-    offset[1] += 1;
+  extend_dataset(dataset, info::extent(n_frames, extent_particle_number));
+  for (std::size_t i = 0; i < frames.size(); ++i) {
+    auto const &values = frames[i].*member;
+    auto const buffer = info::buffer(values);
+    auto const n_part_local = static_cast<hsize_t>(buffer.shape()[1]);
+    if (n_part_local == 0)
+      continue;
+    auto const offset = info::offset(old_extents[0] + i,
+                                     static_cast<hsize_t>(prefixes[i]));
+    h5xx::write_dataset(dataset, buffer,
+                        h5xx::slice(offset, info::count(n_part_local)));
   }
 }
 
-static void write_box(BoxGeometry const &geometry, h5xx::dataset &dataset) {
+/**
+ * @brief Write one box parameter for a batch of frames.
+ * These values are identical on all ranks.
+ */
+template <typename T, typename Op>
+static void write_td_box_property(std::vector<Frame> const &frames,
+                                  h5xx::dataset &dataset, Op op) {
   auto const extents = static_cast<h5xx::dataspace>(dataset).extents();
-  extend_dataset(dataset, Vector2hs{1, 0});
-  h5xx::write_dataset(dataset, geometry.length(),
-                      h5xx::slice(Vector2hs{extents[0], 0}, Vector2hs{1, 3}));
+  auto const n_frames = static_cast<hsize_t>(frames.size());
+  auto const width = static_cast<hsize_t>(op(frames.front()).size());
+  boost::multi_array<T, 2> buffer(boost::extents[frames.size()][width]);
+  for (std::size_t i = 0; i < frames.size(); ++i) {
+    auto const values = op(frames[i]);
+    std::copy(values.begin(), values.end(), buffer[i].begin());
+  }
+  extend_dataset(dataset, Vector2hs{n_frames, 0});
+  h5xx::write_dataset(dataset, buffer,
+                      h5xx::slice(Vector2hs{extents[0], 0},
+                                  Vector2hs{n_frames, width}));
 }
 
-static void write_le_off(LeesEdwardsBC const &lebc, h5xx::dataset &dataset) {
+template <typename T, typename Op>
+static void write_td_scalar(std::vector<Frame> const &frames,
+                            h5xx::dataset &dataset, Op op) {
   auto const extents = static_cast<h5xx::dataspace>(dataset).extents();
-  extend_dataset(dataset, Vector2hs{1, 0});
-  h5xx::write_dataset(dataset, Utils::Vector<double, 1>{lebc.pos_offset},
-                      h5xx::slice(Vector2hs{extents[0], 0}, Vector2hs{1, 1}));
+  auto const n_frames = static_cast<hsize_t>(frames.size());
+  boost::multi_array<T, 1> buffer(boost::extents[frames.size()]);
+  std::transform(frames.begin(), frames.end(), buffer.begin(), op);
+  write_dataset(buffer, dataset, Vector1hs{n_frames}, Vector1hs{extents[0]},
+                Vector1hs{n_frames});
 }
 
-static void write_le_dir(LeesEdwardsBC const &lebc, h5xx::dataset &dataset) {
-  auto const extents = static_cast<h5xx::dataspace>(dataset).extents();
-  extend_dataset(dataset, Vector2hs{1, 0});
-  h5xx::write_dataset(dataset, Utils::Vector<int, 1>{lebc.shear_direction},
-                      h5xx::slice(Vector2hs{extents[0], 0}, Vector2hs{1, 1}));
+template <typename T, typename Op>
+static auto stage_property(ParticleRange const &particles, Op op) {
+  std::vector<T> values;
+  values.reserve(particles.size());
+  for (auto const &p : particles) {
+    values.emplace_back(op(p));
+  }
+  return values;
 }
 
-static void write_le_normal(LeesEdwardsBC const &lebc, h5xx::dataset &dataset) {
-  auto const extents = static_cast<h5xx::dataspace>(dataset).extents();
-  extend_dataset(dataset, Vector2hs{1, 0});
-  h5xx::write_dataset(dataset, Utils::Vector<int, 1>{lebc.shear_plane_normal},
-                      h5xx::slice(Vector2hs{extents[0], 0}, Vector2hs{1, 1}));
+template <typename T, typename Op>
+static auto stage_vector_property(ParticleRange const &particles, Op op) {
+  std::vector<T> values;
+  values.reserve(3 * particles.size());
+  for (auto const &p : particles) {
+    auto const value = op(p);
+    values.insert(values.end(), value.begin(), value.end());
+  }
+  return values;
 }
 
 void File::write(const ParticleRange &particles, double time, int step,
                  BoxGeometry const &geometry) {
+  auto const &lebc = geometry.lees_edwards_bc();
+  Frame frame;
+  frame.time = time;
+  frame.step = step;
+  frame.box_l = geometry.length();
+  frame.le_offset = lebc.pos_offset;
+  frame.le_direction = lebc.shear_direction;
+  frame.le_normal = lebc.shear_plane_normal;
+  frame.id = stage_property<int>(particles, [](auto const &p) {
+    return p.id();
+  });
+  if (m_fields & H5MD_OUT_TYPE) {
+    frame.type = stage_property<int>(particles, [](auto const &p) {
+      return p.type();
+    });
+  }
+  if (m_fields & H5MD_OUT_MASS) {
+    frame.mass = stage_property<double>(particles, [](auto const &p) {
+      return p.mass();
+    });
+  }
+  if (m_fields & H5MD_OUT_POS) {
+    auto const precision = m_position_precision;
+    frame.pos = stage_vector_property<double>(particles, [&](auto const &p) {
+      auto pos = folded_position(p.pos(), geometry);
+      if (precision > 0.) {
+        for (auto &x : pos) {
+          x = std::round(x / precision) * precision;
+        }
+      }
+      return pos;
+    });
+  }
+  if (m_fields & H5MD_OUT_IMG) {
+    frame.image = stage_vector_property<int>(particles, [](auto const &p) {
+      return p.image_box();
+    });
+  }
+  if (m_fields & H5MD_OUT_VEL) {
+    frame.vel = stage_vector_property<double>(particles, [](auto const &p) {
+      return p.v();
+    });
+  }
+  if (m_fields & H5MD_OUT_FORCE) {
+    frame.force = stage_vector_property<double>(particles, [](auto const &p) {
+      return p.force();
+    });
+  }
+  if (m_fields & H5MD_OUT_CHARGE) {
+    frame.charge = stage_property<double>(particles, [](auto const &p) {
+      return p.q();
+    });
+  }
+  if (m_fields & H5MD_OUT_BONDS) {
+    for (auto const &p : particles) {
+      for (auto const b : p.bonds()) {
+        auto const partner_ids = b.partner_ids();
+        if (partner_ids.size() == 1) {
+          frame.bonds.emplace_back(p.id());
+          frame.bonds.emplace_back(partner_ids[0]);
+        }
+      }
+    }
+  }
+  m_frames.emplace_back(std::move(frame));
+  if (m_frames.size() >= static_cast<std::size_t>(m_buffer_size)) {
+    write_frames();
+  }
+}
+
+void File::write_frames() {
+  if (m_frames.empty())
+    return;
+
+  // calculate the offset of the local particles and bonds in each frame
+  auto const n_frames = static_cast<int>(m_frames.size());
+  std::vector<int> counts_local(2 * m_frames.size());
+  for (std::size_t i = 0; i < m_frames.size(); ++i) {
+    counts_local[2 * i + 0] = static_cast<int>(m_frames[i].id.size());
+    counts_local[2 * i + 1] = static_cast<int>(m_frames[i].bonds.size() / 2);
+  }
+  std::vector<int> prefixes(counts_local.size(), 0);
+  std::vector<int> totals(counts_local.size(), 0);
+  BOOST_MPI_CHECK_RESULT(MPI_Exscan,
+                         (counts_local.data(), prefixes.data(), 2 * n_frames,
+                          MPI_INT, MPI_SUM, m_comm));
+  if (m_comm.rank() == 0) {
+    std::fill(prefixes.begin(), prefixes.end(), 0);
+  }
+  BOOST_MPI_CHECK_RESULT(MPI_Allreduce,
+                         (counts_local.data(), totals.data(), 2 * n_frames,
+                          MPI_INT, MPI_SUM, m_comm));
+  std::vector<int> part_prefixes, part_totals, bond_prefixes, bond_totals;
+  for (std::size_t i = 0; i < m_frames.size(); ++i) {
+    part_prefixes.emplace_back(prefixes[2 * i + 0]);
+    part_totals.emplace_back(totals[2 * i + 0]);
+    bond_prefixes.emplace_back(prefixes[2 * i + 1]);
+    bond_totals.emplace_back(totals[2 * i + 1]);
+  }
+
   if (m_fields & H5MD_OUT_BOX_L) {
-    write_box(geometry, datasets["particles/atoms/box/edges/value"]);
+    write_td_box_property<double>(
+        m_frames, datasets["particles/atoms/box/edges/value"],
+        [](Frame const &f) { return f.box_l; });
   }
-  auto const &lebc = geometry.lees_edwards_bc();
   if (m_fields & H5MD_OUT_LE_OFF) {
-    write_le_off(lebc, datasets["particles/atoms/lees_edwards/offset/value"]);
+    write_td_box_property<double>(
+        m_frames, datasets["particles/atoms/lees_edwards/offset/value"],
+        [](Frame const &f) { return Utils::Vector<double, 1>{f.le_offset}; });
   }
   if (m_fields & H5MD_OUT_LE_DIR) {
-    write_le_dir(lebc,
-                 datasets["particles/atoms/lees_edwards/direction/value"]);
+    write_td_box_property<int>(
+        m_frames, datasets["particles/atoms/lees_edwards/direction/value"],
+        [](Frame const &f) { return Utils::Vector<int, 1>{f.le_direction}; });
   }
   if (m_fields & H5MD_OUT_LE_NORMAL) {
-    write_le_normal(lebc,
-                    datasets["particles/atoms/lees_edwards/normal/value"]);
+    write_td_box_property<int>(
+        m_frames, datasets["particles/atoms/lees_edwards/normal/value"],
+        [](Frame const &f) { return Utils::Vector<int, 1>{f.le_normal}; });
   }
 
-  auto const n_part_local = static_cast<int>(particles.size());
-  // calculate count and offset
-  int prefix = 0;
-  // calculate prefix for write of the current process
-  BOOST_MPI_CHECK_RESULT(MPI_Exscan,
-                         (&n_part_local, &prefix, 1, MPI_INT, MPI_SUM, m_comm));
-
-  auto const n_part_global =
-      boost::mpi::all_reduce(m_comm, n_part_local, std::plus<int>());
-
-  write_td_particle_property<2>(
-      prefix, n_part_global, particles, datasets["particles/atoms/id/value"],
-      [](auto const &p) { return Utils::Vector<int, 1>{p.id()}; });
-
   {
     h5xx::dataset &dataset = datasets["particles/atoms/id/value"];
-    auto const extents = static_cast<h5xx::dataspace>(dataset).extents();
-    write_dataset(Utils::Vector<double, 1>{time},
-                  datasets["particles/atoms/id/time"], Vector1hs{1},
-                  Vector1hs{extents[0]}, Vector1hs{1});
-    write_dataset(Utils::Vector<int, 1>{step},
-                  datasets["particles/atoms/id/step"], Vector1hs{1},
-                  Vector1hs{extents[0]}, Vector1hs{1});
+    write_td_scalar<double>(m_frames, datasets["particles/atoms/id/time"],
+                            [](Frame const &f) { return f.time; });
+    write_td_scalar<int>(m_frames, datasets["particles/atoms/id/step"],
+                         [](Frame const &f) { return f.step; });
+    write_td_particle_property<2>(m_frames, &Frame::id, part_prefixes,
+                                  part_totals, dataset);
   }
 
   if (m_fields & H5MD_OUT_TYPE) {
-    write_td_particle_property<2>(
-        prefix, n_part_global, particles,
-        datasets["particles/atoms/species/value"],
-        [](auto const &p) { return Utils::Vector<int, 1>{p.type()}; });
+    write_td_particle_property<2>(m_frames, &Frame::type, part_prefixes,
+                                  part_totals,
+                                  datasets["particles/atoms/species/value"]);
   }
   if (m_fields & H5MD_OUT_MASS) {
-    write_td_particle_property<2>(
-        prefix, n_part_global, particles,
-        datasets["particles/atoms/mass/value"],
-        [](auto const &p) { return Utils::Vector<double, 1>{p.mass()}; });
+    write_td_particle_property<2>(m_frames, &Frame::mass, part_prefixes,
+                                  part_totals,
+                                  datasets["particles/atoms/mass/value"]);
   }
   if (m_fields & H5MD_OUT_POS) {
-    write_td_particle_property<3>(
-        prefix, n_part_global, particles,
-        datasets["particles/atoms/position/value"],
-        [&](auto const &p) { return folded_position(p.pos(), geometry); });
+    write_td_particle_property<3>(m_frames, &Frame::pos, part_prefixes,
+                                  part_totals,
+                                  datasets["particles/atoms/position/value"]);
   }
   if (m_fields & H5MD_OUT_IMG) {
-    write_td_particle_property<3>(prefix, n_part_global, particles,
-                                  datasets["particles/atoms/image/value"],
-                                  [](auto const &p) { return p.image_box(); });
+    write_td_particle_property<3>(m_frames, &Frame::image, part_prefixes,
+                                  part_totals,
+                                  datasets["particles/atoms/image/value"]);
   }
   if (m_fields & H5MD_OUT_VEL) {
-    write_td_particle_property<3>(prefix, n_part_global, particles,
-                                  datasets["particles/atoms/velocity/value"],
-                                  [](auto const &p) { return p.v(); });
+    write_td_particle_property<3>(m_frames, &Frame::vel, part_prefixes,
+                                  part_totals,
+                                  datasets["particles/atoms/velocity/value"]);
   }
   if (m_fields & H5MD_OUT_FORCE) {
-    write_td_particle_property<3>(prefix, n_part_global, particles,
-                                  datasets["particles/atoms/force/value"],
-                                  [](auto const &p) { return p.force(); });
+    write_td_particle_property<3>(m_frames, &Frame::force, part_prefixes,
+                                  part_totals,
+                                  datasets["particles/atoms/force/value"]);
   }
   if (m_fields & H5MD_OUT_CHARGE) {
-    write_td_particle_property<2>(
-        prefix, n_part_global, particles,
-        datasets["particles/atoms/charge/value"],
-        [](auto const &p) { return Utils::Vector<double, 1>{p.q()}; });
+    write_td_particle_property<2>(m_frames, &Frame::charge, part_prefixes,
+                                  part_totals,
+                                  datasets["particles/atoms/charge/value"]);
   }
   if (m_fields & H5MD_OUT_BONDS) {
-    write_connectivity(particles);
+    write_connectivity(bond_prefixes, bond_totals);
   }
+  m_frames.clear();
 }
 
-void File::write_connectivity(const ParticleRange &particles) {
-  MultiArray3i bond(boost::extents[0][0][0]);
-  for (auto const &p : particles) {
-    auto nbonds_local = static_cast<decltype(bond)::index>(bond.shape()[1]);
-    for (auto const b : p.bonds()) {
-      auto const partner_ids = b.partner_ids();
-      if (partner_ids.size() == 1) {
-        bond.resize(boost::extents[1][nbonds_local + 1][2]);
-        bond[0][nbonds_local][0] = p.id();
-        bond[0][nbonds_local][1] = partner_ids[0];
-        nbonds_local++;
-      }
-    }
-  }
-
-  auto const n_bonds_local = static_cast<int>(bond.shape()[1]);
-  int prefix_bonds = 0;
-  BOOST_MPI_CHECK_RESULT(
-      MPI_Exscan, (&n_bonds_local, &prefix_bonds, 1, MPI_INT, MPI_SUM, m_comm));
+void File::write_connectivity(std::vector<int> const &prefixes,
+                              std::vector<int> const &totals) {
+  auto &dataset = datasets["connectivity/atoms/value"];
+  auto const extents = static_cast<h5xx::dataspace>(dataset).extents();
+  auto const n_frames = static_cast<hsize_t>(m_frames.size());
   auto const n_bonds_total =
-      boost::mpi::all_reduce(m_comm, n_bonds_local, std::plus<int>());
-  auto const extents =
-      static_cast<h5xx::dataspace>(datasets["connectivity/atoms/value"])
-          .extents();
-  Vector3hs offset_bonds = {extents[0], static_cast<hsize_t>(prefix_bonds), 0};
-  Vector3hs count_bonds = {1, static_cast<hsize_t>(n_bonds_local), 2};
-  auto const n_bond_diff =
-      std::max(static_cast<hsize_t>(n_bonds_total), extents[1]) - extents[1];
-  Vector3hs change_extent_bonds = {1, static_cast<hsize_t>(n_bond_diff), 0};
-  write_dataset(bond, datasets["connectivity/atoms/value"], change_extent_bonds,
-                offset_bonds, count_bonds);
+      static_cast<hsize_t>(*std::max_element(totals.begin(), totals.end()));
+  auto const n_bond_diff = std::max(n_bonds_total, extents[1]) - extents[1];
+  extend_dataset(dataset, Vector3hs{n_frames, n_bond_diff, 0});
+  for (std::size_t i = 0; i < m_frames.size(); ++i) {
+    auto const &bonds = m_frames[i].bonds;
+    auto const n_bonds_local = bonds.size() / 2;
+    if (n_bonds_local == 0)
+      continue;
+    MultiArray3i bond(boost::extents[1][n_bonds_local][2]);
+    std::copy(bonds.begin(), bonds.end(), bond.data());
+    Vector3hs offset_bonds = {extents[0] + i,
+                              static_cast<hsize_t>(prefixes[i]), 0};
+    Vector3hs count_bonds = {1, static_cast<hsize_t>(n_bonds_local), 2};
+    h5xx::write_dataset(dataset, bond, h5xx::slice(offset_bonds, count_bonds));
+  }
 }
 
-void File::flush() { m_h5md_file.flush(); }
+void File::flush() {
+  write_frames();
+  m_h5md_file.flush();
+}
 
 } /* namespace H5md */
 } /* namespace Writer */
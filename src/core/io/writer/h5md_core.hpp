@@ -39,6 +39,7 @@
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace h5xx {
 template <typename T, std::size_t size>
@@ -97,8 +98,39 @@ inline auto fields_list_to_bitfield(std::vector<std::string> const &fields) {
   return bitfield;
 }
 
+/**
+ * @brief Snapshot of the local particle data and box parameters of one
+ * time step, staged in contiguous buffers until it is written to disk.
+ * Vector quantities are stored flattened, three values per particle.
+ */
+struct Frame {
+  double time;
+  int step;
+  Utils::Vector3d box_l;
+  double le_offset;
+  int le_direction;
+  int le_normal;
+  std::vector<int> id;
+  std::vector<int> type;
+  std::vector<double> mass;
+  std::vector<double> charge;
+  std::vector<double> pos;
+  std::vector<int> image;
+  std::vector<double> vel;
+  std::vector<double> force;
+  /** Flattened pairs of bonded particle ids. */
+  std::vector<int> bonds;
+};
+
 /**
  * @brief Class for writing H5MD files.
+ *
+ * Calls to @ref write() copy the requested particle properties into
+ * staging buffers. The buffered frames are written to disk once
+ * @p buffer_size frames are pending, or when @ref flush() or @ref close()
+ * are called. Each rank then writes its particles with one contiguous
+ * hyperslab per dataset and frame, and the datasets are extended and the
+ * particle offsets are computed only once per batch of frames.
  */
 class File {
 public:
@@ -113,33 +145,50 @@ public:
    * @param force_unit The unit for force.
    * @param velocity_unit The unit for velocity.
    * @param charge_unit The unit for charge.
+   * @param buffer_size Number of frames to stage in memory before writing.
+   * @param chunk_size Number of particles per HDF5 chunk in new files.
+   * @param position_precision Absolute precision to which positions are
+   *        rounded before writing, or 0 for lossless output.
    * @param comm The MPI communicator.
    */
   File(std::string file_path, std::string script_path,
        std::vector<std::string> const &output_fields, std::string mass_unit,
        std::string length_unit, std::string time_unit, std::string force_unit,
        std::string velocity_unit, std::string charge_unit,
+       int buffer_size = 1, int chunk_size = 1000,
+       double position_precision = 0.,
        boost::mpi::communicator comm = boost::mpi::communicator())
       : m_script_path(std::move(script_path)),
         m_mass_unit(std::move(mass_unit)),
         m_length_unit(std::move(length_unit)),
         m_time_unit(std::move(time_unit)), m_force_unit(std::move(force_unit)),
         m_velocity_unit(std::move(velocity_unit)),
-        m_charge_unit(std::move(charge_unit)), m_comm(std::move(comm)),
+        m_charge_unit(std::move(charge_unit)), m_buffer_size(buffer_size),
+        m_chunk_size(chunk_size), m_position_precision(position_precision),
+        m_comm(std::move(comm)),
         m_fields(fields_list_to_bitfield(output_fields)),
         m_h5md_specification(m_fields) {
+    if (m_buffer_size <= 0) {
+      throw std::domain_error("Parameter 'buffer_size' must be > 0");
+    }
+    if (m_chunk_size <= 0) {
+      throw std::domain_error("Parameter 'chunk_size' must be > 0");
+    }
+    if (m_position_precision < 0.) {
+      throw std::domain_error("Parameter 'position_precision' must be >= 0");
+    }
     init_file(file_path);
   }
   ~File() = default;
 
   /**
-   * @brief Method to perform the renaming of the temporary file from
-   * "filename" + ".bak" to "filename".
+   * @brief Write pending frames and perform the renaming of the temporary
+   * file from "filename" + ".bak" to "filename".
    */
   void close();
 
   /**
-   * @brief Write data to the hdf5 file.
+   * @brief Stage data for writing to the hdf5 file.
    * @param particles Particle range for which to write data.
    * @param time Simulation time.
    * @param step Simulation step (monotonically increasing).
@@ -196,6 +245,24 @@ public:
    */
   auto const &charge_unit() const { return m_charge_unit; }
 
+  /**
+   * @brief Retrieve the number of frames staged before writing.
+   * @return The number of frames.
+   */
+  auto buffer_size() const { return m_buffer_size; }
+
+  /**
+   * @brief Retrieve the number of particles per HDF5 chunk.
+   * @return The chunk size.
+   */
+  auto chunk_size() const { return m_chunk_size; }
+
+  /**
+   * @brief Retrieve the precision of the lossy position compression.
+   * @return The absolute precision, or 0 for lossless output.
+   */
+  auto position_precision() const { return m_position_precision; }
+
   /**
    * @brief Build the list of valid output fields.
    * @return The list as a vector of strings.
@@ -209,7 +276,8 @@ public:
   }
 
   /**
-   * @brief Method to enforce flushing the buffer to disk.
+   * @brief Method to enforce writing the staged frames and flushing the
+   * HDF5 buffer to disk.
    */
   void flush();
 
@@ -247,11 +315,17 @@ private:
    */
   void load_datasets();
 
+  /**
+   * @brief Write all staged frames to disk and clear the staging buffers.
+   */
+  void write_frames();
   /**
    * @brief Write the particle bonds (currently only pairs).
-   * @param particles Particle range for which to write bonds.
+   * @param prefixes Global offset of the local bonds in each frame.
+   * @param totals Total number of bonds in each frame.
    */
-  void write_connectivity(const ParticleRange &particles);
+  void write_connectivity(std::vector<int> const &prefixes,
+                          std::vector<int> const &totals);
   /**
    * @brief Write the unit attributes.
    */
@@ -269,6 +343,9 @@ private:
   std::string m_force_unit;
   std::string m_velocity_unit;
   std::string m_charge_unit;
+  int m_buffer_size;
+  int m_chunk_size;
+  double m_position_precision;
   boost::mpi::communicator m_comm;
   unsigned int m_fields;
   std::string m_backup_filename;
@@ -276,6 +353,7 @@ private:
   h5xx::file m_h5md_file;
   std::unordered_map<std::string, h5xx::dataset> datasets;
   H5MD_Specification m_h5md_specification;
+  std::vector<Frame> m_frames;
 };
 
 struct incompatible_h5mdfile : public std::exception {
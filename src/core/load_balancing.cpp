@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "load_balancing.hpp"
+
+#include "config/config.hpp"
+
+#include "actor/visitors.hpp"
+#include "cell_system/CellStructureType.hpp"
+#include "cells.hpp"
+#include "communication.hpp"
+#include "electrostatics/coulomb.hpp"
+#include "errorhandling.hpp"
+#include "grid.hpp"
+#include "grid_based_algorithms/lb_interface.hpp"
+#include "instrumentation.hpp"
+#include "integrate.hpp"
+#include "magnetostatics/dipoles.hpp"
+
+#include <boost/mpi/collectives/all_reduce.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace LoadBalancing {
+
+std::vector<double> balance_splits(std::vector<double> const &splits,
+                                   std::vector<double> const &loads,
+                                   double min_width) {
+  auto const n = loads.size();
+  auto const total = std::accumulate(loads.begin(), loads.end(), 0.);
+  if (n < 2 or not(total > 0.) or static_cast<double>(n) * min_width > 1.) {
+    return splits;
+  }
+
+  std::vector<double> result(n + 1);
+  result.front() = 0.;
+  result.back() = 1.;
+
+  /* place the inner boundaries at the quantiles of the load */
+  std::size_t k = 0;
+  auto cumulated = 0.;
+  for (std::size_t j = 1; j < n; ++j) {
+    auto const target = total * static_cast<double>(j) / static_cast<double>(n);
+    while (k + 1 < n and cumulated + loads[k] < target) {
+      cumulated += loads[k];
+      ++k;
+    }
+    auto const fraction =
+        (loads[k] > 0.) ? std::min(1., (target - cumulated) / loads[k]) : 0.;
+    result[j] = splits[k] + fraction * (splits[k + 1] - splits[k]);
+  }
+
+  /* enforce the minimal width, from both ends */
+  for (std::size_t j = 1; j < n; ++j) {
+    result[j] = std::max(result[j], result[j - 1] + min_width);
+  }
+  for (std::size_t j = n - 1; j > 0; --j) {
+    result[j] = std::min(result[j], result[j + 1] - min_width);
+  }
+
+  return result;
+}
+
+namespace {
+/** Short-range time at the last rebalance. */
+double last_time = 0.;
+
+double local_load(Metric metric) {
+  if (metric == Metric::PARTICLES) {
+    return static_cast<double>(cell_structure.local_particles().size());
+  }
+  auto const time =
+      Instrumentation::local_time(Instrumentation::Timer::SHORT_RANGE);
+  /* the timers might have been reset in the meantime */
+  auto const load = (time >= last_time) ? time - last_time : time;
+  last_time = time;
+  return load;
+}
+
+bool uniform_subdomains() {
+  return std::all_of(node_grid_splits.begin(), node_grid_splits.end(),
+                     [](auto const &splits) { return splits.empty(); });
+}
+
+#ifdef ELECTROSTATICS
+/** Whether the electrostatics method distributes its data over
+ *  subdomains of equal size, or needs all particles on every rank.
+ *  Purely short-range methods are not affected by the partition.
+ */
+bool has_mesh_or_far_field_coulomb() {
+  auto result = false;
+#ifdef P3M
+  result |= has_actor_of_type<CoulombP3M>(electrostatics_actor);
+#ifdef CUDA
+  result |= has_actor_of_type<CoulombP3MGPU>(electrostatics_actor);
+#endif
+  result |=
+      has_actor_of_type<ElectrostaticLayerCorrection>(electrostatics_actor);
+#endif
+  result |= has_actor_of_type<CoulombMMM1D>(electrostatics_actor);
+#ifdef MMM1D_GPU
+  result |= has_actor_of_type<CoulombMMM1DGpu>(electrostatics_actor);
+#endif
+#ifdef SCAFACOS
+  result |= has_actor_of_type<CoulombScafacos>(electrostatics_actor);
+#endif
+  return result;
+}
+#endif
+
+#ifdef DIPOLES
+/** Whether the magnetostatics method distributes its data over
+ *  subdomains of equal size.
+ */
+bool has_mesh_or_far_field_dipoles() {
+  auto result = false;
+#ifdef DP3M
+  result |= has_actor_of_type<DipolarP3M>(magnetostatics_actor);
+#endif
+#ifdef SCAFACOS_DIPOLES
+  result |= has_actor_of_type<DipolarScafacos>(magnetostatics_actor);
+#endif
+  return result;
+}
+#endif
+
+void check_methods() {
+  if (lattice_switch != ActiveLB::NONE) {
+    throw std::runtime_error(
+        "Load balancing is not compatible with lattice-Boltzmann");
+  }
+#ifdef ELECTROSTATICS
+  if (has_mesh_or_far_field_coulomb()) {
+    throw std::runtime_error("Load balancing is not compatible with "
+                             "mesh-based or far-field electrostatics methods");
+  }
+#endif
+#ifdef DIPOLES
+  if (has_mesh_or_far_field_dipoles()) {
+    throw std::runtime_error("Load balancing is not compatible with "
+                             "mesh-based or far-field magnetostatics methods");
+  }
+#endif
+}
+} // namespace
+
+void rebalance(Metric metric) {
+  if (cell_structure.decomposition_type() !=
+      CellStructureType::CELL_STRUCTURE_REGULAR) {
+    throw std::runtime_error(
+        "Load balancing requires the regular decomposition");
+  }
+  check_methods();
+
+  auto const load = local_load(metric);
+  auto const node_pos = calc_node_pos(comm_cart);
+  auto const range = interaction_range();
+
+  auto splits = node_grid_splits;
+  for (int i = 0; i < 3; i++) {
+    auto const n = static_cast<std::size_t>(node_grid[i]);
+    if (n == 1u) {
+      continue;
+    }
+    /* load of each slab of nodes */
+    std::vector<double> local_loads(n, 0.);
+    local_loads[static_cast<std::size_t>(node_pos[i])] = load;
+    std::vector<double> loads(n);
+    boost::mpi::all_reduce(comm_cart, local_loads.data(), static_cast<int>(n),
+                           loads.data(), std::plus<double>());
+
+    if (splits[i].empty()) {
+      splits[i].resize(n + 1);
+      for (std::size_t k = 0; k <= n; ++k) {
+        splits[i][k] = static_cast<double>(k) / static_cast<double>(n);
+      }
+    }
+    /* subdomains have to hold at least one cell, with some margin
+       against round-off */
+    auto const min_width = std::max(1.001 * range / box_geo.length()[i],
+                                    0.1 / static_cast<double>(n));
+    splits[i] = balance_splits(splits[i], loads, min_width);
+  }
+
+  set_node_grid_splits(splits);
+}
+
+void sanity_checks() {
+  if (uniform_subdomains()) {
+    return;
+  }
+  try {
+    check_methods();
+  } catch (std::runtime_error const &err) {
+    runtimeErrorMsg() << err.what()
+                      << "; set the node grid to restore equal subdomains";
+  }
+}
+
+} // namespace LoadBalancing
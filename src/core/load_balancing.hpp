@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_LOAD_BALANCING_HPP
+#define CORE_LOAD_BALANCING_HPP
+/** @file
+ *  Load balancing of the regular decomposition.
+ *
+ *  The subdomain boundaries are moved along each direction independently,
+ *  such that every slab of nodes gets the same share of the load. The
+ *  partition stays rectilinear, i.e. neighboring nodes always share a full
+ *  face, which keeps the ghost communication of the regular decomposition
+ *  unchanged. Lattice-Boltzmann and the mesh-based or far-field
+ *  electrostatics and magnetostatics methods assume subdomains of equal
+ *  size and cannot be combined with it.
+ */
+
+#include <vector>
+
+namespace LoadBalancing {
+
+/** Measure of the load of a node. */
+enum class Metric : int {
+  PARTICLES, ///< number of local particles
+  TIME       ///< time spent in the short-range loop since the last rebalance
+};
+
+/** @brief Move the boundaries of a row of subdomains to equalize the load.
+ *
+ *  The load is assumed to be evenly distributed within each subdomain.
+ *  The new boundaries are the quantiles of that distribution, subject to
+ *  a minimal subdomain width.
+ *
+ *  @param splits    <tt>n + 1</tt> increasing boundaries from 0 to 1
+ *  @param loads     load of each of the @c n subdomains
+ *  @param min_width minimal width of a subdomain
+ *  @return new boundaries, or @p splits if no load was measured or the
+ *          minimal width cannot be satisfied
+ */
+std::vector<double> balance_splits(std::vector<double> const &splits,
+                                   std::vector<double> const &loads,
+                                   double min_width);
+
+/** @brief Move the subdomain boundaries according to the measured load.
+ *  Has to be called on all ranks.
+ */
+void rebalance(Metric metric);
+
+/** @brief Check that the active methods support the current subdomains. */
+void sanity_checks();
+
+} // namespace LoadBalancing
+
+#endif
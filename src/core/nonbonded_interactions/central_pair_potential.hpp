@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_NB_IA_CENTRAL_PAIR_POTENTIAL_HPP
+#define CORE_NB_IA_CENTRAL_PAIR_POTENTIAL_HPP
+
+/** \file
+ *  Sum of the isotropic short-range non-bonded potentials, i.e. all
+ *  potentials that only depend on the pair distance. Anisotropic and
+ *  charge-dependent potentials (Gay-Berne, Thole) are not included.
+ */
+
+#include "config/config.hpp"
+
+#include "nonbonded_interactions/bmhtf-nacl.hpp"
+#include "nonbonded_interactions/buckingham.hpp"
+#include "nonbonded_interactions/gaussian.hpp"
+#include "nonbonded_interactions/hat.hpp"
+#include "nonbonded_interactions/hertzian.hpp"
+#include "nonbonded_interactions/lj.hpp"
+#include "nonbonded_interactions/ljcos.hpp"
+#include "nonbonded_interactions/ljcos2.hpp"
+#include "nonbonded_interactions/ljgen.hpp"
+#include "nonbonded_interactions/morse.hpp"
+#include "nonbonded_interactions/nonbonded_interaction_data.hpp"
+#include "nonbonded_interactions/nonbonded_tab.hpp"
+#include "nonbonded_interactions/smooth_step.hpp"
+#include "nonbonded_interactions/soft_sphere.hpp"
+#include "nonbonded_interactions/wca.hpp"
+
+/** Evaluate the force factor of the isotropic potentials analytically,
+ *  skipping those not flagged in @p kernels.
+ */
+inline double calc_central_pair_force_factor(IA_parameters const &ia_params,
+                                             unsigned const kernels,
+                                             double const dist) {
+  double force_factor = 0;
+/* Lennard-Jones */
+#ifdef LENNARD_JONES
+  if (kernels & NB_LJ)
+    force_factor += lj_pair_force_factor(ia_params, dist);
+#endif
+/* WCA */
+#ifdef WCA
+  if (kernels & NB_WCA)
+    force_factor += wca_pair_force_factor(ia_params, dist);
+#endif
+/* Lennard-Jones generic */
+#ifdef LENNARD_JONES_GENERIC
+  if (kernels & NB_LJGEN)
+    force_factor += ljgen_pair_force_factor(ia_params, dist);
+#endif
+/* smooth step */
+#ifdef SMOOTH_STEP
+  if (kernels & NB_SMOOTH_STEP)
+    force_factor += SmSt_pair_force_factor(ia_params, dist);
+#endif
+/* Hertzian force */
+#ifdef HERTZIAN
+  if (kernels & NB_HERTZIAN)
+    force_factor += hertzian_pair_force_factor(ia_params, dist);
+#endif
+/* Gaussian force */
+#ifdef GAUSSIAN
+  if (kernels & NB_GAUSSIAN)
+    force_factor += gaussian_pair_force_factor(ia_params, dist);
+#endif
+/* BMHTF NaCl */
+#ifdef BMHTF_NACL
+  if (kernels & NB_BMHTF)
+    force_factor += BMHTF_pair_force_factor(ia_params, dist);
+#endif
+/* Buckingham*/
+#ifdef BUCKINGHAM
+  if (kernels & NB_BUCKINGHAM)
+    force_factor += buck_pair_force_factor(ia_params, dist);
+#endif
+/* Morse*/
+#ifdef MORSE
+  if (kernels & NB_MORSE)
+    force_factor += morse_pair_force_factor(ia_params, dist);
+#endif
+/*soft-sphere potential*/
+#ifdef SOFT_SPHERE
+  if (kernels & NB_SOFT_SPHERE)
+    force_factor += soft_pair_force_factor(ia_params, dist);
+#endif
+/*hat potential*/
+#ifdef HAT
+  if (kernels & NB_HAT)
+    force_factor += hat_pair_force_factor(ia_params, dist);
+#endif
+/* Lennard-Jones cosine */
+#ifdef LJCOS
+  if (kernels & NB_LJCOS)
+    force_factor += ljcos_pair_force_factor(ia_params, dist);
+#endif
+/* Lennard-Jones cosine */
+#ifdef LJCOS2
+  if (kernels & NB_LJCOS2)
+    force_factor += ljcos2_pair_force_factor(ia_params, dist);
+#endif
+/* tabulated */
+#ifdef TABULATED
+  if (kernels & NB_TABULATED)
+    force_factor += tabulated_pair_force_factor(ia_params, dist);
+#endif
+  return force_factor;
+}
+
+/** Evaluate the energy of the isotropic potentials analytically,
+ *  skipping those not flagged in @p kernels.
+ */
+inline double calc_central_pair_energy(IA_parameters const &ia_params,
+                                       unsigned const kernels,
+                                       double const dist) {
+  double ret = 0;
+#ifdef LENNARD_JONES
+  /* Lennard-Jones */
+  if (kernels & NB_LJ)
+    ret += lj_pair_energy(ia_params, dist);
+#endif
+#ifdef WCA
+  /* WCA */
+  if (kernels & NB_WCA)
+    ret += wca_pair_energy(ia_params, dist);
+#endif
+#ifdef LENNARD_JONES_GENERIC
+  /* Generic Lennard-Jones */
+  if (kernels & NB_LJGEN)
+    ret += ljgen_pair_energy(ia_params, dist);
+#endif
+#ifdef SMOOTH_STEP
+  /* smooth step */
+  if (kernels & NB_SMOOTH_STEP)
+    ret += SmSt_pair_energy(ia_params, dist);
+#endif
+#ifdef HERTZIAN
+  /* Hertzian potential */
+  if (kernels & NB_HERTZIAN)
+    ret += hertzian_pair_energy(ia_params, dist);
+#endif
+#ifdef GAUSSIAN
+  /* Gaussian potential */
+  if (kernels & NB_GAUSSIAN)
+    ret += gaussian_pair_energy(ia_params, dist);
+#endif
+#ifdef BMHTF_NACL
+  /* BMHTF NaCl */
+  if (kernels & NB_BMHTF)
+    ret += BMHTF_pair_energy(ia_params, dist);
+#endif
+#ifdef MORSE
+  /* Morse */
+  if (kernels & NB_MORSE)
+    ret += morse_pair_energy(ia_params, dist);
+#endif
+#ifdef BUCKINGHAM
+  /* Buckingham */
+  if (kernels & NB_BUCKINGHAM)
+    ret += buck_pair_energy(ia_params, dist);
+#endif
+#ifdef SOFT_SPHERE
+  /* soft-sphere */
+  if (kernels & NB_SOFT_SPHERE)
+    ret += soft_pair_energy(ia_params, dist);
+#endif
+#ifdef HAT
+  /* hat */
+  if (kernels & NB_HAT)
+    ret += hat_pair_energy(ia_params, dist);
+#endif
+#ifdef LJCOS2
+  /* Lennard-Jones */
+  if (kernels & NB_LJCOS2)
+    ret += ljcos2_pair_energy(ia_params, dist);
+#endif
+#ifdef TABULATED
+  /* tabulated */
+  if (kernels & NB_TABULATED)
+    ret += tabulated_pair_energy(ia_params, dist);
+#endif
+#ifdef LJCOS
+  /* Lennard-Jones cosine */
+  if (kernels & NB_LJCOS)
+    ret += ljcos_pair_energy(ia_params, dist);
+#endif
+  return ret;
+}
+
+/** Force factor of the isotropic potentials, from the spline table
+ *  if one covers @p dist.
+ */
+inline double central_pair_force_factor(IA_pair_entry const &entry,
+                                        double const dist) {
+  auto const &ia_params = *entry.params;
+  if ((entry.kernels & NB_CENTRAL_TABLE) and
+      ia_params.central_table.covers(dist)) {
+    return ia_params.central_table.force_factor(dist);
+  }
+  return calc_central_pair_force_factor(ia_params, entry.kernels, dist);
+}
+
+/** Energy of the isotropic potentials, from the spline table if one
+ *  covers @p dist.
+ */
+inline double central_pair_energy(IA_pair_entry const &entry,
+                                  double const dist) {
+  auto const &ia_params = *entry.params;
+  if ((entry.kernels & NB_CENTRAL_TABLE) and
+      ia_params.central_table.covers(dist)) {
+    return ia_params.central_table.energy(dist);
+  }
+  return calc_central_pair_energy(ia_params, entry.kernels, dist);
+}
+
+#endif
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_NB_IA_CENTRAL_PAIR_TABLE_HPP
+#define CORE_NB_IA_CENTRAL_PAIR_TABLE_HPP
+
+/** \file
+ *  Cubic spline tables of the central part of the non-bonded interactions.
+ *
+ *  The sum of all isotropic short-range potentials of a pair of particle
+ *  types is sampled once with its exact derivative, and interpolated
+ *  by a cubic Hermite spline. Forces are computed from the derivative
+ *  of the same spline, so that forces and energies remain consistent.
+ *  The potentials jump at their cutoffs, hence the range is split into
+ *  pieces at the cutoffs and each piece is interpolated separately.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/** Cubic Hermite spline of a central pair potential. */
+struct CentralPairTable {
+  /** Distance of the first tabulated value. */
+  double minval = -1.0;
+  /** Distance of the last tabulated value. */
+  double maxval = -1.0;
+
+  CentralPairTable() = default;
+
+  /**
+   * @brief Sample a central potential.
+   * The potential is continuous inside each piece between two consecutive
+   * values of @p breaks. The intervals are distributed over the pieces in
+   * proportion to their length, with at least one interval per piece.
+   * @param minval    Smallest tabulated distance
+   * @param maxval    Largest tabulated distance
+   * @param n_points  Number of intervals
+   * @param force     Force magnitude @f$ -U'(r) @f$
+   * @param energy    Potential @f$ U(r) @f$
+   * @param breaks    Distances at which the potential may be discontinuous,
+   *                  values outside of (@p minval, @p maxval) are ignored
+   */
+  template <class Force, class Energy>
+  CentralPairTable(double minval, double maxval, int n_points,
+                   Force const &force, Energy const &energy,
+                   std::vector<double> breaks = {})
+      : minval{minval}, maxval{maxval} {
+    assert(n_points > 0 and maxval > minval);
+    breaks.erase(std::remove_if(breaks.begin(), breaks.end(),
+                                [minval, maxval](double r) {
+                                  return r <= minval or r >= maxval;
+                                }),
+                 breaks.end());
+    breaks.push_back(maxval);
+    std::sort(breaks.begin(), breaks.end());
+    breaks.erase(std::unique(breaks.begin(), breaks.end()), breaks.end());
+
+    auto lo = minval;
+    for (auto const hi : breaks) {
+      auto const fraction = (hi - lo) / (maxval - minval);
+      auto const n =
+          std::max(1, static_cast<int>(std::lround(n_points * fraction)));
+      add_piece(lo, hi, n, force, energy);
+      lo = hi;
+    }
+  }
+
+  /** Whether distance @p dist is inside the tabulated range. */
+  bool covers(double dist) const { return dist >= minval and dist < maxval; }
+
+  /** Evaluate the energy, @p dist must be inside the tabulated range. */
+  double energy(double dist) const {
+    double t;
+    auto const c = interval(dist, t);
+    return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+  }
+
+  /** Evaluate the force factor @f$ -U'(r)/r @f$, @p dist must be inside
+   *  the tabulated range.
+   */
+  double force_factor(double dist) const {
+    double t;
+    auto const &piece = find_piece(dist);
+    auto const c = interval(piece, dist, t);
+    auto const du =
+        (c[1] + t * (2. * c[2] + 3. * t * c[3])) * piece.invstepsize;
+    return -du / dist;
+  }
+
+private:
+  /** Range between two discontinuities, with equidistant knots. */
+  struct Piece {
+    /** Distance of the first knot. */
+    double minval;
+    /** Distance of the last knot. */
+    double maxval;
+    /** Inverse of the distance between knots. */
+    double invstepsize;
+    /** Number of intervals. */
+    int n_points;
+    /** Index of the first interval in @ref coeffs. */
+    std::size_t offset;
+  };
+
+  std::vector<Piece> pieces;
+  /** Polynomial coefficients of the energy, 4 per interval. */
+  std::vector<double> coeffs;
+
+  template <class Force, class Energy>
+  void add_piece(double lo, double hi, int n_points, Force const &force,
+                 Energy const &energy) {
+    auto const step = (hi - lo) / n_points;
+    auto const offset = coeffs.size() / 4ul;
+    pieces.push_back({lo, hi, 1. / step, n_points, offset});
+    coeffs.resize(coeffs.size() + 4ul * static_cast<std::size_t>(n_points));
+    // the potentials are cut off for distances >= hi, the last knot
+    // takes the limit from below
+    auto const r_last = std::nextafter(hi, lo);
+    auto u_lo = energy(lo);
+    auto du_lo = -force(lo) * step;
+    for (int i = 0; i < n_points; ++i) {
+      auto const r_hi = (i + 1 == n_points) ? r_last : lo + (i + 1) * step;
+      auto const u_hi = energy(r_hi);
+      auto const du_hi = -force(r_hi) * step;
+      auto *c = coeffs.data() + 4ul * (offset + static_cast<std::size_t>(i));
+      c[0] = u_lo;
+      c[1] = du_lo;
+      c[2] = 3. * (u_hi - u_lo) - 2. * du_lo - du_hi;
+      c[3] = 2. * (u_lo - u_hi) + du_lo + du_hi;
+      u_lo = u_hi;
+      du_lo = du_hi;
+    }
+  }
+
+  Piece const &find_piece(double dist) const {
+    assert(covers(dist));
+    // there are only a few pieces, one per distinct cutoff
+    auto const it = std::find_if(
+        pieces.begin(), pieces.end(),
+        [dist](Piece const &piece) { return dist < piece.maxval; });
+    assert(it != pieces.end());
+    return *it;
+  }
+
+  double const *interval(Piece const &piece, double dist, double &t) const {
+    auto const x = (dist - piece.minval) * piece.invstepsize;
+    auto const i = std::min(static_cast<int>(x), piece.n_points - 1);
+    t = x - i;
+    return coeffs.data() + 4ul * (piece.offset + static_cast<std::size_t>(i));
+  }
+
+  double const *interval(double dist, double &t) const {
+    return interval(find_piece(dist), dist, t);
+  }
+};
+
+#endif
@@ -26,11 +26,13 @@
 #include "communication.hpp"
 #include "electrostatics/coulomb.hpp"
 #include "event.hpp"
+#include "nonbonded_interactions/central_pair_potential.hpp"
 
 #include <utils/index.hpp>
 
 #include <algorithm>
 #include <memory>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -39,6 +41,7 @@
  *****************************************/
 int max_seen_particle_type = 0;
 std::vector<std::shared_ptr<IA_parameters>> nonbonded_ia_params;
+std::vector<IA_pair_entry> nonbonded_ia_table;
 
 /** Minimal global interaction cutoff. Particles with a distance
  *  smaller than this are guaranteed to be available on the same node
@@ -46,10 +49,92 @@ std::vector<std::shared_ptr<IA_parameters>> nonbonded_ia_params;
  */
 static double min_global_cut = INACTIVE_CUTOFF;
 
+/** Smallest tabulated distance of the isotropic potentials. */
+static double central_tables_r_min = 0.;
+/** Number of spline intervals of the isotropic potentials. */
+static int central_tables_n_points = 0;
+
 /*****************************************
  * general low-level functions
  *****************************************/
 
+/** Potentials of a type pair which can contribute at any distance. */
+static unsigned active_kernels(IA_parameters const &data) {
+  auto kernels = 0u;
+  auto const flag = [&kernels](unsigned kernel, double cutoff) {
+    if (cutoff > 0.)
+      kernels |= kernel;
+  };
+
+#ifdef LENNARD_JONES
+  flag(NB_LJ, data.lj.max_cutoff());
+#endif
+#ifdef WCA
+  flag(NB_WCA, data.wca.max_cutoff());
+#endif
+#ifdef LENNARD_JONES_GENERIC
+  flag(NB_LJGEN, data.ljgen.max_cutoff());
+#endif
+#ifdef SMOOTH_STEP
+  flag(NB_SMOOTH_STEP, data.smooth_step.max_cutoff());
+#endif
+#ifdef HERTZIAN
+  flag(NB_HERTZIAN, data.hertzian.max_cutoff());
+#endif
+#ifdef GAUSSIAN
+  flag(NB_GAUSSIAN, data.gaussian.max_cutoff());
+#endif
+#ifdef BMHTF_NACL
+  flag(NB_BMHTF, data.bmhtf.max_cutoff());
+#endif
+#ifdef MORSE
+  flag(NB_MORSE, data.morse.max_cutoff());
+#endif
+#ifdef BUCKINGHAM
+  flag(NB_BUCKINGHAM, data.buckingham.max_cutoff());
+#endif
+#ifdef SOFT_SPHERE
+  flag(NB_SOFT_SPHERE, data.soft_sphere.max_cutoff());
+#endif
+#ifdef HAT
+  flag(NB_HAT, data.hat.max_cutoff());
+#endif
+#ifdef LJCOS
+  flag(NB_LJCOS, data.ljcos.max_cutoff());
+#endif
+#ifdef LJCOS2
+  flag(NB_LJCOS2, data.ljcos2.max_cutoff());
+#endif
+#ifdef TABULATED
+  flag(NB_TABULATED, data.tab.cutoff());
+#endif
+  flag(NB_CENTRAL_TABLE, data.central_table.maxval);
+#ifdef GAY_BERNE
+  flag(NB_GAY_BERNE, data.gay_berne.max_cutoff());
+#endif
+#ifdef THOLE
+  if (data.thole.scaling_coeff != 0.)
+    kernels |= NB_THOLE;
+#endif
+#ifdef DPD
+  flag(NB_DPD, data.dpd.max_cutoff());
+#endif
+
+  return kernels;
+}
+
+void update_nonbonded_ia_table() {
+  auto const size = ::max_seen_particle_type;
+  ::nonbonded_ia_table.resize(static_cast<std::size_t>(size * size));
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      auto const &data = *::nonbonded_ia_params[get_ia_param_key(i, j)];
+      ::nonbonded_ia_table[i * size + j] =
+          IA_pair_entry{&data, data.max_cut, active_kernels(data)};
+    }
+  }
+}
+
 void mpi_realloc_ia_params_local(int new_size) {
   auto const old_size = ::max_seen_particle_type;
   if (new_size <= old_size)
@@ -74,75 +159,92 @@ void mpi_realloc_ia_params_local(int new_size) {
 
   ::max_seen_particle_type = new_size;
   ::nonbonded_ia_params = std::move(new_params);
+  update_nonbonded_ia_table();
 }
 
 REGISTER_CALLBACK(mpi_realloc_ia_params_local)
 
-static double recalc_maximal_cutoff(const IA_parameters &data) {
-  auto max_cut_current = INACTIVE_CUTOFF;
+/** Cutoffs of the isotropic potentials, where they may be discontinuous. */
+static std::vector<double> central_cutoffs(const IA_parameters &data) {
+  std::vector<double> cutoffs;
 
 #ifdef LENNARD_JONES
-  max_cut_current = std::max(max_cut_current, data.lj.max_cutoff());
+  cutoffs.push_back(data.lj.max_cutoff());
 #endif
 
 #ifdef WCA
-  max_cut_current = std::max(max_cut_current, data.wca.max_cutoff());
-#endif
-
-#ifdef DPD
-  max_cut_current = std::max(max_cut_current, data.dpd.max_cutoff());
+  cutoffs.push_back(data.wca.max_cutoff());
 #endif
 
 #ifdef LENNARD_JONES_GENERIC
-  max_cut_current = std::max(max_cut_current, data.ljgen.max_cutoff());
+  cutoffs.push_back(data.ljgen.max_cutoff());
 #endif
 
 #ifdef SMOOTH_STEP
-  max_cut_current = std::max(max_cut_current, data.smooth_step.max_cutoff());
+  cutoffs.push_back(data.smooth_step.max_cutoff());
 #endif
 
 #ifdef HERTZIAN
-  max_cut_current = std::max(max_cut_current, data.hertzian.max_cutoff());
+  cutoffs.push_back(data.hertzian.max_cutoff());
 #endif
 
 #ifdef GAUSSIAN
-  max_cut_current = std::max(max_cut_current, data.gaussian.max_cutoff());
+  cutoffs.push_back(data.gaussian.max_cutoff());
 #endif
 
 #ifdef BMHTF_NACL
-  max_cut_current = std::max(max_cut_current, data.bmhtf.max_cutoff());
+  cutoffs.push_back(data.bmhtf.max_cutoff());
 #endif
 
 #ifdef MORSE
-  max_cut_current = std::max(max_cut_current, data.morse.max_cutoff());
+  cutoffs.push_back(data.morse.max_cutoff());
 #endif
 
 #ifdef BUCKINGHAM
-  max_cut_current = std::max(max_cut_current, data.buckingham.max_cutoff());
+  cutoffs.push_back(data.buckingham.max_cutoff());
 #endif
 
 #ifdef SOFT_SPHERE
-  max_cut_current = std::max(max_cut_current, data.soft_sphere.max_cutoff());
+  cutoffs.push_back(data.soft_sphere.max_cutoff());
 #endif
 
 #ifdef HAT
-  max_cut_current = std::max(max_cut_current, data.hat.max_cutoff());
+  cutoffs.push_back(data.hat.max_cutoff());
 #endif
 
 #ifdef LJCOS
-  max_cut_current = std::max(max_cut_current, data.ljcos.max_cutoff());
+  cutoffs.push_back(data.ljcos.max_cutoff());
 #endif
 
 #ifdef LJCOS2
-  max_cut_current = std::max(max_cut_current, data.ljcos2.max_cutoff());
+  cutoffs.push_back(data.ljcos2.max_cutoff());
 #endif
 
-#ifdef GAY_BERNE
-  max_cut_current = std::max(max_cut_current, data.gay_berne.max_cutoff());
+#ifdef TABULATED
+  cutoffs.push_back(data.tab.cutoff());
 #endif
 
-#ifdef TABULATED
-  max_cut_current = std::max(max_cut_current, data.tab.cutoff());
+  return cutoffs;
+}
+
+/** Largest cutoff of the isotropic potentials. */
+static double recalc_central_cutoff(const IA_parameters &data) {
+  auto max_cut_current = INACTIVE_CUTOFF;
+  for (auto const cutoff : central_cutoffs(data)) {
+    max_cut_current = std::max(max_cut_current, cutoff);
+  }
+  return max_cut_current;
+}
+
+static double recalc_maximal_cutoff(const IA_parameters &data) {
+  auto max_cut_current = recalc_central_cutoff(data);
+
+#ifdef DPD
+  max_cut_current = std::max(max_cut_current, data.dpd.max_cutoff());
+#endif
+
+#ifdef GAY_BERNE
+  max_cut_current = std::max(max_cut_current, data.gay_berne.max_cutoff());
 #endif
 
 #ifdef THOLE
@@ -161,6 +263,7 @@ double maximal_cutoff_nonbonded() {
     data->max_cut = recalc_maximal_cutoff(*data);
     max_cut_nonbonded = std::max(max_cut_nonbonded, data->max_cut);
   }
+  update_nonbonded_ia_table();
 
   return max_cut_nonbonded;
 }
@@ -185,3 +288,40 @@ void set_min_global_cut(double min_global_cut) {
 }
 
 double get_min_global_cut() { return ::min_global_cut; }
+
+void set_central_pair_tables(double r_min, int n_points) {
+  if (n_points < 0) {
+    throw std::domain_error("Parameter 'n_points' must be >= 0");
+  }
+  if (n_points > 0 and r_min <= 0.) {
+    throw std::domain_error("Parameter 'r_min' must be > 0");
+  }
+  ::central_tables_r_min = r_min;
+  ::central_tables_n_points = n_points;
+  on_non_bonded_ia_change();
+}
+
+double get_central_pair_tables_r_min() { return ::central_tables_r_min; }
+
+int get_central_pair_tables_n_points() { return ::central_tables_n_points; }
+
+void update_central_pair_tables() {
+  for (auto &data : nonbonded_ia_params) {
+    data->central_table = CentralPairTable{};
+    auto const cutoff = recalc_central_cutoff(*data);
+    if (::central_tables_n_points == 0 or cutoff <= ::central_tables_r_min) {
+      continue;
+    }
+    auto const &ia_params = *data;
+    auto const kernels = active_kernels(ia_params);
+    data->central_table = CentralPairTable(
+        ::central_tables_r_min, cutoff, ::central_tables_n_points,
+        [&ia_params, kernels](double r) {
+          return r * calc_central_pair_force_factor(ia_params, kernels, r);
+        },
+        [&ia_params, kernels](double r) {
+          return calc_central_pair_energy(ia_params, kernels, r);
+        },
+        central_cutoffs(ia_params));
+  }
+}
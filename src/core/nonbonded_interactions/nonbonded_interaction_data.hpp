@@ -26,6 +26,7 @@
 
 #include "TabulatedPotential.hpp"
 #include "config/config.hpp"
+#include "nonbonded_interactions/central_pair_table.hpp"
 
 #include <utils/index.hpp>
 #include <utils/math/int_pow.hpp>
@@ -353,6 +354,11 @@ struct IA_parameters {
 #ifdef THOLE
   Thole_Parameters thole;
 #endif
+
+  /** Spline table of the isotropic potentials, see
+   *  @ref set_central_pair_tables.
+   */
+  CentralPairTable central_table;
 };
 
 extern std::vector<std::shared_ptr<IA_parameters>> nonbonded_ia_params;
@@ -387,6 +393,65 @@ inline IA_parameters &get_ia_param(int i, int j) {
   return *::nonbonded_ia_params[get_ia_param_key(i, j)];
 }
 
+/** Bit flags of the potentials that are active for a pair of types. */
+enum NonBondedKernel : unsigned {
+  NB_LJ = 1u << 0,
+  NB_WCA = 1u << 1,
+  NB_LJGEN = 1u << 2,
+  NB_SMOOTH_STEP = 1u << 3,
+  NB_HERTZIAN = 1u << 4,
+  NB_GAUSSIAN = 1u << 5,
+  NB_BMHTF = 1u << 6,
+  NB_MORSE = 1u << 7,
+  NB_BUCKINGHAM = 1u << 8,
+  NB_SOFT_SPHERE = 1u << 9,
+  NB_HAT = 1u << 10,
+  NB_LJCOS = 1u << 11,
+  NB_LJCOS2 = 1u << 12,
+  NB_TABULATED = 1u << 13,
+  NB_CENTRAL_TABLE = 1u << 14,
+  NB_GAY_BERNE = 1u << 15,
+  NB_THOLE = 1u << 16,
+  NB_DPD = 1u << 17,
+};
+
+/** @brief Compact entry of the dense type-pair interaction table.
+ *
+ *  Holds what the pair kernels need before touching the full
+ *  @ref IA_parameters: the combined cutoff and which potentials
+ *  are active for this pair of types.
+ */
+struct IA_pair_entry {
+  /** Parameters of the type pair. */
+  IA_parameters const *params = nullptr;
+  /** Combined cutoff, see @ref IA_parameters::max_cut. */
+  double max_cut = INACTIVE_CUTOFF;
+  /** Active potentials, a combination of @ref NonBondedKernel flags. */
+  unsigned kernels = 0u;
+};
+
+/** Dense, symmetric table of the type-pair interactions, with
+ *  @ref max_seen_particle_type rows. It is rebuilt whenever the
+ *  cutoffs are recalculated or a new particle type appears, and
+ *  must not be modified otherwise.
+ */
+extern std::vector<IA_pair_entry> nonbonded_ia_table;
+
+/** @brief Rebuild @ref nonbonded_ia_table from the current parameters. */
+void update_nonbonded_ia_table();
+
+/**
+ * @brief Get the compiled interaction table entry of types i and j.
+ *
+ * @param i First type, has to be smaller than @ref max_seen_particle_type.
+ * @param j Second type, has to be smaller than @ref max_seen_particle_type.
+ */
+inline IA_pair_entry const &get_ia_pair_entry(int i, int j) {
+  assert(i >= 0 && i < ::max_seen_particle_type);
+  assert(j >= 0 && j < ::max_seen_particle_type);
+  return ::nonbonded_ia_table[i * ::max_seen_particle_type + j];
+}
+
 void mpi_realloc_ia_params_local(int new_size);
 
 bool is_new_particle_type(int type);
@@ -399,11 +464,33 @@ void make_particle_type_exist(int type);
 void make_particle_type_exist_local(int type);
 
 /** Check if a non-bonded interaction is defined */
-inline bool checkIfInteraction(IA_parameters const &data) {
-  return data.max_cut != INACTIVE_CUTOFF;
+inline bool checkIfInteraction(IA_pair_entry const &entry) {
+  return entry.max_cut != INACTIVE_CUTOFF;
 }
 
 void set_min_global_cut(double min_global_cut);
 
 double get_min_global_cut();
+
+/** @brief Tabulate the isotropic potentials of all pairs of particle types.
+ *
+ *  The sum of all potentials that only depend on the pair distance is
+ *  replaced by a cubic spline between @p r_min and the largest cutoff of
+ *  these potentials. Distances below @p r_min are still evaluated
+ *  analytically. The tables are rebuilt on every call to
+ *  @ref on_non_bonded_ia_change.
+ *
+ *  @param r_min     Smallest tabulated distance
+ *  @param n_points  Number of spline intervals, 0 to disable tabulation
+ */
+void set_central_pair_tables(double r_min, int n_points);
+
+/** @brief Smallest tabulated distance of the isotropic potentials. */
+double get_central_pair_tables_r_min();
+
+/** @brief Number of spline intervals of the isotropic potentials. */
+int get_central_pair_tables_n_points();
+
+/** @brief Rebuild the spline tables of all pairs of particle types. */
+void update_central_pair_tables();
 #endif
@@ -22,6 +22,7 @@
 #include "BoxGeometry.hpp"
 #include "Particle.hpp"
 #include "cell_system/CellStructure.hpp"
+#include "communication.hpp"
 #include "grid.hpp"
 
 #include "bonded_interactions/bonded_interaction_data.hpp"
@@ -31,91 +32,114 @@
 #include <utils/constants.hpp>
 #include <utils/math/triangle_functions.hpp>
 
+#include <boost/mpi/collectives/all_reduce.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
 int max_oif_objects = 0;
 
-Utils::Vector2d calc_oif_global(int molType, CellStructure &cs) {
+namespace {
+/** Triangle of a mesh, with positions unfolded relative to the first
+ *  vertex. Returns nullptr if the bond is not an OIF global forces bond
+ *  or if the particle does not belong to one of the first @p n_objects
+ *  objects.
+ */
+OifGlobalForcesBond const *
+oif_triangle(Particle const &p1, int bond_id, Utils::Span<Particle *> partners,
+             int n_objects, Utils::Vector3d &p11, Utils::Vector3d &p22,
+             Utils::Vector3d &p33) {
+  if (p1.mol_id() < 0 or p1.mol_id() >= n_objects)
+    return nullptr;
+
+  auto const *iaparams =
+      boost::get<OifGlobalForcesBond>(bonded_ia_params.at(bond_id).get());
+  if (iaparams == nullptr)
+    return nullptr;
+
   // first-fold-then-the-same approach
-  double partArea = 0.0;
-  // z volume
-  double VOL_partVol = 0.;
-
-  cs.bond_loop([&partArea, &VOL_partVol,
-                molType](Particle &p1, int bond_id,
-                         Utils::Span<Particle *> partners) {
-    if (p1.mol_id() != molType)
-      return false;
+  p11 = unfolded_position(p1.pos(), p1.image_box(), box_geo.length());
+  p22 = p11 + box_geo.get_mi_vector(partners[0]->pos(), p11);
+  p33 = p11 + box_geo.get_mi_vector(partners[1]->pos(), p11);
+  return iaparams;
+}
+} // namespace
 
-    if (boost::get<OifGlobalForcesBond>(bonded_ia_params.at(bond_id).get()) !=
-        nullptr) {
-      // remaining neighbors fetched
-      auto const p11 =
-          unfolded_position(p1.pos(), p1.image_box(), box_geo.length());
-      auto const p22 = p11 + box_geo.get_mi_vector(partners[0]->pos(), p11);
-      auto const p33 = p11 + box_geo.get_mi_vector(partners[1]->pos(), p11);
+std::vector<double> calc_oif_global(int n_objects, CellStructure &cs) {
+  // partial area and z volume of each object, stored contiguously
+  std::vector<double> partial(2 * static_cast<std::size_t>(n_objects), 0.);
 
-      // unfolded positions correct
+  cs.bond_loop([&partial, n_objects](Particle &p1, int bond_id,
+                                     Utils::Span<Particle *> partners) {
+    Utils::Vector3d p11, p22, p33;
+    if (oif_triangle(p1, bond_id, partners, n_objects, p11, p22, p33)) {
       auto const VOL_A = Utils::area_triangle(p11, p22, p33);
-      partArea += VOL_A;
-
       auto const VOL_norm = Utils::get_n_triangle(p11, p22, p33);
       auto const VOL_dn = VOL_norm.norm();
       auto const VOL_hz = 1.0 / 3.0 * (p11[2] + p22[2] + p33[2]);
-      VOL_partVol -= VOL_A * VOL_norm[2] / VOL_dn * VOL_hz;
+      auto const i = 2 * static_cast<std::size_t>(p1.mol_id());
+      partial[i + 0] += VOL_A;
+      partial[i + 1] -= VOL_A * VOL_norm[2] / VOL_dn * VOL_hz;
     }
-
     return false;
   });
 
-  return {{partArea, VOL_partVol}};
+  // a single reduction for all objects
+  std::vector<double> area_volume(partial.size());
+  boost::mpi::all_reduce(comm_cart, partial.data(),
+                         static_cast<int>(partial.size()), area_volume.data(),
+                         std::plus<double>());
+  return area_volume;
 }
 
-void add_oif_global_forces(Utils::Vector2d const &area_volume, int molType,
+void add_oif_global_forces(std::vector<double> const &area_volume,
                            CellStructure &cs) {
-  // first-fold-then-the-same approach
-  double area = area_volume[0];
-  double VOL_volume = area_volume[1];
-
-  cs.bond_loop([area, VOL_volume, molType](Particle &p1, int bond_id,
-                                           Utils::Span<Particle *> partners) {
-    if (p1.mol_id() != molType)
+  auto const n_objects = static_cast<int>(area_volume.size() / 2);
+
+  cs.bond_loop([&area_volume, n_objects](Particle &p1, int bond_id,
+                                         Utils::Span<Particle *> partners) {
+    Utils::Vector3d p11, p22, p33;
+    auto const *iaparams =
+        oif_triangle(p1, bond_id, partners, n_objects, p11, p22, p33);
+    if (iaparams == nullptr)
       return false;
 
-    if (auto const *iaparams = boost::get<OifGlobalForcesBond>(
-            bonded_ia_params.at(bond_id).get())) {
-      auto const p11 =
-          unfolded_position(p1.pos(), p1.image_box(), box_geo.length());
-      auto const p22 = p11 + box_geo.get_mi_vector(partners[0]->pos(), p11);
-      auto const p33 = p11 + box_geo.get_mi_vector(partners[1]->pos(), p11);
+    auto const i = 2 * static_cast<std::size_t>(p1.mol_id());
+    auto const area = area_volume[i + 0];
+    auto const VOL_volume = area_volume[i + 1];
+    // skip objects that are not present in the system
+    if (std::abs(area) < 1e-100 and std::abs(VOL_volume) < 1e-100)
+      return false;
 
-      // unfolded positions correct
-      // starting code from volume force
-      auto const VOL_norm = Utils::get_n_triangle(p11, p22, p33).normalize();
-      auto const VOL_A = Utils::area_triangle(p11, p22, p33);
-      auto const VOL_vv = (VOL_volume - iaparams->V0) / iaparams->V0;
+    // starting code from volume force
+    auto const VOL_norm = Utils::get_n_triangle(p11, p22, p33).normalize();
+    auto const VOL_A = Utils::area_triangle(p11, p22, p33);
+    auto const VOL_vv = (VOL_volume - iaparams->V0) / iaparams->V0;
 
-      auto const VOL_force =
-          (1.0 / 3.0) * iaparams->kv * VOL_vv * VOL_A * VOL_norm;
+    auto const VOL_force =
+        (1.0 / 3.0) * iaparams->kv * VOL_vv * VOL_A * VOL_norm;
 
-      auto const h = (1. / 3.) * (p11 + p22 + p33);
+    auto const h = (1. / 3.) * (p11 + p22 + p33);
 
-      auto const deltaA = (area - iaparams->A0_g) / iaparams->A0_g;
+    auto const deltaA = (area - iaparams->A0_g) / iaparams->A0_g;
 
-      auto const m1 = h - p11;
-      auto const m2 = h - p22;
-      auto const m3 = h - p33;
+    auto const m1 = h - p11;
+    auto const m2 = h - p22;
+    auto const m3 = h - p33;
 
-      auto const m1_length = m1.norm();
-      auto const m2_length = m2.norm();
-      auto const m3_length = m3.norm();
+    auto const m1_length = m1.norm();
+    auto const m2_length = m2.norm();
+    auto const m3_length = m3.norm();
 
-      auto const fac = iaparams->ka_g * VOL_A * deltaA /
-                       (m1_length * m1_length + m2_length * m2_length +
-                        m3_length * m3_length);
+    auto const fac = iaparams->ka_g * VOL_A * deltaA /
+                     (m1_length * m1_length + m2_length * m2_length +
+                      m3_length * m3_length);
 
-      p1.force() += fac * m1 + VOL_force;
-      partners[0]->force() += fac * m2 + VOL_force;
-      partners[1]->force() += fac * m3 + VOL_force;
-    }
+    p1.force() += fac * m1 + VOL_force;
+    partners[0]->force() += fac * m2 + VOL_force;
+    partners[1]->force() += fac * m3 + VOL_force;
 
     return false;
   });
@@ -26,19 +26,20 @@
 #include "cell_system/CellStructure.hpp"
 #include "oif_global_forces_params.hpp"
 
-#include <utils/Vector.hpp>
+#include <vector>
 
-/** Calculate the OIF global force.
+/** Calculate the OIF global area and volume of all objects.
  *  Called in force_calc() from within forces.cpp
- *  - calculates the global area and global volume for a cell before the forces
- *    are handled
- *  - MPI synchronization with all reduce
- *  - !!! loop over particles from regular_decomposition !!!
+ *  - calculates the partial areas and volumes of the first @p n_objects
+ *    objects in a single pass over the local bonds
+ *  - MPI synchronization with one all reduce for all objects
+ *  @return global area and volume of object @c i at indices
+ *  <tt>2 * i</tt> and <tt>2 * i + 1</tt>
  */
-Utils::Vector2d calc_oif_global(int molType, CellStructure &cs);
+std::vector<double> calc_oif_global(int n_objects, CellStructure &cs);
 
-/** Distribute the OIF global forces to all particles in the mesh. */
-void add_oif_global_forces(Utils::Vector2d const &area_volume, int molType,
+/** Distribute the OIF global forces to all particles in the meshes. */
+void add_oif_global_forces(std::vector<double> const &area_volume,
                            CellStructure &cs);
 
 extern int max_oif_objects;
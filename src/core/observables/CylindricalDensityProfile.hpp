@@ -21,33 +21,26 @@
 
 #include "CylindricalPidProfileObservable.hpp"
 
-#include "BoxGeometry.hpp"
-#include "grid.hpp"
+#include "Particle.hpp"
+#include "ParticleTraits.hpp"
+#include "ProfileBinning.hpp"
 
-#include <utils/Histogram.hpp>
-#include <utils/math/coordinate_transformation.hpp>
-
-#include <cstddef>
 #include <vector>
 
 namespace Observables {
+
 class CylindricalDensityProfile : public CylindricalPidProfileObservable {
 public:
   using CylindricalPidProfileObservable::CylindricalPidProfileObservable;
+
+  std::vector<double> operator()() const override {
+    return mpi_bin_profile(binning(ProfileQuantity::DENSITY));
+  }
+
   std::vector<double>
   evaluate(ParticleReferenceRange particles,
-           const ParticleObservables::traits<Particle> &traits) const override {
-    Utils::CylindricalHistogram<double, 1> histogram(n_bins(), limits());
-
-    for (auto const &p : particles) {
-      histogram.update(Utils::transform_coordinate_cartesian_to_cylinder(
-          folded_position(traits.position(p), box_geo) -
-              transform_params->center(),
-          transform_params->axis(), transform_params->orientation()));
-    }
-
-    histogram.normalize();
-    return histogram.get_histogram();
+           const ParticleObservables::traits<Particle> &) const override {
+    return bin_profile(binning(ProfileQuantity::DENSITY), particles);
   }
 };
 
@@ -19,45 +19,35 @@
 #ifndef OBSERVABLES_CYLINDRICALFLUXDENSITYPROFILE_HPP
 #define OBSERVABLES_CYLINDRICALFLUXDENSITYPROFILE_HPP
 
-#include "BoxGeometry.hpp"
 #include "CylindricalPidProfileObservable.hpp"
-#include "grid.hpp"
 
-#include <utils/Histogram.hpp>
-#include <utils/math/coordinate_transformation.hpp>
+#include "Particle.hpp"
+#include "ParticleTraits.hpp"
+#include "ProfileBinning.hpp"
 
-#include <array>
 #include <cstddef>
-#include <utility>
 #include <vector>
 
 namespace Observables {
+
 class CylindricalFluxDensityProfile : public CylindricalPidProfileObservable {
 public:
   using CylindricalPidProfileObservable::CylindricalPidProfileObservable;
 
-  std::vector<double>
-  evaluate(Utils::Span<std::reference_wrapper<const Particle>> particles,
-           const ParticleObservables::traits<Particle> &traits) const override {
-    Utils::CylindricalHistogram<double, 3> histogram(n_bins(), limits());
-
-    // Write data to the histogram
-    for (auto p : particles) {
-      auto const pos = folded_position(traits.position(p), box_geo) -
-                       transform_params->center();
-      histogram.update(
-          Utils::transform_coordinate_cartesian_to_cylinder(
-              pos, transform_params->axis(), transform_params->orientation()),
-          Utils::transform_vector_cartesian_to_cylinder(
-              traits.velocity(p), transform_params->axis(), pos));
-    }
-    histogram.normalize();
-    return histogram.get_histogram();
-  }
   std::vector<std::size_t> shape() const override {
     auto const b = n_bins();
     return {b[0], b[1], b[2], 3};
   }
+
+  std::vector<double> operator()() const override {
+    return mpi_bin_profile(binning(ProfileQuantity::FLUX_DENSITY));
+  }
+
+  std::vector<double>
+  evaluate(ParticleReferenceRange particles,
+           const ParticleObservables::traits<Particle> &) const override {
+    return bin_profile(binning(ProfileQuantity::FLUX_DENSITY), particles);
+  }
 };
 
 } // Namespace Observables
@@ -21,6 +21,7 @@
 
 #include "CylindricalProfileObservable.hpp"
 #include "PidObservable.hpp"
+#include "ProfileBinning.hpp"
 
 #include <memory>
 #include <utility>
@@ -41,6 +42,24 @@ public:
         CylindricalProfileObservable(std::move(transform_params), n_r_bins,
                                      n_phi_bins, n_z_bins, min_r, max_r,
                                      min_phi, max_phi, min_z, max_z) {}
+
+protected:
+  /** Parameters to bin @p quantity on the profile grid. */
+  ProfileBinning binning(ProfileQuantity quantity) const {
+    ProfileBinning binning;
+    binning.quantity = quantity;
+    binning.ids = ids();
+    for (unsigned int i = 0; i < 3; ++i) {
+      binning.n_bins[i] = n_bins()[i];
+      binning.min[i] = limits()[i].first;
+      binning.max[i] = limits()[i].second;
+    }
+    binning.cylindrical = true;
+    binning.center = transform_params->center();
+    binning.axis = transform_params->axis();
+    binning.orientation = transform_params->orientation();
+    return binning;
+  }
 };
 
 } // Namespace Observables
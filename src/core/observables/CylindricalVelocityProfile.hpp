@@ -19,52 +19,35 @@
 #ifndef OBSERVABLES_CYLINDRICALVELOCITYPROFILE_HPP
 #define OBSERVABLES_CYLINDRICALVELOCITYPROFILE_HPP
 
-#include "BoxGeometry.hpp"
 #include "CylindricalPidProfileObservable.hpp"
-#include "grid.hpp"
 
-#include <utils/Histogram.hpp>
-#include <utils/Span.hpp>
-#include <utils/math/coordinate_transformation.hpp>
+#include "Particle.hpp"
+#include "ParticleTraits.hpp"
+#include "ProfileBinning.hpp"
 
-#include <array>
 #include <cstddef>
-#include <utility>
 #include <vector>
 
 namespace Observables {
+
 class CylindricalVelocityProfile : public CylindricalPidProfileObservable {
 public:
   using CylindricalPidProfileObservable::CylindricalPidProfileObservable;
 
-  std::vector<double>
-  evaluate(ParticleReferenceRange particles,
-           const ParticleObservables::traits<Particle> &traits) const override {
-    Utils::CylindricalHistogram<double, 3> histogram(n_bins(), limits());
-
-    for (auto p : particles) {
-      auto const pos = folded_position(traits.position(p), box_geo) -
-                       transform_params->center();
-      histogram.update(
-          Utils::transform_coordinate_cartesian_to_cylinder(
-              pos, transform_params->axis(), transform_params->orientation()),
-          Utils::transform_vector_cartesian_to_cylinder(
-              traits.velocity(p), transform_params->axis(), pos));
-    }
-
-    auto hist_tmp = histogram.get_histogram();
-    auto tot_count = histogram.get_tot_count();
-    for (std::size_t ind = 0; ind < hist_tmp.size(); ++ind) {
-      if (tot_count[ind] > 0) {
-        hist_tmp[ind] /= static_cast<double>(tot_count[ind]);
-      }
-    }
-    return hist_tmp;
-  }
   std::vector<std::size_t> shape() const override {
     auto const b = n_bins();
     return {b[0], b[1], b[2], 3};
   }
+
+  std::vector<double> operator()() const override {
+    return mpi_bin_profile(binning(ProfileQuantity::VELOCITY));
+  }
+
+  std::vector<double>
+  evaluate(ParticleReferenceRange particles,
+           const ParticleObservables::traits<Particle> &) const override {
+    return bin_profile(binning(ProfileQuantity::VELOCITY), particles);
+  }
 };
 
 } // Namespace Observables
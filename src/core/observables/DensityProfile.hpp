@@ -19,13 +19,11 @@
 #ifndef OBSERVABLES_DENSITYPROFILE_HPP
 #define OBSERVABLES_DENSITYPROFILE_HPP
 
-#include "BoxGeometry.hpp"
-#include "Particle.hpp"
 #include "PidProfileObservable.hpp"
-#include "grid.hpp"
 
-#include <utils/Histogram.hpp>
-#include <utils/Span.hpp>
+#include "Particle.hpp"
+#include "ParticleTraits.hpp"
+#include "ProfileBinning.hpp"
 
 #include <vector>
 
@@ -35,18 +33,17 @@ class DensityProfile : public PidProfileObservable {
 public:
   using PidProfileObservable::PidProfileObservable;
 
+  std::vector<double> operator()() const override {
+    return mpi_bin_profile(binning(ProfileQuantity::DENSITY));
+  }
+
   std::vector<double>
-  evaluate(Utils::Span<std::reference_wrapper<const Particle>> particles,
-           const ParticleObservables::traits<Particle> &traits) const override {
-    Utils::Histogram<double, 1> histogram(n_bins(), limits());
-
-    for (auto p : particles) {
-      histogram.update(folded_position(traits.position(p), box_geo));
-    }
-    histogram.normalize();
-    return histogram.get_histogram();
+  evaluate(ParticleReferenceRange particles,
+           const ParticleObservables::traits<Particle> &) const override {
+    return bin_profile(binning(ProfileQuantity::DENSITY), particles);
   }
 };
+
 } // Namespace Observables
 
 #endif
@@ -19,37 +19,34 @@
 #ifndef OBSERVABLES_FLUXDENSITYPROFILE_HPP
 #define OBSERVABLES_FLUXDENSITYPROFILE_HPP
 
-#include "BoxGeometry.hpp"
-#include "Particle.hpp"
 #include "PidProfileObservable.hpp"
-#include "grid.hpp"
 
-#include <utils/Histogram.hpp>
-#include <utils/Span.hpp>
+#include "Particle.hpp"
+#include "ParticleTraits.hpp"
+#include "ProfileBinning.hpp"
 
 #include <cstddef>
 #include <vector>
 
 namespace Observables {
+
 class FluxDensityProfile : public PidProfileObservable {
 public:
   using PidProfileObservable::PidProfileObservable;
+
   std::vector<std::size_t> shape() const override {
     auto const b = n_bins();
     return {b[0], b[1], b[2], 3};
   }
 
+  std::vector<double> operator()() const override {
+    return mpi_bin_profile(binning(ProfileQuantity::FLUX_DENSITY));
+  }
+
   std::vector<double>
-  evaluate(Utils::Span<std::reference_wrapper<const Particle>> particles,
-           const ParticleObservables::traits<Particle> &traits) const override {
-    Utils::Histogram<double, 3> histogram(n_bins(), limits());
-
-    for (auto p : particles) {
-      auto const ppos = folded_position(traits.position(p), box_geo);
-      histogram.update(ppos, traits.velocity(p));
-    }
-    histogram.normalize();
-    return histogram.get_histogram();
+  evaluate(ParticleReferenceRange particles,
+           const ParticleObservables::traits<Particle> &) const override {
+    return bin_profile(binning(ProfileQuantity::FLUX_DENSITY), particles);
   }
 };
 
@@ -19,14 +19,12 @@
 #ifndef OBSERVABLES_FORCEDENSITYPROFILE_HPP
 #define OBSERVABLES_FORCEDENSITYPROFILE_HPP
 
-#include "BoxGeometry.hpp"
-#include "Particle.hpp"
 #include "PidProfileObservable.hpp"
-#include "grid.hpp"
 
-#include <utils/Histogram.hpp>
+#include "Particle.hpp"
+#include "ParticleTraits.hpp"
+#include "ProfileBinning.hpp"
 
-#include <array>
 #include <cstddef>
 #include <vector>
 
@@ -35,21 +33,20 @@ namespace Observables {
 class ForceDensityProfile : public PidProfileObservable {
 public:
   using PidProfileObservable::PidProfileObservable;
+
   std::vector<std::size_t> shape() const override {
     auto const b = n_bins();
     return {b[0], b[1], b[2], 3};
   }
 
+  std::vector<double> operator()() const override {
+    return mpi_bin_profile(binning(ProfileQuantity::FORCE_DENSITY));
+  }
+
   std::vector<double>
   evaluate(ParticleReferenceRange particles,
            const ParticleObservables::traits<Particle> &) const override {
-    Utils::Histogram<double, 3> histogram(n_bins(), limits());
-    for (auto const &p : particles) {
-      histogram.update(folded_position(p.get().pos(), box_geo),
-                       p.get().force());
-    }
-    histogram.normalize();
-    return histogram.get_histogram();
+    return bin_profile(binning(ProfileQuantity::FORCE_DENSITY), particles);
   }
 };
 
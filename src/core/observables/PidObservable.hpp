@@ -59,7 +59,7 @@ class PidObservable : virtual public Observable {
 
 public:
   explicit PidObservable(std::vector<int> ids) : m_ids(std::move(ids)) {}
-  std::vector<double> operator()() const final;
+  std::vector<double> operator()() const override;
   std::vector<int> const &ids() const { return m_ids; }
 };
 
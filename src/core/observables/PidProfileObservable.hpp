@@ -20,6 +20,7 @@
 #define OBSERVABLES_PIDPROFILEOBSERVABLE_HPP
 
 #include "PidObservable.hpp"
+#include "ProfileBinning.hpp"
 #include "ProfileObservable.hpp"
 
 #include <vector>
@@ -35,6 +36,20 @@ public:
       : PidObservable(ids),
         ProfileObservable(n_x_bins, n_y_bins, n_z_bins, min_x, max_x, min_y,
                           max_y, min_z, max_z) {}
+
+protected:
+  /** Parameters to bin @p quantity on the profile grid. */
+  ProfileBinning binning(ProfileQuantity quantity) const {
+    ProfileBinning binning;
+    binning.quantity = quantity;
+    binning.ids = ids();
+    for (unsigned int i = 0; i < 3; ++i) {
+      binning.n_bins[i] = n_bins()[i];
+      binning.min[i] = limits()[i].first;
+      binning.max[i] = limits()[i].second;
+    }
+    return binning;
+  }
 };
 
 } // Namespace Observables
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ProfileBinning.hpp"
+
+#include "BoxGeometry.hpp"
+#include "Particle.hpp"
+#include "cells.hpp"
+#include "communication.hpp"
+#include "grid.hpp"
+#include "particle_node.hpp"
+
+#include <utils/Histogram.hpp>
+#include <utils/Span.hpp>
+#include <utils/Vector.hpp>
+#include <utils/math/coordinate_transformation.hpp>
+
+#include <boost/mpi/collectives/reduce.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Observables {
+namespace {
+
+/** Call @p f with an empty histogram matching the profile parameters. */
+template <std::size_t N, class F>
+auto with_histogram(ProfileBinning const &binning, F &&f) {
+  std::array<std::size_t, 3> n_bins;
+  std::array<std::pair<double, double>, 3> limits;
+  for (unsigned int i = 0; i < 3; ++i) {
+    n_bins[i] = binning.n_bins[i];
+    limits[i] = {binning.min[i], binning.max[i]};
+  }
+  if (binning.cylindrical) {
+    Utils::CylindricalHistogram<double, N> histogram(n_bins, limits);
+    return f(histogram);
+  }
+  Utils::Histogram<double, N> histogram(n_bins, limits);
+  return f(histogram);
+}
+
+template <class F> auto visit_histogram(ProfileBinning const &binning, F &&f) {
+  if (binning.quantity == ProfileQuantity::DENSITY) {
+    return with_histogram<1>(binning, std::forward<F>(f));
+  }
+  return with_histogram<3>(binning, std::forward<F>(f));
+}
+
+template <class Histogram>
+void update(Histogram &histogram, ProfileBinning const &binning,
+            Particle const &p) {
+  auto const pos = folded_position(p.pos(), box_geo);
+  auto const value = (binning.quantity == ProfileQuantity::FORCE_DENSITY)
+                         ? p.force()
+                         : p.v();
+
+  if (binning.cylindrical) {
+    auto const pos_shifted = pos - binning.center;
+    auto const pos_cyl = Utils::transform_coordinate_cartesian_to_cylinder(
+        pos_shifted, binning.axis, binning.orientation);
+    if (binning.quantity == ProfileQuantity::DENSITY) {
+      histogram.update(pos_cyl);
+    } else {
+      histogram.update(pos_cyl, Utils::transform_vector_cartesian_to_cylinder(
+                                    value, binning.axis, pos_shifted));
+    }
+  } else {
+    if (binning.quantity == ProfileQuantity::DENSITY) {
+      histogram.update(pos);
+    } else {
+      histogram.update(pos, value);
+    }
+  }
+}
+
+template <class Histogram>
+std::vector<double> normalize(Histogram &histogram, ProfileQuantity quantity) {
+  if (quantity != ProfileQuantity::VELOCITY) {
+    histogram.normalize();
+    return histogram.get_histogram();
+  }
+  auto hist_data = histogram.get_histogram();
+  auto const tot_count = histogram.get_tot_count();
+  for (std::size_t ind = 0; ind < hist_data.size(); ++ind) {
+    if (tot_count[ind] > 0) {
+      hist_data[ind] /= static_cast<double>(tot_count[ind]);
+    }
+  }
+  return hist_data;
+}
+
+/** Sum a buffer over all ranks into the buffer of the head node. */
+template <class T> void reduce_to_head(Utils::Span<T> buffer) {
+  auto const n = static_cast<int>(buffer.size());
+  if (this_node == 0) {
+    std::vector<T> out(buffer.size());
+    boost::mpi::reduce(comm_cart, buffer.data(), n, out.data(),
+                       std::plus<T>(), 0);
+    std::copy(out.begin(), out.end(), buffer.begin());
+  } else {
+    boost::mpi::reduce(comm_cart, buffer.data(), n, std::plus<T>(), 0);
+  }
+}
+
+/** Bin the local particles and add up the histograms on the head node.
+ *  @return The profile on the head node, an empty vector on the other ranks.
+ */
+std::vector<double> bin_profile_local(ProfileBinning const &binning) {
+  return visit_histogram(binning, [&binning](auto &histogram) {
+    std::size_t n_found = 0;
+    for (auto const id : binning.ids) {
+      if (id < 0)
+        continue;
+      auto const p = ::cell_structure.get_local_particle(id);
+      if (p and not p->is_ghost()) {
+        update(histogram, binning, *p);
+        ++n_found;
+      }
+    }
+
+    reduce_to_head(histogram.data());
+    if (binning.quantity == ProfileQuantity::VELOCITY) {
+      reduce_to_head(histogram.count_data());
+    }
+
+    if (this_node != 0) {
+      boost::mpi::reduce(comm_cart, n_found, std::plus<>(), 0);
+      return std::vector<double>{};
+    }
+
+    std::size_t n_total = 0;
+    boost::mpi::reduce(comm_cart, n_found, n_total, std::plus<>(), 0);
+    if (n_total != binning.ids.size()) {
+      // report the first particle that does not exist
+      for (auto const id : binning.ids) {
+        get_particle_node(id);
+      }
+    }
+
+    return normalize(histogram, binning.quantity);
+  });
+}
+
+void mpi_bin_profile_local(ProfileBinning const &binning) {
+  bin_profile_local(binning);
+}
+
+} // namespace
+
+REGISTER_CALLBACK(mpi_bin_profile_local)
+
+std::vector<double> mpi_bin_profile(ProfileBinning const &binning) {
+  mpi_call(mpi_bin_profile_local, binning);
+  return bin_profile_local(binning);
+}
+
+std::vector<double> bin_profile(ProfileBinning const &binning,
+                                ParticleReferenceRange particles) {
+  return visit_histogram(binning, [&](auto &histogram) {
+    for (auto const &p : particles) {
+      update(histogram, binning, p.get());
+    }
+    return normalize(histogram, binning.quantity);
+  });
+}
+
+} // namespace Observables
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef OBSERVABLES_PROFILEBINNING_HPP
+#define OBSERVABLES_PROFILEBINNING_HPP
+/** @file
+ *
+ * Histograms of particle properties for the particle profile observables.
+ *
+ * Profiles are binned in parallel: every rank sums the particles it owns
+ * into a histogram of the full profile and the partial histograms are
+ * added up on the head node with a single reduction. Only the binning
+ * parameters and the particle ids are sent over the network, instead of
+ * a copy of every particle.
+ */
+
+#include "PidObservable.hpp"
+
+#include <utils/Vector.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace Observables {
+
+/** Particle property binned by a profile, and its normalization. */
+enum class ProfileQuantity : int {
+  DENSITY,       ///< number of particles per bin volume
+  FLUX_DENSITY,  ///< sum of the velocities per bin volume
+  FORCE_DENSITY, ///< sum of the forces per bin volume
+  VELOCITY       ///< average velocity of the particles in a bin
+};
+
+/** Parameters of a particle profile. */
+struct ProfileBinning {
+  ProfileQuantity quantity;
+  std::vector<int> ids;
+  Utils::Vector<std::size_t, 3> n_bins;
+  Utils::Vector3d min;
+  Utils::Vector3d max;
+  /** @name Cylindrical coordinate system
+   *  If @c cylindrical is set, the bins are in (r, phi, z) coordinates
+   *  and vector quantities are projected on the cylindrical unit vectors.
+   */
+  /**@{*/
+  bool cylindrical = false;
+  Utils::Vector3d center{};
+  Utils::Vector3d axis{};
+  Utils::Vector3d orientation{};
+  /**@}*/
+
+  template <class Archive> void serialize(Archive &ar, long int /* version */) {
+    ar &quantity &ids &n_bins &min &max &cylindrical &center &axis &orientation;
+  }
+};
+
+/** Bin the particles of all ranks.
+ *  Has to be called on the head node; particles that are not stored on any
+ *  rank raise an exception.
+ */
+std::vector<double> mpi_bin_profile(ProfileBinning const &binning);
+
+/** Bin particles that were already fetched on the calling rank. */
+std::vector<double> bin_profile(ProfileBinning const &binning,
+                                ParticleReferenceRange particles);
+
+} // Namespace Observables
+
+#endif
@@ -31,6 +31,8 @@
 
 #include "p3m/fft.hpp"
 
+#include "instrumentation.hpp"
+
 #include <utils/Span.hpp>
 #include <utils/Vector.hpp>
 #include <utils/index.hpp>
@@ -681,6 +683,7 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
 
 void fft_perform_forw(double *data, fft_data_struct &fft,
                       const boost::mpi::communicator &comm) {
+  Instrumentation::ScopedTimer timer(Instrumentation::Timer::FFT);
   /* ===== first direction  ===== */
 
   auto *c_data = (fftw_complex *)data;
@@ -712,6 +715,7 @@ void fft_perform_forw(double *data, fft_data_struct &fft,
 
 void fft_perform_back(double *data, bool check_complex, fft_data_struct &fft,
                       const boost::mpi::communicator &comm) {
+  Instrumentation::ScopedTimer timer(Instrumentation::Timer::FFT);
 
   auto *c_data = (fftw_complex *)data;
   auto *c_data_buf = (fftw_complex *)fft.data_buf.data();
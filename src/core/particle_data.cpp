@@ -37,12 +37,15 @@
 #include <utils/Vector.hpp>
 #include <utils/quaternion.hpp>
 
+#include <boost/mpi/collectives/scatter.hpp>
 #include <boost/range/algorithm/copy.hpp>
 #include <boost/range/algorithm/find.hpp>
+#include <boost/serialization/utility.hpp>
 #include <boost/serialization/variant.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/variant.hpp>
 
+#include <cstddef>
 #include <iterator>
 #include <stdexcept>
 #include <unordered_map>
@@ -337,10 +340,12 @@ struct UpdateVisitor : public boost::static_visitor<void> {
 
 void local_remove_bond(Particle &p, std::vector<int> const &bond) {
   RemoveBond{bond}(p);
+  cell_structure.invalidate_bond_list();
 }
 
 void local_remove_pair_bonds_to(Particle &p, int other_pid) {
   RemovePairBondsTo{other_pid}(p);
+  cell_structure.invalidate_bond_list();
 }
 
 static void mpi_send_update_message_local(int node, int id) {
@@ -390,6 +395,70 @@ static void mpi_send_update_message(int id, const UpdateMessage &msg) {
   on_particle_change();
 }
 
+static void apply_update_messages(
+    std::vector<std::pair<int, UpdateMessage>> const &messages) {
+  for (auto const &[id, msg] : messages) {
+    boost::apply_visitor(UpdateVisitor(id), msg);
+  }
+}
+
+static void mpi_send_update_messages_local() {
+  std::vector<std::pair<int, UpdateMessage>> messages;
+  boost::mpi::scatter(comm_cart, messages, 0);
+  apply_update_messages(messages);
+  on_particle_change();
+}
+
+REGISTER_CALLBACK(mpi_send_update_messages_local)
+
+/**
+ * @brief Send update messages for many particles at once.
+ *
+ * The messages are grouped by the node responsible for the particle
+ * and distributed in a single collective call, which avoids one
+ * MPI callback per particle as in @ref mpi_send_update_message.
+ *
+ * @param ids Ids of the particles to update
+ * @param msgs One message per particle
+ */
+static void mpi_send_update_messages(Utils::Span<const int> ids,
+                                     std::vector<UpdateMessage> const &msgs) {
+  assert(ids.size() == msgs.size());
+  std::vector<std::vector<std::pair<int, UpdateMessage>>> node_messages(
+      comm_cart.size());
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    node_messages[get_particle_node(ids[i])].emplace_back(ids[i], msgs[i]);
+  }
+
+  mpi_call(mpi_send_update_messages_local);
+  std::vector<std::pair<int, UpdateMessage>> local_messages;
+  boost::mpi::scatter(comm_cart, node_messages, local_messages, 0);
+  apply_update_messages(local_messages);
+
+  on_particle_change();
+}
+
+template <typename S, S Particle::*s, typename T, T S::*m>
+void mpi_update_particles(Utils::Span<const int> ids,
+                          Utils::Span<const T> values) {
+  if (ids.size() != values.size()) {
+    throw std::invalid_argument("Expected one value per particle");
+  }
+  using MessageType = message_type_t<S, s>;
+  std::vector<UpdateMessage> msgs;
+  msgs.reserve(values.size());
+  for (auto const &value : values) {
+    msgs.emplace_back(MessageType{UpdateParticle<S, s, T, m>{value}});
+  }
+  mpi_send_update_messages(ids, msgs);
+}
+
+template <typename T, T ParticleProperties::*m>
+void mpi_update_particles_property(Utils::Span<const int> ids,
+                                   Utils::Span<const T> values) {
+  mpi_update_particles<ParticleProperties, &Particle::p, T, m>(ids, values);
+}
+
 template <typename S, S Particle::*s, typename T, T S::*m>
 void mpi_update_particle(int id, const T &value) {
   using MessageType = message_type_t<S, s>;
@@ -407,6 +476,12 @@ void set_particle_v(int part, Utils::Vector3d const &v) {
                       &ParticleMomentum::v>(part, v);
 }
 
+void set_particles_v(Utils::Span<const int> p_ids,
+                     Utils::Span<const Utils::Vector3d> v) {
+  mpi_update_particles<ParticleMomentum, &Particle::m, Utils::Vector3d,
+                       &ParticleMomentum::v>(p_ids, v);
+}
+
 void set_particle_lees_edwards_offset(int part, const double v) {
   mpi_update_particle<ParticleLocal, &Particle::l, double,
                       &ParticleLocal::lees_edwards_offset>(part, v);
@@ -424,10 +499,22 @@ void set_particle_f(int part, const Utils::Vector3d &f) {
                       &ParticleForce::f>(part, f);
 }
 
+void set_particles_f(Utils::Span<const int> p_ids,
+                     Utils::Span<const Utils::Vector3d> f) {
+  mpi_update_particles<ParticleForce, &Particle::f, Utils::Vector3d,
+                       &ParticleForce::f>(p_ids, f);
+}
+
 #ifdef MASS
 void set_particle_mass(int part, double mass) {
   mpi_update_particle_property<double, &ParticleProperties::mass>(part, mass);
 }
+
+void set_particles_mass(Utils::Span<const int> p_ids,
+                        Utils::Span<const double> mass) {
+  mpi_update_particles_property<double, &ParticleProperties::mass>(p_ids,
+                                                                   mass);
+}
 #else
 const constexpr double ParticleProperties::mass;
 #endif
@@ -507,6 +594,11 @@ void set_particle_vs_relative(int part, int vs_relative_to, double vs_distance,
 void set_particle_q(int part, double q) {
   mpi_update_particle_property<double, &ParticleProperties::q>(part, q);
 }
+
+void set_particles_q(Utils::Span<const int> p_ids,
+                     Utils::Span<const double> q) {
+  mpi_update_particles_property<double, &ParticleProperties::q>(p_ids, q);
+}
 #else
 const constexpr double ParticleProperties::q;
 #endif
@@ -524,10 +616,28 @@ void set_particle_type(int p_id, int type) {
   mpi_update_particle_property<int, &ParticleProperties::type>(p_id, type);
 }
 
+void set_particles_type(Utils::Span<const int> p_ids,
+                        Utils::Span<const int> types) {
+  if (p_ids.size() != types.size()) {
+    throw std::invalid_argument("Expected one value per particle");
+  }
+  for (std::size_t i = 0; i < p_ids.size(); ++i) {
+    make_particle_type_exist(types[i]);
+    on_particle_type_change(p_ids[i], types[i]);
+  }
+  mpi_update_particles_property<int, &ParticleProperties::type>(p_ids, types);
+}
+
 void set_particle_mol_id(int part, int mid) {
   mpi_update_particle_property<int, &ParticleProperties::mol_id>(part, mid);
 }
 
+void set_particles_mol_id(Utils::Span<const int> p_ids,
+                          Utils::Span<const int> mol_ids) {
+  mpi_update_particles_property<int, &ParticleProperties::mol_id>(p_ids,
+                                                                  mol_ids);
+}
+
 #ifdef ROTATION
 void set_particle_quat(int part, Utils::Quaternion<double> const &quat) {
   mpi_update_particle<ParticlePosition, &Particle::r, Utils::Quaternion<double>,
@@ -42,6 +42,14 @@
  */
 void set_particle_v(int part, Utils::Vector3d const &v);
 
+/** Call only on the head node: set velocities of several particles
+ *  in a single collective call.
+ *  @param p_ids the particles.
+ *  @param v their new velocities.
+ */
+void set_particles_v(Utils::Span<const int> p_ids,
+                     Utils::Span<const Utils::Vector3d> v);
+
 /** Call only on the head node: set particle Lees-Edwards offset.
  *  @param part the particle.
  *  @param v new value for Lees-Edwards offset
@@ -62,12 +70,28 @@ void set_particle_swimming(int part, ParticleParametersSwimming swim);
  */
 void set_particle_f(int part, const Utils::Vector3d &F);
 
+/** Call only on the head node: set forces of several particles
+ *  in a single collective call.
+ *  @param p_ids the particles.
+ *  @param f their new forces.
+ */
+void set_particles_f(Utils::Span<const int> p_ids,
+                     Utils::Span<const Utils::Vector3d> f);
+
 #ifdef MASS
 /** Call only on the head node: set particle mass.
  *  @param part the particle.
  *  @param mass its new mass.
  */
 void set_particle_mass(int part, double mass);
+
+/** Call only on the head node: set masses of several particles
+ *  in a single collective call.
+ *  @param p_ids the particles.
+ *  @param mass their new masses.
+ */
+void set_particles_mass(Utils::Span<const int> p_ids,
+                        Utils::Span<const double> mass);
 #endif
 
 #ifdef ROTATIONAL_INERTIA
@@ -102,6 +126,13 @@ void rotate_particle(int part, const Utils::Vector3d &axis, double angle);
  *  @param q its new charge.
  */
 void set_particle_q(int part, double q);
+
+/** Call only on the head node: set charges of several particles
+ *  in a single collective call.
+ *  @param p_ids the particles.
+ *  @param q their new charges.
+ */
+void set_particles_q(Utils::Span<const int> p_ids, Utils::Span<const double> q);
 #endif
 
 #ifdef LB_ELECTROHYDRODYNAMICS
@@ -118,12 +149,28 @@ void set_particle_mu_E(int part, Utils::Vector3d const &mu_E);
  */
 void set_particle_type(int p_id, int type);
 
+/** Call only on the head node: set types of several particles
+ *  in a single collective call.
+ *  @param p_ids the particles.
+ *  @param types their new types.
+ */
+void set_particles_type(Utils::Span<const int> p_ids,
+                        Utils::Span<const int> types);
+
 /** Call only on the head node: set particle's molecule id.
  *  @param part the particle.
  *  @param mid  its new mol id.
  */
 void set_particle_mol_id(int part, int mid);
 
+/** Call only on the head node: set molecule ids of several particles
+ *  in a single collective call.
+ *  @param p_ids the particles.
+ *  @param mol_ids their new mol ids.
+ */
+void set_particles_mol_id(Utils::Span<const int> p_ids,
+                          Utils::Span<const int> mol_ids);
+
 #ifdef ROTATION
 /** Call only on the head node: set particle orientation using quaternions.
  *  @param part the particle.
@@ -26,6 +26,7 @@
 #include "communication.hpp"
 #include "event.hpp"
 #include "grid.hpp"
+#include "nonbonded_interactions/nonbonded_interaction_data.hpp"
 #include "partCfg_global.hpp"
 #include "particle_data.hpp"
 
@@ -36,14 +37,19 @@
 #include <utils/mpi/gatherv.hpp>
 
 #include <boost/mpi/collectives/gather.hpp>
+#include <boost/mpi/collectives/gatherv.hpp>
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/mpi/collectives/scatter.hpp>
 #include <boost/optional.hpp>
 #include <boost/range/algorithm/sort.hpp>
 #include <boost/range/numeric.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <stdexcept>
@@ -247,6 +253,123 @@ void prefetch_particle_data(Utils::Span<const int> in_ids) {
   }
 }
 
+int bulk_property_dimension(ParticleBulkProperty property) {
+  switch (property) {
+  case ParticleBulkProperty::POS:
+  case ParticleBulkProperty::V:
+  case ParticleBulkProperty::F:
+  case ParticleBulkProperty::IMAGE_BOX:
+    return 3;
+  case ParticleBulkProperty::Q:
+  case ParticleBulkProperty::TYPE:
+    return 1;
+  }
+  throw std::invalid_argument("Unknown particle property");
+}
+
+template <class OutputIt>
+static OutputIt copy_vector(Utils::Vector3d const &v, OutputIt out) {
+  return std::copy(v.begin(), v.end(), out);
+}
+
+static void append_particle_property(Particle const &p,
+                                     ParticleBulkProperty property,
+                                     std::vector<double> &values) {
+  auto out = std::back_inserter(values);
+  switch (property) {
+  case ParticleBulkProperty::POS:
+    copy_vector(unfolded_position(p.pos(), p.image_box(), box_geo.length()),
+                out);
+    break;
+  case ParticleBulkProperty::V:
+    copy_vector(p.v(), out);
+    break;
+  case ParticleBulkProperty::F:
+    copy_vector(p.force(), out);
+    break;
+  case ParticleBulkProperty::IMAGE_BOX:
+    std::copy(p.image_box().begin(), p.image_box().end(), out);
+    break;
+  case ParticleBulkProperty::Q:
+    values.push_back(p.q());
+    break;
+  case ParticleBulkProperty::TYPE:
+    values.push_back(static_cast<double>(p.type()));
+    break;
+  }
+}
+
+static void mpi_get_particles_property_local(int property) {
+  std::vector<int> ids;
+  boost::mpi::scatter(comm_cart, ids, 0);
+
+  auto const prop = static_cast<ParticleBulkProperty>(property);
+  std::vector<double> values;
+  values.reserve(ids.size() *
+                 static_cast<std::size_t>(bulk_property_dimension(prop)));
+  for (auto const p_id : ids) {
+    auto const p = cell_structure.get_local_particle(p_id);
+    assert(p);
+    append_particle_property(*p, prop, values);
+  }
+
+  boost::mpi::gatherv(comm_cart, values.data(), static_cast<int>(values.size()),
+                      0);
+}
+
+REGISTER_CALLBACK(mpi_get_particles_property_local)
+
+std::vector<double> mpi_get_particles_property(Utils::Span<const int> p_ids,
+                                               ParticleBulkProperty property) {
+  auto const dim = bulk_property_dimension(property);
+  auto const n_nodes = static_cast<std::size_t>(comm_cart.size());
+
+  /* Group ids per node, remembering their position in the input. */
+  std::vector<std::vector<int>> node_ids(n_nodes);
+  std::vector<std::vector<std::size_t>> node_indices(n_nodes);
+  for (std::size_t i = 0; i < p_ids.size(); ++i) {
+    auto const p_node = get_particle_node(p_ids[i]);
+    node_ids[p_node].push_back(p_ids[i]);
+    node_indices[p_node].push_back(i);
+  }
+
+  mpi_call(mpi_get_particles_property_local, static_cast<int>(property));
+
+  std::vector<int> local_ids;
+  boost::mpi::scatter(comm_cart, node_ids, local_ids, 0);
+
+  std::vector<double> local_values;
+  local_values.reserve(local_ids.size() * static_cast<std::size_t>(dim));
+  for (auto const p_id : local_ids) {
+    auto const p = cell_structure.get_local_particle(p_id);
+    assert(p);
+    append_particle_property(*p, property, local_values);
+  }
+
+  std::vector<int> node_sizes(n_nodes);
+  std::transform(node_ids.cbegin(), node_ids.cend(), node_sizes.begin(),
+                 [dim](std::vector<int> const &ids) {
+                   return static_cast<int>(ids.size()) * dim;
+                 });
+
+  std::vector<double> gathered(p_ids.size() * static_cast<std::size_t>(dim));
+  boost::mpi::gatherv(comm_cart, local_values.data(),
+                      static_cast<int>(local_values.size()), gathered.data(),
+                      node_sizes, 0);
+
+  /* Restore the order of the input ids. */
+  std::vector<double> values(gathered.size());
+  auto src = gathered.cbegin();
+  for (auto const &indices : node_indices) {
+    for (auto const i : indices) {
+      std::copy_n(src, dim, values.begin() + static_cast<long>(i) * dim);
+      src += dim;
+    }
+  }
+
+  return values;
+}
+
 static void mpi_who_has_local() {
   static std::vector<int> sendbuf;
 
@@ -476,6 +599,92 @@ void mpi_set_particle_pos(int p_id, Utils::Vector3d const &pos) {
   mpi_call_all(mpi_set_particle_pos_local, p_id, pos);
 }
 
+static void mpi_make_new_particles_local() {
+  std::vector<Particle> particles;
+  boost::mpi::scatter(::comm_cart, particles, 0);
+  for (auto &p : particles) {
+    ::cell_structure.add_particle(std::move(p));
+  }
+  on_particle_change();
+}
+
+REGISTER_CALLBACK(mpi_make_new_particles_local)
+
+void mpi_make_new_particles(std::vector<Particle> particles) {
+  if (particle_node.empty())
+    build_particle_node();
+
+  std::unordered_set<int> new_ids;
+  for (auto &p : particles) {
+    particle_checks(p.id(), p.pos());
+    if (particle_node.count(p.id()) or not new_ids.insert(p.id()).second) {
+      throw std::invalid_argument("Particle " + std::to_string(p.id()) +
+                                  " already exists");
+    }
+    if (not p.bonds().empty()) {
+      throw std::invalid_argument("New particles cannot have bonds");
+    }
+    fold_position(p.pos(), p.image_box(), box_geo);
+  }
+
+  /* Group particles per node */
+  std::vector<std::vector<Particle>> node_particles(::comm_cart.size());
+  for (auto &p : particles) {
+    auto const p_node = map_position_node_array(p.pos());
+    particle_node[p.id()] = p_node;
+    max_seen_pid = std::max(max_seen_pid, p.id());
+    make_particle_type_exist(p.type());
+    if (type_list_enable) {
+      add_id_to_type_map(p.id(), p.type());
+    }
+    node_particles[p_node].emplace_back(std::move(p));
+  }
+
+  mpi_call(mpi_make_new_particles_local);
+  std::vector<Particle> local_particles;
+  boost::mpi::scatter(::comm_cart, node_particles, local_particles, 0);
+  for (auto &p : local_particles) {
+    ::cell_structure.add_particle(std::move(p));
+  }
+  on_particle_change();
+}
+
+static void mpi_set_particles_pos_local() {
+  std::vector<std::pair<int, Utils::Vector3d>> updates;
+  boost::mpi::scatter(::comm_cart, updates, 0);
+  for (auto const &[p_id, pos] : updates) {
+    maybe_move_particle(p_id, pos);
+  }
+  ::cell_structure.set_resort_particles(Cells::RESORT_GLOBAL);
+  on_particle_change();
+}
+
+REGISTER_CALLBACK(mpi_set_particles_pos_local)
+
+void mpi_set_particles_pos(Utils::Span<const int> p_ids,
+                           Utils::Span<const Utils::Vector3d> pos) {
+  if (p_ids.size() != pos.size()) {
+    throw std::invalid_argument("Expected one position per particle");
+  }
+
+  /* Group updates per node */
+  std::vector<std::vector<std::pair<int, Utils::Vector3d>>> node_updates(
+      ::comm_cart.size());
+  for (std::size_t i = 0; i < p_ids.size(); ++i) {
+    particle_checks(p_ids[i], pos[i]);
+    node_updates[get_particle_node(p_ids[i])].emplace_back(p_ids[i], pos[i]);
+  }
+
+  mpi_call(mpi_set_particles_pos_local);
+  std::vector<std::pair<int, Utils::Vector3d>> local_updates;
+  boost::mpi::scatter(::comm_cart, node_updates, local_updates, 0);
+  for (auto const &[p_id, pos] : local_updates) {
+    maybe_move_particle(p_id, pos);
+  }
+  ::cell_structure.set_resort_particles(Cells::RESORT_GLOBAL);
+  on_particle_change();
+}
+
 int get_random_p_id(int type, int random_index_in_type_map) {
   auto it = particle_type_map.find(type);
   if (it == particle_type_map.end()) {
@@ -70,6 +70,29 @@ std::size_t fetch_cache_max_size();
  */
 void clear_particle_node();
 
+/** Particle properties that can be read back in bulk. */
+enum class ParticleBulkProperty : int { POS, V, F, Q, TYPE, IMAGE_BOX };
+
+/**
+ * @brief Number of values per particle of a bulk property.
+ */
+int bulk_property_dimension(ParticleBulkProperty property);
+
+/**
+ * @brief Gather a property of many particles in a single collective call.
+ *
+ * The values are written contiguously in the order of @p p_ids, with
+ * @ref bulk_property_dimension values per particle. Positions are unfolded.
+ * Integer properties are converted to floating-point. Call only on the head
+ * node. Non-existing particles raise an exception.
+ *
+ * @param p_ids     The identities of the particles.
+ * @param property  The property to gather.
+ * @return Flat array of the property values.
+ */
+std::vector<double> mpi_get_particles_property(Utils::Span<const int> p_ids,
+                                               ParticleBulkProperty property);
+
 /**
  * @brief Create a new particle and attach it to a cell.
  * Also call @ref on_particle_change.
@@ -78,6 +101,16 @@ void clear_particle_node();
  */
 void mpi_make_new_particle(int p_id, Utils::Vector3d const &pos);
 
+/**
+ * @brief Create new particles and attach them to the cells.
+ * The particles are sent to the MPI ranks owning their positions in a
+ * single collective call, instead of one call per particle.
+ * Also call @ref on_particle_change.
+ * @param particles  The particles to create. Ids must be unique and not
+ *                   in use. Positions are folded. Bonds are not allowed.
+ */
+void mpi_make_new_particles(std::vector<Particle> particles);
+
 /**
  * @brief Move particle to a new position.
  * Also call @ref on_particle_change.
@@ -86,6 +119,15 @@ void mpi_make_new_particle(int p_id, Utils::Vector3d const &pos);
  */
 void mpi_set_particle_pos(int p_id, Utils::Vector3d const &pos);
 
+/**
+ * @brief Move particles to new positions in a single collective call.
+ * Also call @ref on_particle_change.
+ * @param p_ids The identities of the particles to move.
+ * @param pos   The new particle positions.
+ */
+void mpi_set_particles_pos(Utils::Span<const int> p_ids,
+                           Utils::Span<const Utils::Vector3d> pos);
+
 /** Remove particle with a given identity. Also removes all bonds to the
  *  particle.
  *  @param p_id     identity of the particle to remove
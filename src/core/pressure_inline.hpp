@@ -62,9 +62,9 @@ inline void add_non_bonded_pair_virials(
   if (do_nonbonded(p1, p2))
 #endif
   {
-    auto const &ia_params = get_ia_param(p1.type(), p2.type());
+    auto const &ia_entry = get_ia_pair_entry(p1.type(), p2.type());
     auto const force =
-        calc_non_bonded_pair_force(p1, p2, ia_params, d, dist, kernel_forces).f;
+        calc_non_bonded_pair_force(p1, p2, ia_entry, d, dist, kernel_forces).f;
     auto const stress = Utils::tensor_product(d, force);
 
     auto const type1 = p1.mol_id();
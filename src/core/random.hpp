@@ -26,6 +26,7 @@
  *  Random number generation using Philox.
  */
 
+#include <utils/Span.hpp>
 #include <utils/Vector.hpp>
 #include <utils/constants.hpp>
 #include <utils/u32_to_u64.hpp>
@@ -33,7 +34,13 @@
 
 #include <Random123/philox.h>
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -57,10 +64,73 @@ enum class RNGSalt : uint32_t {
   NPTISO0_HALF_STEP2,
   NPTISOV,
   SALT_DPD,
-  THERMALIZED_BOND
+  THERMALIZED_BOND,
+  STOKESIAN_TRANS,
+  STOKESIAN_ROT
 };
 
 namespace Random {
+namespace detail {
+/** @brief Number of Philox streams interleaved in the batched generator. */
+constexpr std::size_t philox_lanes = 8u;
+
+template <RNGSalt salt>
+auto philox_key(uint32_t seed, int key1, int key2) {
+  auto const id1 = static_cast<uint32_t>(key1);
+  auto const id2 = static_cast<uint32_t>(key2);
+  return r123::Philox4x64::key_type{
+      {Utils::u32_to_u64(id1, id2),
+       Utils::u32_to_u64(static_cast<uint32_t>(salt), seed)}};
+}
+
+/** @brief Uniform noise in [-0.5, 0.5) from the Philox output. */
+template <std::size_t N, class Integers>
+auto integers_to_uniform(Integers const &integers) {
+  Utils::VectorXd<N> noise{};
+  std::transform(integers.begin(), integers.begin() + N, noise.begin(),
+                 [](std::size_t value) { return Utils::uniform(value) - 0.5; });
+  return noise;
+}
+
+/** @brief Gaussian noise from the Philox output (Box-Muller transform). */
+template <std::size_t N, class Integers>
+auto integers_to_gaussian(Integers const &integers) {
+  static const double epsilon = std::numeric_limits<double>::min();
+
+  constexpr std::size_t M = (N <= 2) ? 2 : 4;
+  Utils::VectorXd<M> u{};
+  std::transform(integers.begin(), integers.begin() + M, u.begin(),
+                 [](std::size_t value) {
+                   auto u = Utils::uniform(value);
+                   return (u < epsilon) ? epsilon : u;
+                 });
+
+  // Box-Muller transform code adapted from
+  // https://en.wikipedia.org/wiki/Box%E2%80%93Muller_transform
+  // optimizations: the modulo is cached (logarithms are expensive), the
+  // sin/cos are evaluated simultaneously by gcc or separately by Clang
+  Utils::VectorXd<N> noise{};
+  constexpr double two_pi = 2.0 * Utils::pi();
+  {
+    auto const modulo = sqrt(-2.0 * log(u[0]));
+    auto const angle = two_pi * u[1];
+    noise[0] = modulo * cos(angle);
+    if (N > 1) {
+      noise[1] = modulo * sin(angle);
+    }
+  }
+  if (N > 2) {
+    auto const modulo = sqrt(-2.0 * log(u[2]));
+    auto const angle = two_pi * u[3];
+    noise[2] = modulo * cos(angle);
+    if (N > 3) {
+      noise[3] = modulo * sin(angle);
+    }
+  }
+  return noise;
+}
+} // namespace detail
+
 /**
  * @brief get 4 random uint 64 from the Philox RNG
  *
@@ -76,16 +146,58 @@ auto philox_4_uint64s(uint64_t counter, uint32_t seed, int key1, int key2 = 0) {
 
   using rng_type = r123::Philox4x64;
   using ctr_type = rng_type::ctr_type;
-  using key_type = rng_type::key_type;
 
   const ctr_type c{{counter, 0u, 0u, 0u}};
 
-  auto const id1 = static_cast<uint32_t>(key1);
-  auto const id2 = static_cast<uint32_t>(key2);
-  const key_type k{{Utils::u32_to_u64(id1, id2),
-                    Utils::u32_to_u64(static_cast<uint32_t>(salt), seed)}};
+  return rng_type{}(c, detail::philox_key<salt>(seed, key1, key2));
+}
+
+/**
+ * @brief Get 4 random uint 64 from the Philox RNG for many key pairs.
+ *
+ * Equivalent to calling @ref philox_4_uint64s for every element of
+ * @p keys1 and @p keys2 with the same counter, but the Philox rounds of
+ * several streams are interleaved, so that the independent multiplications
+ * of different streams can be pipelined or vectorized by the compiler.
+ * The output is bitwise identical to the one of the scalar function.
+ *
+ * @param counter counter for random number generation
+ * @param seed seed for random number generation
+ * @param keys1 first key of each stream
+ * @param keys2 second key of each stream, or empty for key 0
+ * @param out   random integers of each stream
+ */
+template <RNGSalt salt>
+void philox_4_uint64s_batch(uint64_t counter, uint32_t seed,
+                            Utils::Span<const int> keys1,
+                            Utils::Span<const int> keys2,
+                            Utils::Span<r123::Philox4x64::ctr_type> out) {
+  using ctr_type = r123::Philox4x64::ctr_type;
+  using key_type = r123::Philox4x64::key_type;
+  constexpr auto lanes = detail::philox_lanes;
+  assert(out.size() == keys1.size());
+  assert(keys2.empty() or keys2.size() == keys1.size());
 
-  return rng_type{}(c, k);
+  std::array<ctr_type, lanes> ctr;
+  std::array<key_type, lanes> key;
+  for (std::size_t begin = 0u; begin < keys1.size(); begin += lanes) {
+    auto const n = std::min(lanes, keys1.size() - begin);
+    for (std::size_t i = 0u; i < n; ++i) {
+      ctr[i] = ctr_type{{counter, 0u, 0u, 0u}};
+      key[i] = detail::philox_key<salt>(
+          seed, keys1[begin + i], keys2.empty() ? 0 : keys2[begin + i]);
+    }
+    // same sequence of rounds and key bumps as r123::Philox4x64
+    for (unsigned int round = 0u; round < philox4x64_rounds; ++round) {
+      for (std::size_t i = 0u; i < n; ++i) {
+        if (round > 0u) {
+          key[i] = _philox4x64bumpkey(key[i]);
+        }
+        ctr[i] = _philox4x64round(ctr[i], key[i]);
+      }
+    }
+    std::copy_n(ctr.begin(), n, out.begin() + begin);
+  }
 }
 
 /**
@@ -112,10 +224,7 @@ template <RNGSalt salt, std::size_t N = 3,
 auto noise_uniform(uint64_t counter, uint32_t seed, int key1, int key2 = 0) {
 
   auto const integers = philox_4_uint64s<salt>(counter, seed, key1, key2);
-  Utils::VectorXd<N> noise{};
-  std::transform(integers.begin(), integers.begin() + N, noise.begin(),
-                 [](std::size_t value) { return Utils::uniform(value) - 0.5; });
-  return noise;
+  return detail::integers_to_uniform<N>(integers);
 }
 
 template <RNGSalt salt, std::size_t N, std::enable_if_t<N == 1, int> = 0>
@@ -150,39 +259,60 @@ template <RNGSalt salt, std::size_t N = 3,
 auto noise_gaussian(uint64_t counter, uint32_t seed, int key1, int key2 = 0) {
 
   auto const integers = philox_4_uint64s<salt>(counter, seed, key1, key2);
-  static const double epsilon = std::numeric_limits<double>::min();
-
-  constexpr std::size_t M = (N <= 2) ? 2 : 4;
-  Utils::VectorXd<M> u{};
-  std::transform(integers.begin(), integers.begin() + M, u.begin(),
-                 [](std::size_t value) {
-                   auto u = Utils::uniform(value);
-                   return (u < epsilon) ? epsilon : u;
-                 });
+  return detail::integers_to_gaussian<N>(integers);
+}
 
-  // Box-Muller transform code adapted from
-  // https://en.wikipedia.org/wiki/Box%E2%80%93Muller_transform
-  // optimizations: the modulo is cached (logarithms are expensive), the
-  // sin/cos are evaluated simultaneously by gcc or separately by Clang
-  Utils::VectorXd<N> noise{};
-  constexpr double two_pi = 2.0 * Utils::pi();
-  {
-    auto const modulo = sqrt(-2.0 * log(u[0]));
-    auto const angle = two_pi * u[1];
-    noise[0] = modulo * cos(angle);
-    if (N > 1) {
-      noise[1] = modulo * sin(angle);
-    }
-  }
-  if (N > 2) {
-    auto const modulo = sqrt(-2.0 * log(u[2]));
-    auto const angle = two_pi * u[3];
-    noise[2] = modulo * cos(angle);
-    if (N > 3) {
-      noise[3] = modulo * sin(angle);
-    }
+namespace detail {
+/** @brief Convert the output of @ref philox_4_uint64s_batch chunk-wise. */
+template <RNGSalt salt, class OutputIt, class Kernel>
+void transform_batch(uint64_t counter, uint32_t seed,
+                     Utils::Span<const int> keys1, Utils::Span<const int> keys2,
+                     OutputIt out, Kernel kernel) {
+  std::array<r123::Philox4x64::ctr_type, philox_lanes> integers;
+  for (std::size_t begin = 0u; begin < keys1.size(); begin += philox_lanes) {
+    auto const n = std::min(philox_lanes, keys1.size() - begin);
+    philox_4_uint64s_batch<salt>(
+        counter, seed, Utils::Span<const int>(keys1.data() + begin, n),
+        keys2.empty() ? keys2
+                      : Utils::Span<const int>(keys2.data() + begin, n),
+        Utils::Span<r123::Philox4x64::ctr_type>(integers.data(), n));
+    out = std::transform(integers.begin(), integers.begin() + n, out, kernel);
   }
-  return noise;
+}
+} // namespace detail
+
+/**
+ * @brief Batched generator for random uniform noise.
+ *
+ * Fills @p out with the same values as calls to @ref noise_uniform
+ * for each element of @p keys1 and @p keys2.
+ */
+template <RNGSalt salt, std::size_t N = 3,
+          class = std::enable_if_t<(N > 1) and (N <= 4)>>
+void noise_uniform_batch(uint64_t counter, uint32_t seed,
+                         Utils::Span<const int> keys1,
+                         Utils::Span<const int> keys2,
+                         Utils::Span<Utils::VectorXd<N>> out) {
+  detail::transform_batch<salt>(
+      counter, seed, keys1, keys2, out.begin(),
+      detail::integers_to_uniform<N, r123::Philox4x64::ctr_type>);
+}
+
+/**
+ * @brief Batched generator for Gaussian noise.
+ *
+ * Fills @p out with the same values as calls to @ref noise_gaussian
+ * for each element of @p keys1 and @p keys2.
+ */
+template <RNGSalt salt, std::size_t N = 3,
+          class = std::enable_if_t<(N >= 1) and (N <= 4)>>
+void noise_gaussian_batch(uint64_t counter, uint32_t seed,
+                          Utils::Span<const int> keys1,
+                          Utils::Span<const int> keys2,
+                          Utils::Span<Utils::VectorXd<N>> out) {
+  detail::transform_batch<salt>(
+      counter, seed, keys1, keys2, out.begin(),
+      detail::integers_to_gaussian<N, r123::Philox4x64::ctr_type>);
 }
 
 /** Mersenne Twister with warmup.
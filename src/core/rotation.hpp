@@ -47,6 +47,11 @@
  */
 void propagate_omega_quat_particle(Particle &p, double time_step);
 
+/** @brief Convert the torque to the body-fixed frame and propagate
+ *  angular velocities on a particle.
+ */
+void convert_torque_propagate_omega_particle(Particle &p, double time_step);
+
 /** @brief Convert torques to the body-fixed frame and propagate
  *  angular velocities.
  */
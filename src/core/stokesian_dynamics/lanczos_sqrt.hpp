@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2010-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Krylov subspace approximation of the product of the square root of a
+ *  symmetric positive semi-definite matrix with a vector, see
+ *  @cite chow14a. Used to sample correlated Brownian displacements
+ *  without forming or factorizing the mobility matrix.
+ */
+
+#ifndef STOKESIAN_DYNAMICS_LANCZOS_SQRT_HPP
+#define STOKESIAN_DYNAMICS_LANCZOS_SQRT_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace detail {
+/**
+ * @brief Eigen decomposition of a small dense symmetric matrix by the
+ * cyclic Jacobi method.
+ * @param[in,out] a   Row-major @p n x @p n matrix, diagonalized in place
+ * @param[in]     n   Matrix dimension
+ * @return Row-major matrix whose columns are the eigenvectors
+ */
+inline std::vector<double> jacobi_eigen(std::vector<double> &a, int n) {
+  auto const idx = [n](int i, int j) {
+    return static_cast<std::size_t>(i * n + j);
+  };
+  std::vector<double> q(static_cast<std::size_t>(n * n), 0.);
+  for (int i = 0; i < n; ++i) {
+    q[idx(i, i)] = 1.;
+  }
+  for (int sweep = 0; sweep < 50; ++sweep) {
+    double off = 0.;
+    double diag = 0.;
+    for (int i = 0; i < n; ++i) {
+      diag += a[idx(i, i)] * a[idx(i, i)];
+      for (int j = i + 1; j < n; ++j) {
+        off += a[idx(i, j)] * a[idx(i, j)];
+      }
+    }
+    if (off <= 1e-30 * diag) {
+      break;
+    }
+    for (int p = 0; p < n - 1; ++p) {
+      for (int r = p + 1; r < n; ++r) {
+        auto const apr = a[idx(p, r)];
+        if (apr == 0.) {
+          continue;
+        }
+        auto const theta = (a[idx(r, r)] - a[idx(p, p)]) / (2. * apr);
+        auto const t = std::copysign(1., theta) /
+                       (std::abs(theta) + std::sqrt(theta * theta + 1.));
+        auto const c = 1. / std::sqrt(t * t + 1.);
+        auto const s = t * c;
+        for (int k = 0; k < n; ++k) {
+          auto const akp = a[idx(k, p)];
+          auto const akr = a[idx(k, r)];
+          a[idx(k, p)] = c * akp - s * akr;
+          a[idx(k, r)] = s * akp + c * akr;
+        }
+        for (int k = 0; k < n; ++k) {
+          auto const apk = a[idx(p, k)];
+          auto const ark = a[idx(r, k)];
+          a[idx(p, k)] = c * apk - s * ark;
+          a[idx(r, k)] = s * apk + c * ark;
+        }
+        for (int k = 0; k < n; ++k) {
+          auto const qkp = q[idx(k, p)];
+          auto const qkr = q[idx(k, r)];
+          q[idx(k, p)] = c * qkp - s * qkr;
+          q[idx(k, r)] = s * qkp + c * qkr;
+        }
+      }
+    }
+  }
+  return q;
+}
+
+/**
+ * @brief Compute @f$ T^{1/2} e_1 @f$ for the symmetric tridiagonal
+ * Lanczos matrix @f$ T @f$. Negative eigenvalues from round-off are
+ * clamped to zero.
+ */
+inline std::vector<double>
+sqrt_tridiagonal_e1(std::vector<double> const &alpha,
+                    std::vector<double> const &beta) {
+  auto const n = static_cast<int>(alpha.size());
+  std::vector<double> t(static_cast<std::size_t>(n * n), 0.);
+  for (int i = 0; i < n; ++i) {
+    t[static_cast<std::size_t>(i * n + i)] = alpha[i];
+    if (i + 1 < n) {
+      t[static_cast<std::size_t>(i * n + i + 1)] = beta[i];
+      t[static_cast<std::size_t>((i + 1) * n + i)] = beta[i];
+    }
+  }
+  auto const q = jacobi_eigen(t, n);
+  std::vector<double> res(static_cast<std::size_t>(n), 0.);
+  for (int k = 0; k < n; ++k) {
+    auto const lambda = std::max(t[static_cast<std::size_t>(k * n + k)], 0.);
+    auto const w = std::sqrt(lambda) * q[static_cast<std::size_t>(k)];
+    for (int i = 0; i < n; ++i) {
+      res[i] += w * q[static_cast<std::size_t>(i * n + k)];
+    }
+  }
+  return res;
+}
+} // namespace detail
+
+/**
+ * @brief Approximate @f$ A^{1/2} z @f$ with the Lanczos method.
+ *
+ * The matrix only enters through @p matvec. The vectors can be distributed
+ * over several MPI ranks, as long as @p dot reduces over all of them and
+ * both functors are called collectively.
+ *
+ * @param matvec   Computes the product of the matrix with a vector
+ * @param dot      Computes the scalar product of two vectors
+ * @param z        Input vector
+ * @param max_iter Maximal dimension of the Krylov subspace
+ * @param tol      Relative change of the result at which to stop
+ * @return Approximation of @f$ A^{1/2} z @f$
+ */
+template <class MatVec, class Dot>
+std::vector<double> lanczos_sqrt(MatVec &&matvec, Dot &&dot,
+                                 std::vector<double> const &z, int max_iter,
+                                 double tol) {
+  assert(max_iter > 0);
+  auto const size = z.size();
+  std::vector<double> res(size, 0.);
+  auto const z_norm = std::sqrt(dot(z, z));
+  if (z_norm == 0.) {
+    return res;
+  }
+
+  std::vector<std::vector<double>> basis;
+  std::vector<double> alpha;
+  std::vector<double> beta;
+  std::vector<double> coeffs;
+  std::vector<double> coeffs_prev;
+
+  basis.emplace_back(size);
+  std::transform(z.begin(), z.end(), basis.back().begin(),
+                 [z_norm](double v) { return v / z_norm; });
+
+  for (int k = 0; k < max_iter; ++k) {
+    auto w = matvec(basis[k]);
+    if (k > 0) {
+      for (std::size_t i = 0; i < size; ++i) {
+        w[i] -= beta[k - 1] * basis[k - 1][i];
+      }
+    }
+    alpha.push_back(dot(w, basis[k]));
+    for (std::size_t i = 0; i < size; ++i) {
+      w[i] -= alpha[k] * basis[k][i];
+    }
+    auto const w_norm = std::sqrt(dot(w, w));
+
+    coeffs = detail::sqrt_tridiagonal_e1(alpha, beta);
+    /* the basis is orthonormal, so the change of the result can be
+     * measured on the coefficients alone */
+    coeffs_prev.resize(coeffs.size(), 0.);
+    double change = 0.;
+    double norm = 0.;
+    for (std::size_t i = 0; i < coeffs.size(); ++i) {
+      change += (coeffs[i] - coeffs_prev[i]) * (coeffs[i] - coeffs_prev[i]);
+      norm += coeffs[i] * coeffs[i];
+    }
+    if ((k > 0 and change <= tol * tol * norm) or
+        w_norm <= 1e-12 * std::abs(alpha[0])) {
+      break;
+    }
+    coeffs_prev = coeffs;
+
+    beta.push_back(w_norm);
+    basis.emplace_back(size);
+    std::transform(w.begin(), w.end(), basis.back().begin(),
+                   [w_norm](double v) { return v / w_norm; });
+  }
+
+  for (std::size_t j = 0; j < coeffs.size(); ++j) {
+    for (std::size_t i = 0; i < size; ++i) {
+      res[i] += z_norm * coeffs[j] * basis[j][i];
+    }
+  }
+  return res;
+}
+
+#endif
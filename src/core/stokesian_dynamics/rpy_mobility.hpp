@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2010-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Matrix-free Rotne-Prager-Yamakawa mobility of polydisperse spheres
+ *  in an unbounded fluid. See @cite zuk14a for the regularization of
+ *  overlapping spheres.
+ */
+
+#ifndef STOKESIAN_DYNAMICS_RPY_MOBILITY_HPP
+#define STOKESIAN_DYNAMICS_RPY_MOBILITY_HPP
+
+#include <utils/Vector.hpp>
+#include <utils/constants.hpp>
+#include <utils/math/sqr.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/** Translational self-mobility of a sphere. */
+inline double rpy_self_mobility(double radius, double viscosity) {
+  return 1. / (6. * Utils::pi() * viscosity * radius);
+}
+
+/** Rotational self-mobility of a sphere. */
+inline double rpy_self_rotational_mobility(double radius, double viscosity) {
+  return 1. / (8. * Utils::pi() * viscosity * radius * radius * radius);
+}
+
+/**
+ * @brief Velocity of sphere @f$ i @f$ induced by a force on sphere
+ * @f$ j @f$, i.e. the product of the Rotne-Prager-Yamakawa pair mobility
+ * tensor @f$ \mathbf{M}_{ij} @f$ with the force.
+ *
+ * The tensor is evaluated on the fly and never stored.
+ *
+ * @param d         Distance vector @f$ \mathbf{x}_i - \mathbf{x}_j @f$
+ * @param a_i       Radius of sphere @f$ i @f$
+ * @param a_j       Radius of sphere @f$ j @f$
+ * @param viscosity Dynamic viscosity of the fluid
+ * @param f         Force acting on sphere @f$ j @f$
+ */
+inline Utils::Vector3d rpy_pair_velocity(Utils::Vector3d const &d, double a_i,
+                                         double a_j, double viscosity,
+                                         Utils::Vector3d const &f) {
+  auto const r2 = d.norm2();
+  auto const r = std::sqrt(r2);
+  /* one sphere is fully inside the other one */
+  if (r <= std::abs(a_i - a_j)) {
+    return rpy_self_mobility(std::max(a_i, a_j), viscosity) * f;
+  }
+  double c_identity, c_dyad;
+  if (r > a_i + a_j) {
+    auto const pref = 1. / (8. * Utils::pi() * viscosity * r);
+    auto const s = (a_i * a_i + a_j * a_j) / r2;
+    c_identity = pref * (1. + s / 3.);
+    c_dyad = pref * (1. - s);
+  } else {
+    auto const pref =
+        1. / (6. * Utils::pi() * viscosity * a_i * a_j * 32. * r2 * r);
+    auto const diff2 = Utils::sqr(a_i - a_j);
+    c_identity =
+        pref * (16. * r2 * r * (a_i + a_j) - Utils::sqr(diff2 + 3. * r2));
+    c_dyad = pref * 3. * Utils::sqr(diff2 - r2);
+  }
+  return c_identity * f + (c_dyad * (d * f) / r2) * d;
+}
+
+#endif
@@ -22,24 +22,33 @@
 #ifdef STOKESIAN_DYNAMICS
 #include "sd_interface.hpp"
 
+#include "stokesian_dynamics/lanczos_sqrt.hpp"
+#include "stokesian_dynamics/rpy_mobility.hpp"
 #include "stokesian_dynamics/sd_cpu.hpp"
 
 #include "Particle.hpp"
 #include "ParticleRange.hpp"
+#include "errorhandling.hpp"
 #include "grid.hpp"
+#include "random.hpp"
 #include "thermostat.hpp"
 
 #include <utils/Vector.hpp>
 #include <utils/mpi/gather_buffer.hpp>
 #include <utils/mpi/scatter_buffer.hpp>
 
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/collectives/all_gatherv.hpp>
+#include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/range/algorithm.hpp>
 #include <boost/serialization/is_bitwise_serializable.hpp>
 
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <iterator>
+#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -139,9 +148,157 @@ void set_sd_kT(double kT) {
 
 double get_sd_kT() { return sd_kT; }
 
+/** Maximal dimension of the Krylov subspace for the Brownian
+ *  displacements of the matrix-free solver. */
+static constexpr int sd_rpy_lanczos_max_iter = 50;
+/** Relative tolerance of the Brownian displacements of the matrix-free
+ *  solver. */
+static constexpr double sd_rpy_lanczos_tol = 1e-4;
+
+/**
+ * @brief Matrix-free Rotne-Prager-Yamakawa solver.
+ *
+ * Every rank computes the velocities of its own particles. Only the
+ * positions, radii and the vector the mobility is applied to are exchanged
+ * between ranks, so the memory footprint is linear in the number of
+ * particles and the pair sums are shared by all ranks. Thermal noise is
+ * sampled with the Lanczos method, which only needs the same
+ * matrix-vector product.
+ */
+static void propagate_vel_pos_sd_rpy(const ParticleRange &particles,
+                                     const boost::mpi::communicator &comm,
+                                     const double time_step) {
+  auto const eta = params.viscosity;
+  auto const with_self =
+      params.flags & static_cast<int>(sd_flags::SELF_MOBILITY);
+  auto const with_pair =
+      params.flags & static_cast<int>(sd_flags::PAIR_MOBILITY);
+
+  std::vector<Particle *> local_parts;
+  std::vector<double> local_pos;
+  std::vector<double> local_radii;
+  bool missing_radius = false;
+  for (auto &p : particles) {
+    if (p.is_virtual()) {
+      continue;
+    }
+    auto const it = params.radii.find(p.type());
+    if (it == params.radii.end()) {
+      runtimeErrorMsg() << "Stokesian Dynamics: no radius for particle type "
+                        << p.type();
+      missing_radius = true;
+      continue;
+    }
+    local_parts.push_back(&p);
+    local_pos.insert(local_pos.end(), p.pos().begin(), p.pos().end());
+    local_radii.push_back(it->second);
+  }
+  if (boost::mpi::all_reduce(comm, missing_radius, std::logical_or<>())) {
+    return;
+  }
+
+  auto const n_local = static_cast<int>(local_parts.size());
+  std::vector<int> sizes;
+  boost::mpi::all_gather(comm, n_local, sizes);
+  auto const offset =
+      std::accumulate(sizes.begin(), sizes.begin() + comm.rank(), 0);
+  auto const n_part = std::accumulate(sizes.begin(), sizes.end(), 0);
+  std::vector<int> sizes_3d(sizes.size());
+  std::transform(sizes.begin(), sizes.end(), sizes_3d.begin(),
+                 [](int n) { return 3 * n; });
+
+  std::vector<double> all_pos(3 * static_cast<std::size_t>(n_part));
+  std::vector<double> all_radii(static_cast<std::size_t>(n_part));
+  boost::mpi::all_gatherv(comm, local_pos, all_pos, sizes_3d);
+  boost::mpi::all_gatherv(comm, local_radii, all_radii, sizes);
+
+  std::vector<double> all_x(3 * static_cast<std::size_t>(n_part));
+  /* product of the translational mobility matrix with a distributed vector */
+  auto const matvec = [&](std::vector<double> const &x) {
+    boost::mpi::all_gatherv(comm, x, all_x, sizes_3d);
+    std::vector<double> y(x.size(), 0.);
+    for (int i = 0; i < n_local; ++i) {
+      auto const gi = offset + i;
+      Utils::Vector3d const pos_i{all_pos.data() + 3 * gi,
+                                  all_pos.data() + 3 * gi + 3};
+      auto const a_i = all_radii[gi];
+      Utils::Vector3d vel{};
+      if (with_self) {
+        vel += rpy_self_mobility(a_i, eta) *
+               Utils::Vector3d{x.data() + 3 * i, x.data() + 3 * i + 3};
+      }
+      if (with_pair) {
+        for (int j = 0; j < n_part; ++j) {
+          if (j == gi) {
+            continue;
+          }
+          Utils::Vector3d const pos_j{all_pos.data() + 3 * j,
+                                      all_pos.data() + 3 * j + 3};
+          Utils::Vector3d const x_j{all_x.data() + 3 * j,
+                                    all_x.data() + 3 * j + 3};
+          vel += rpy_pair_velocity(pos_i - pos_j, a_i, all_radii[j], eta, x_j);
+        }
+      }
+      std::copy(vel.begin(), vel.end(), y.begin() + 3 * i);
+    }
+    return y;
+  };
+  auto const dot = [&comm](std::vector<double> const &a,
+                           std::vector<double> const &b) {
+    auto const local = std::inner_product(a.begin(), a.end(), b.begin(), 0.);
+    return boost::mpi::all_reduce(comm, local, std::plus<>());
+  };
+
+  std::vector<double> forces;
+  forces.reserve(3 * local_parts.size());
+  for (auto const p : local_parts) {
+    forces.insert(forces.end(), p->force().begin(), p->force().end());
+  }
+  auto vel = matvec(forces);
+
+  if (sd_kT > 0.) {
+    std::vector<double> noise;
+    noise.reserve(3 * local_parts.size());
+    for (auto const p : local_parts) {
+      auto const z = Random::noise_gaussian<RNGSalt::STOKESIAN_TRANS>(
+          stokesian.rng_counter(), stokesian.rng_seed(), p->id());
+      noise.insert(noise.end(), z.begin(), z.end());
+    }
+    auto const brownian = lanczos_sqrt(matvec, dot, noise,
+                                       sd_rpy_lanczos_max_iter,
+                                       sd_rpy_lanczos_tol);
+    auto const pref = std::sqrt(2. * sd_kT / time_step);
+    for (std::size_t i = 0; i < vel.size(); ++i) {
+      vel[i] += pref * brownian[i];
+    }
+  }
+
+  for (int i = 0; i < n_local; ++i) {
+    auto &p = *local_parts[i];
+    auto const a_i = local_radii[i];
+    p.v() = Utils::Vector3d{vel.data() + 3 * i, vel.data() + 3 * i + 3};
+    p.omega() = {};
+    if (with_self) {
+      auto const mu_rot = rpy_self_rotational_mobility(a_i, eta);
+      p.omega() = mu_rot * p.torque();
+      if (sd_kT > 0.) {
+        p.omega() += std::sqrt(2. * sd_kT * mu_rot / time_step) *
+                     Random::noise_gaussian<RNGSalt::STOKESIAN_ROT>(
+                         stokesian.rng_counter(), stokesian.rng_seed(),
+                         p.id());
+      }
+    }
+  }
+}
+
 void propagate_vel_pos_sd(const ParticleRange &particles,
                           const boost::mpi::communicator &comm,
                           const double time_step) {
+  if (params.flags & static_cast<int>(sd_flags::RPY)) {
+    propagate_vel_pos_sd_rpy(particles, comm, time_step);
+    return;
+  }
+
   static std::vector<SD_particle_data> parts_buffer{};
 
   parts_buffer.clear();
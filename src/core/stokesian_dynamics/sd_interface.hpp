@@ -48,7 +48,9 @@ enum class sd_flags : int {
   SELF_MOBILITY = 1 << 0,
   PAIR_MOBILITY = 1 << 1,
   LUBRICATION = 1 << 2,
-  FTS = 1 << 3
+  FTS = 1 << 3,
+  /** matrix-free Rotne-Prager-Yamakawa mobility, distributed over ranks */
+  RPY = 1 << 4
 };
 
 void register_integrator(StokesianDynamicsParameters const &obj);
@@ -60,6 +62,8 @@ double get_sd_kT();
  *  velocities. Acts globally on particles on all nodes; i.e. particle data
  *  is gathered from all nodes and their velocities and angular velocities are
  *  set according to the Stokesian Dynamics method.
+ *  With @ref sd_flags::RPY, the mobility is instead applied matrix-free on
+ *  all nodes and only positions and forces are exchanged.
  */
 void propagate_vel_pos_sd(const ParticleRange &particles,
                           const boost::mpi::communicator &comm,
@@ -40,10 +40,12 @@
  *  @param[in]     p              %Particle
  *  @param[in]     time_step      Time step
  *  @param[in]     kT             Temperature
+ *  @param[in]     noise          Uniform noise of the particle
  */
 inline Utils::Vector3d
 friction_thermo_langevin(LangevinThermostat const &langevin, Particle const &p,
-                         double time_step, double kT) {
+                         double time_step, double kT,
+                         Utils::Vector3d const &noise) {
   // Early exit for virtual particles without thermostat
   if (p.is_virtual() and !thermo_virtual) {
     return {};
@@ -87,9 +89,23 @@ friction_thermo_langevin(LangevinThermostat const &langevin, Particle const &p,
   auto const &noise_op = pref_noise;
 #endif // PARTICLE_ANISOTROPY
 
-  return friction_op * velocity +
-         noise_op * Random::noise_uniform<RNGSalt::LANGEVIN>(
-                        langevin.rng_counter(), langevin.rng_seed(), p.id());
+  return friction_op * velocity + noise_op * noise;
+}
+
+/** Langevin thermostat for particle translational velocities.
+ *  Draws the noise of the particle and applies the noise and friction term.
+ *  @param[in]     langevin       Parameters
+ *  @param[in]     p              %Particle
+ *  @param[in]     time_step      Time step
+ *  @param[in]     kT             Temperature
+ */
+inline Utils::Vector3d
+friction_thermo_langevin(LangevinThermostat const &langevin, Particle const &p,
+                         double time_step, double kT) {
+  return friction_thermo_langevin(
+      langevin, p, time_step, kT,
+      Random::noise_uniform<RNGSalt::LANGEVIN>(langevin.rng_counter(),
+                                               langevin.rng_seed(), p.id()));
 }
 
 #ifdef ROTATION
@@ -101,11 +117,12 @@ friction_thermo_langevin(LangevinThermostat const &langevin, Particle const &p,
  *  @param[in]     p              %Particle
  *  @param[in]     time_step      Time step
  *  @param[in]     kT             Temperature
+ *  @param[in]     noise          Uniform noise of the particle
  */
 inline Utils::Vector3d
 friction_thermo_langevin_rotation(LangevinThermostat const &langevin,
                                   Particle const &p, double time_step,
-                                  double kT) {
+                                  double kT, Utils::Vector3d const &noise) {
 
   auto pref_friction = -langevin.gamma_rotation;
   auto pref_noise = langevin.pref_noise_rotation;
@@ -121,11 +138,26 @@ friction_thermo_langevin_rotation(LangevinThermostat const &langevin,
   }
 #endif // THERMOSTAT_PER_PARTICLE
 
-  auto const noise = Random::noise_uniform<RNGSalt::LANGEVIN_ROT>(
-      langevin.rng_counter(), langevin.rng_seed(), p.id());
   return hadamard_product(pref_friction, p.omega()) +
          hadamard_product(pref_noise, noise);
 }
 
+/** Langevin thermostat for particle angular velocities.
+ *  Draws the noise of the particle and applies the noise and friction term.
+ *  @param[in]     langevin       Parameters
+ *  @param[in]     p              %Particle
+ *  @param[in]     time_step      Time step
+ *  @param[in]     kT             Temperature
+ */
+inline Utils::Vector3d
+friction_thermo_langevin_rotation(LangevinThermostat const &langevin,
+                                  Particle const &p, double time_step,
+                                  double kT) {
+  return friction_thermo_langevin_rotation(
+      langevin, p, time_step, kT,
+      Random::noise_uniform<RNGSalt::LANGEVIN_ROT>(
+          langevin.rng_counter(), langevin.rng_seed(), p.id()));
+}
+
 #endif // ROTATION
 #endif
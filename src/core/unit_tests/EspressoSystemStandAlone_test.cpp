@@ -242,6 +242,18 @@ BOOST_FIXTURE_TEST_CASE(espresso_system_stand_alone, ParticleFactory,
     mpi_call_all(mpi_set_lj_local, key_ab, eps, sig, cut, offset, min, shift);
     mpi_call_all(mpi_set_lj_local, key_bb, eps, sig, cut, offset, min, shift);
 
+    // check the compiled type-pair table is symmetric and only has LJ active
+    for (int i = 0; i <= type_b; ++i) {
+      for (int j = 0; j <= type_b; ++j) {
+        auto const &entry = get_ia_pair_entry(i, j);
+        auto const has_lj = get_ia_param_key(i, j) == key_ab or
+                            get_ia_param_key(i, j) == key_bb;
+        BOOST_CHECK_EQUAL(entry.params, &get_ia_param(i, j));
+        BOOST_CHECK_EQUAL(entry.max_cut, get_ia_param(i, j).max_cut);
+        BOOST_CHECK_EQUAL(entry.kernels, has_lj ? NB_LJ : 0u);
+      }
+    }
+
     // matrix indices and reference energy value
     auto const max_type = type_b + 1;
     auto const n_pairs = Utils::upper_triangular(type_b, type_b, max_type) + 1;
@@ -287,6 +299,14 @@ BOOST_FIXTURE_TEST_CASE(espresso_system_stand_alone, ParticleFactory,
     BOOST_CHECK_CLOSE(obs_energy->bonded[none_bond_id], none_energy, 0.0);
     BOOST_CHECK_CLOSE(obs_energy->bonded[harm_bond_id], harm_energy, 40. * tol);
     BOOST_CHECK_CLOSE(obs_energy->bonded[fene_bond_id], fene_energy, 40. * tol);
+
+    // bond topology changes must be picked up by the bond loop
+    auto const fene_bond_view = std::vector<int>{fene_bond_id, pid3};
+    delete_particle_bond(pid2, Utils::make_const_span(fene_bond_view));
+    BOOST_CHECK_EQUAL(mpi_calculate_energy()->bonded[fene_bond_id], 0.);
+    add_particle_bond(pid2, fene_bond_view);
+    BOOST_CHECK_CLOSE(mpi_calculate_energy()->bonded[fene_bond_id],
+                      fene_energy, 40. * tol);
   }
 
   // check electrostatics
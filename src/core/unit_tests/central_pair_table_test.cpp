@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE CentralPairTable test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "nonbonded_interactions/central_pair_table.hpp"
+
+#include <cmath>
+
+BOOST_AUTO_TEST_CASE(central_pair_table) {
+  /* Morse-like potential */
+  auto const energy = [](double r) {
+    auto const e = std::exp(-2. * (r - 1.));
+    return e * e - 2. * e;
+  };
+  auto const force = [](double r) {
+    auto const e = std::exp(-2. * (r - 1.));
+    return 4. * (e * e - e);
+  };
+  auto const r_min = 0.8;
+  auto const r_max = 3.;
+  CentralPairTable const table(r_min, r_max, 2000, force, energy);
+
+  /* range */
+  BOOST_CHECK(not CentralPairTable{}.covers(0.));
+  BOOST_CHECK(not CentralPairTable{}.covers(-1.));
+  BOOST_CHECK(table.covers(r_min));
+  BOOST_CHECK(table.covers(std::nextafter(r_max, 0.)));
+  BOOST_CHECK(not table.covers(r_max));
+  BOOST_CHECK(not table.covers(0.5 * r_min));
+
+  for (int i = 0; i < 997; ++i) {
+    auto const r = r_min + (r_max - r_min) * i / 997.;
+    /* accuracy of the interpolation */
+    BOOST_CHECK_SMALL(table.energy(r) - energy(r), 1e-10);
+    BOOST_CHECK_SMALL(table.force_factor(r) - force(r) / r, 1e-6);
+    /* consistency of forces and energies */
+    auto const h = 1e-6;
+    if (r - h >= r_min) {
+      auto const du = (table.energy(r + h) - table.energy(r - h)) / (2. * h);
+      BOOST_CHECK_SMALL(table.force_factor(r) + du / r, 1e-6);
+    }
+  }
+
+  /* interpolation is exact at the knots */
+  auto const step = (r_max - r_min) / 2000.;
+  for (int i = 0; i < 2000; i += 13) {
+    auto const r = r_min + i * step;
+    BOOST_CHECK_SMALL(table.energy(r) - energy(r), 1e-12);
+    BOOST_CHECK_SMALL(table.force_factor(r) - force(r) / r, 1e-9);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(discontinuous_potential) {
+  /* Gaussian potential cut off at 1.843 without shift and a shifted
+   * Morse potential cut off at 2.253 */
+  auto const r_gauss = 1.843;
+  auto const r_morse = 2.253;
+  auto const morse = [](double r) {
+    return std::exp(-3.03 * (r - 0.923));
+  };
+  auto const energy = [=](double r) {
+    auto u = 0.;
+    if (r < r_gauss)
+      u += 6.92 * std::exp(-0.5 * r * r / (1.03 * 1.03));
+    if (r < r_morse) {
+      auto const e = morse(r);
+      auto const e_cut = morse(r_morse);
+      u += 1.92 * ((e * e - 2. * e) - (e_cut * e_cut - 2. * e_cut));
+    }
+    return u;
+  };
+  auto const force = [=](double r) {
+    auto f = 0.;
+    if (r < r_gauss)
+      f += 6.92 * r / (1.03 * 1.03) * std::exp(-0.5 * r * r / (1.03 * 1.03));
+    if (r < r_morse) {
+      auto const e = morse(r);
+      f += 1.92 * 2. * 3.03 * (e * e - e);
+    }
+    return f;
+  };
+  auto const r_min = 0.5;
+  CentralPairTable const table(r_min, r_morse, 4000, force, energy,
+                               {r_morse, 0.1, r_gauss, r_gauss});
+
+  BOOST_CHECK(table.covers(std::nextafter(r_morse, 0.)));
+  BOOST_CHECK(not table.covers(r_morse));
+
+  /* no interval spans the jump of the energy */
+  for (auto const r : {std::nextafter(r_gauss, 0.), r_gauss,
+                       std::nextafter(r_morse, 0.)}) {
+    BOOST_CHECK_SMALL(table.energy(r) - energy(r), 1e-10);
+    BOOST_CHECK_SMALL(table.force_factor(r) - force(r) / r, 1e-6);
+  }
+  for (int i = 0; i < 150; ++i) {
+    auto const r = 0.6 + 0.011 * i;
+    if (table.covers(r)) {
+      BOOST_CHECK_SMALL(table.energy(r) - energy(r), 1e-8);
+      BOOST_CHECK_SMALL(table.force_factor(r) - force(r) / r, 1e-6);
+    }
+  }
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Unit tests for the pre-generated DPD noise. */
+
+#define BOOST_TEST_MODULE DPD test
+#define BOOST_TEST_DYN_LINK
+
+#include "config/config.hpp"
+
+#ifdef DPD
+
+#include <boost/test/unit_test.hpp>
+
+#include "Particle.hpp"
+#include "dpd.hpp"
+#include "nonbonded_interactions/nonbonded_interaction_data.hpp"
+#include "thermostat.hpp"
+
+#include <utils/Vector.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+std::vector<Particle> make_particles(std::size_t n) {
+  std::mt19937 engine(42);
+  std::uniform_real_distribution<double> dist(0., 2.);
+  std::vector<Particle> particles(n);
+  for (std::size_t i = 0u; i < n; ++i) {
+    auto &p = particles[i];
+    p.id() = static_cast<int>(i);
+    p.pos() = {dist(engine), dist(engine), dist(engine)};
+    p.v() = {dist(engine) - 1., dist(engine) - 1., dist(engine) - 1.};
+  }
+  return particles;
+}
+
+IA_parameters make_ia_params(double radial_pref, double trans_pref) {
+  IA_parameters ia_params{};
+  ia_params.dpd = DPD_Parameters{1.5, 1., 1.2, 1, 0.7, 1.0, 0};
+  ia_params.dpd.radial.pref = radial_pref;
+  ia_params.dpd.trans.pref = trans_pref;
+  return ia_params;
+}
+
+/** Loop over all pairs like the short-range loop does. */
+template <class Kernel>
+void for_each_pair(std::vector<Particle> &particles, Kernel kernel) {
+  for (std::size_t i = 0u; i < particles.size(); ++i) {
+    for (std::size_t j = i + 1u; j < particles.size(); ++j) {
+      auto &p1 = particles[i];
+      auto &p2 = particles[j];
+      auto const d = p1.pos() - p2.pos();
+      kernel(p1, p2, d, d.norm(), d.norm2());
+    }
+  }
+}
+
+/** Apply the pair forces with pre-generated noise in loop order. */
+void add_queued_pair_forces(std::vector<Particle> &particles,
+                            IA_parameters const &ia_params) {
+  for_each_pair(particles, [&](Particle &p1, Particle &p2,
+                               Utils::Vector3d const &d, double dist,
+                               double dist2) {
+    auto const force =
+        dpd_queued_pair_force(p1, p2, ia_params, d, dist, dist2);
+    p1.force() += force;
+    p2.force() -= force;
+  });
+}
+
+void add_reference_pair_forces(std::vector<Particle> &particles,
+                               IA_parameters const &ia_params) {
+  for_each_pair(particles, [&](Particle &p1, Particle &p2,
+                               Utils::Vector3d const &d, double dist,
+                               double dist2) {
+    auto const force = dpd_pair_force(p1, p2, ia_params, d, dist, dist2);
+    p1.force() += force;
+    p2.force() -= force;
+  });
+}
+
+void check_forces(std::vector<Particle> const &particles,
+                  std::vector<Particle> const &reference) {
+  for (std::size_t i = 0u; i < particles.size(); ++i) {
+    for (unsigned int k = 0u; k < 3u; ++k) {
+      BOOST_CHECK_EQUAL(particles[i].force()[k], reference[i].force()[k]);
+    }
+  }
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(queued_noise_matches_pair_force) {
+  dpd.rng_initialize(17u);
+  // more pairs than one noise block, with and without noise
+  for (auto const pref : {0., 2.5}) {
+    auto const ia_params = make_ia_params(pref, 0.5 * pref);
+    auto particles = make_particles(30u);
+    auto reference = particles;
+    add_reference_pair_forces(reference, ia_params);
+
+    dpd_clear_queue();
+    for_each_pair(particles, [&](Particle &p1, Particle &p2,
+                                 Utils::Vector3d const &, double dist,
+                                 double) {
+      dpd_queue_pair(p1, p2, ia_params, dist);
+    });
+    dpd_generate_queued_noise();
+    add_queued_pair_forces(particles, ia_params);
+    check_forces(particles, reference);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(partially_queued_noise) {
+  dpd.rng_initialize(17u);
+  auto const ia_params = make_ia_params(2.5, 1.25);
+  auto particles = make_particles(20u);
+  auto reference = particles;
+  add_reference_pair_forces(reference, ia_params);
+
+  // pairs missing from the queue draw their noise directly
+  dpd_clear_queue();
+  std::size_t n_pairs = 0u;
+  for_each_pair(particles, [&](Particle &p1, Particle &p2,
+                               Utils::Vector3d const &, double dist, double) {
+    if (n_pairs++ % 3u != 0u) {
+      dpd_queue_pair(p1, p2, ia_params, dist);
+    }
+  });
+  dpd_generate_queued_noise();
+  add_queued_pair_forces(particles, ia_params);
+  check_forces(particles, reference);
+}
+
+BOOST_AUTO_TEST_CASE(clear_queue) {
+  dpd.rng_initialize(17u);
+  auto const ia_params = make_ia_params(2.5, 1.25);
+  auto particles = make_particles(10u);
+  auto reference = particles;
+  add_reference_pair_forces(reference, ia_params);
+
+  for_each_pair(particles, [&](Particle &p1, Particle &p2,
+                               Utils::Vector3d const &, double dist, double) {
+    dpd_queue_pair(p1, p2, ia_params, dist);
+  });
+  dpd_generate_queued_noise();
+  dpd_clear_queue();
+  add_queued_pair_forces(particles, ia_params);
+  check_forces(particles, reference);
+}
+
+#else  // DPD
+int main(int argc, char **argv) {}
+#endif // DPD
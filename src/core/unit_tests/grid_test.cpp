@@ -305,3 +305,27 @@ BOOST_AUTO_TEST_CASE(regular_decomposition_test) {
         }
   }
 }
+
+BOOST_AUTO_TEST_CASE(regular_decomposition_splits_test) {
+  auto const eps = std::numeric_limits<double>::epsilon();
+
+  auto const box_l = Utils::Vector3d{10, 20, 30};
+  auto box = BoxGeometry();
+  box.set_length(box_l);
+  auto const node_grid = Utils::Vector3i{1, 2, 3};
+  auto const splits = NodeGridSplits{{{}, {0., 0.25, 1.}, {0., 0.5, 0.75, 1.}}};
+
+  auto const result = regular_decomposition(box, {0, 1, 2}, node_grid, splits);
+  auto const local_box_l = result.length();
+  auto const lower_corner = result.my_left();
+
+  /* uniform in x */
+  BOOST_CHECK_CLOSE(local_box_l[0], 10., 100. * eps);
+  BOOST_CHECK_SMALL(lower_corner[0], eps);
+  /* split in y and z */
+  BOOST_CHECK_CLOSE(local_box_l[1], 15., 100. * eps);
+  BOOST_CHECK_CLOSE(lower_corner[1], 5., 100. * eps);
+  BOOST_CHECK_CLOSE(local_box_l[2], 7.5, 100. * eps);
+  BOOST_CHECK_CLOSE(lower_corner[2], 22.5, 100. * eps);
+  BOOST_CHECK_EQUAL(result.boundary()[5], -1);
+}
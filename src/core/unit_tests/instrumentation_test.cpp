@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Unit tests for the built-in timers and counters. */
+
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_MODULE Instrumentation test
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "instrumentation.hpp"
+
+#include <boost/mpi.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace Instrumentation;
+
+BOOST_AUTO_TEST_CASE(timers_and_counters) {
+  reset();
+  BOOST_CHECK_EQUAL(local_time(Timer::FORCE_CALC), 0.);
+  BOOST_CHECK_EQUAL(local_count(Counter::PAIRS), 0u);
+
+  {
+    ScopedTimer timer(Timer::FORCE_CALC);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  auto const elapsed = local_time(Timer::FORCE_CALC);
+  BOOST_CHECK_GE(elapsed, 2e-3);
+  BOOST_CHECK_EQUAL(local_time(Timer::SHORT_RANGE), 0.);
+
+  // timers accumulate
+  { ScopedTimer timer(Timer::FORCE_CALC); }
+  BOOST_CHECK_GE(local_time(Timer::FORCE_CALC), elapsed);
+
+  count(Counter::PAIRS, 5);
+  count(Counter::PAIRS);
+  count(Counter::STEPS);
+  BOOST_CHECK_EQUAL(local_count(Counter::PAIRS), 6u);
+  BOOST_CHECK_EQUAL(local_count(Counter::STEPS), 1u);
+
+  reset();
+  BOOST_CHECK_EQUAL(local_time(Timer::FORCE_CALC), 0.);
+  BOOST_CHECK_EQUAL(local_count(Counter::PAIRS), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(names) {
+  BOOST_CHECK_EQUAL(name(Timer::INTEGRATE), "integrate");
+  BOOST_CHECK_EQUAL(name(Timer::MPI_WAIT), "mpi_wait");
+  BOOST_CHECK_EQUAL(name(Counter::GHOST_BYTES_SENT), "ghost_bytes_sent");
+  BOOST_CHECK_THROW(name(Timer::N_TIMERS), std::out_of_range);
+  BOOST_CHECK_THROW(name(Counter::N_COUNTERS), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(reduction) {
+  boost::mpi::communicator world;
+  auto const rank = static_cast<std::size_t>(world.rank());
+  auto const size = static_cast<double>(world.size());
+
+  reset();
+  count(Counter::STEPS, 3);
+  count(Counter::PAIRS, 10 * (rank + 1));
+
+  auto const report = reduce_report(world);
+  if (world.rank() == 0) {
+    auto const steps = report.counters[static_cast<int>(Counter::STEPS)];
+    BOOST_CHECK_EQUAL(steps.min, 3.);
+    BOOST_CHECK_EQUAL(steps.avg, 3.);
+    BOOST_CHECK_EQUAL(steps.max, 3.);
+    auto const pairs = report.counters[static_cast<int>(Counter::PAIRS)];
+    BOOST_CHECK_EQUAL(pairs.min, 10.);
+    BOOST_CHECK_CLOSE(pairs.avg, 5. * (size + 1.), 1e-10);
+    BOOST_CHECK_EQUAL(pairs.max, 10. * size);
+    auto const fft = report.timers[static_cast<int>(Timer::FFT)];
+    BOOST_CHECK_EQUAL(fft.min, 0.);
+    BOOST_CHECK_EQUAL(fft.max, 0.);
+  }
+}
+
+int main(int argc, char **argv) {
+  boost::mpi::environment mpi_env(argc, argv);
+
+  return boost::unit_test::unit_test_main(init_unit_test, argc, argv);
+}
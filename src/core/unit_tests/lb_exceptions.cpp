@@ -76,8 +76,9 @@ BOOST_AUTO_TEST_CASE(exceptions) {
                     std::invalid_argument);
   ::lattice_switch = ActiveLB::CPU;
   mpi_set_interpolation_order_local(InterpolationOrder::quadratic);
-  BOOST_CHECK_THROW(lb_lbfluid_get_interpolated_density({}), std::exception);
-  BOOST_CHECK_THROW(lb_lbfluid_get_interpolated_velocity({}),
+  BOOST_CHECK_THROW(lb_lbinterpolation_get_interpolated_density({}),
+                    std::runtime_error);
+  BOOST_CHECK_THROW(lb_lbinterpolation_get_interpolated_velocity({}),
                     std::runtime_error);
   BOOST_CHECK_THROW(lb_lbinterpolation_add_force_density({}, {}),
                     std::runtime_error);
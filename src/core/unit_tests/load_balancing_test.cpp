@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Unit tests for the placement of the subdomain boundaries. */
+
+#define BOOST_TEST_MODULE Load balancing test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "load_balancing.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using LoadBalancing::balance_splits;
+
+auto constexpr tol = 100. * std::numeric_limits<double>::epsilon();
+
+BOOST_AUTO_TEST_CASE(balanced_load) {
+  auto const splits = std::vector<double>{0., 0.25, 0.5, 0.75, 1.};
+  auto const result = balance_splits(splits, {1., 1., 1., 1.}, 0.01);
+  BOOST_REQUIRE_EQUAL(result.size(), splits.size());
+  for (std::size_t i = 0; i < splits.size(); ++i) {
+    BOOST_CHECK_CLOSE(result[i], splits[i], tol);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(quantiles) {
+  /* all load in the first subdomain */
+  {
+    auto const result = balance_splits({0., 0.5, 1.}, {4., 0.}, 0.01);
+    BOOST_CHECK_CLOSE(result[1], 0.25, tol);
+  }
+  /* load density 3 on [0, 0.5) and 1 on [0.5, 1) */
+  {
+    auto const result = balance_splits({0., 0.5, 1.}, {3., 1.}, 0.01);
+    BOOST_CHECK_CLOSE(result[1], 1. / 3., tol);
+  }
+  /* non-uniform boundaries */
+  {
+    auto const result = balance_splits({0., 0.2, 0.6, 1.}, {1., 4., 1.}, 0.01);
+    BOOST_REQUIRE_EQUAL(result.size(), 4u);
+    BOOST_CHECK_CLOSE(result[1], 0.3, tol);
+    BOOST_CHECK_CLOSE(result[2], 0.5, tol);
+    BOOST_CHECK_EQUAL(result.front(), 0.);
+    BOOST_CHECK_EQUAL(result.back(), 1.);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(min_width) {
+  /* all load in the last subdomain */
+  auto const result =
+      balance_splits({0., 0.25, 0.5, 0.75, 1.}, {0., 0., 0., 1.}, 0.2);
+  BOOST_REQUIRE_EQUAL(result.size(), 5u);
+  for (std::size_t i = 1; i < result.size(); ++i) {
+    BOOST_CHECK_GE(result[i] - result[i - 1], 0.2 - tol);
+  }
+  BOOST_CHECK_CLOSE(result[3], 0.8, tol);
+}
+
+BOOST_AUTO_TEST_CASE(unchanged) {
+  auto const splits = std::vector<double>{0., 0.3, 1.};
+  /* no load measured */
+  BOOST_CHECK(balance_splits(splits, {0., 0.}, 0.1) == splits);
+  /* minimal width cannot be satisfied */
+  BOOST_CHECK(balance_splits(splits, {1., 2.}, 0.6) == splits);
+}
@@ -26,11 +26,14 @@
 #include "random.hpp"
 #include "random_test.hpp"
 
+#include <utils/Span.hpp>
 #include <utils/Vector.hpp>
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 BOOST_AUTO_TEST_CASE(test_noise_statistics) {
@@ -169,3 +172,43 @@ BOOST_AUTO_TEST_CASE(test_uncorrelated_consecutive_seeds) {
   BOOST_CHECK_SMALL(std::abs(correlation[x][z]), 1e-2);
   BOOST_CHECK_SMALL(std::abs(correlation[y][z]), 1e-2);
 }
+
+BOOST_AUTO_TEST_CASE(test_batch_matches_scalar) {
+  // the batched generators must reproduce the scalar generators bitwise,
+  // including partially filled lanes
+  constexpr std::uint64_t counter = 42u;
+  constexpr std::uint32_t seed = 7u;
+  constexpr std::size_t n = 19u;
+  std::vector<int> keys1(n);
+  std::vector<int> keys2(n);
+  for (std::size_t i = 0u; i < n; ++i) {
+    keys1[i] = static_cast<int>(3u * i + 1u);
+    keys2[i] = static_cast<int>(i % 4u);
+  }
+
+  std::vector<Utils::Vector3d> uniform(n);
+  std::vector<Utils::Vector4d> gaussian(n);
+  Random::noise_uniform_batch<RNGSalt::SALT_DPD>(
+      counter, seed, Utils::make_span(std::as_const(keys1)),
+      Utils::make_span(std::as_const(keys2)), Utils::make_span(uniform));
+  Random::noise_gaussian_batch<RNGSalt::BROWNIAN_WALK, 4>(
+      counter, seed, Utils::make_span(std::as_const(keys1)),
+      Utils::make_span(std::as_const(keys2)), Utils::make_span(gaussian));
+  for (std::size_t i = 0u; i < n; ++i) {
+    auto const ref_uniform = Random::noise_uniform<RNGSalt::SALT_DPD>(
+        counter, seed, keys1[i], keys2[i]);
+    auto const ref_gaussian = Random::noise_gaussian<RNGSalt::BROWNIAN_WALK, 4>(
+        counter, seed, keys1[i], keys2[i]);
+    BOOST_CHECK_EQUAL(uniform[i], ref_uniform);
+    BOOST_CHECK_EQUAL(gaussian[i], ref_gaussian);
+  }
+
+  // an empty second key span is equivalent to key2 = 0
+  Random::noise_uniform_batch<RNGSalt::LANGEVIN>(
+      counter, seed, Utils::make_span(std::as_const(keys1)), {},
+      Utils::make_span(uniform));
+  for (std::size_t i = 0u; i < n; ++i) {
+    BOOST_CHECK_EQUAL(uniform[i], Random::noise_uniform<RNGSalt::LANGEVIN>(
+                                      counter, seed, keys1[i]));
+  }
+}
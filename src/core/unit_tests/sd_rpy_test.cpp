@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE Matrix-free Stokesian Dynamics test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "stokesian_dynamics/lanczos_sqrt.hpp"
+#include "stokesian_dynamics/rpy_mobility.hpp"
+
+#include <utils/Vector.hpp>
+#include <utils/constants.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(rpy_pair_mobility) {
+  auto constexpr tol = 1e-12;
+  auto const eta = 0.7;
+  auto const a_i = 1.0;
+  auto const a_j = 0.5;
+  Utils::Vector3d const f{0.3, -1.2, 2.1};
+  Utils::Vector3d const dir = Utils::Vector3d{1., 2., -0.5}.normalized();
+
+  /* continuous at contact and at full overlap */
+  for (auto const r : {a_i + a_j, a_i - a_j}) {
+    auto const below = rpy_pair_velocity((r - 1e-9) * dir, a_i, a_j, eta, f);
+    auto const above = rpy_pair_velocity((r + 1e-9) * dir, a_i, a_j, eta, f);
+    BOOST_CHECK_SMALL((below - above).norm(), 1e-8);
+  }
+
+  /* symmetric under exchange of the spheres */
+  for (auto const r : {0.2, 0.8, 1.2, 3.}) {
+    auto const v_ij = rpy_pair_velocity(r * dir, a_i, a_j, eta, f);
+    auto const v_ji = rpy_pair_velocity(-r * dir, a_j, a_i, eta, f);
+    BOOST_CHECK_SMALL((v_ij - v_ji).norm(), tol);
+  }
+
+  /* self-mobility of the larger sphere inside the overlap */
+  {
+    auto const v = rpy_pair_velocity(0.1 * dir, a_i, a_j, eta, f);
+    auto const ref = f / (6. * Utils::pi() * eta * a_i);
+    BOOST_CHECK_SMALL((v - ref).norm(), tol);
+  }
+
+  /* Oseen tensor in the far field */
+  {
+    auto const r = 1e4;
+    auto const v = rpy_pair_velocity(r * dir, a_i, a_j, eta, f);
+    auto const ref = (f + (dir * f) * dir) / (8. * Utils::pi() * eta * r);
+    BOOST_CHECK_SMALL((v - ref).norm() / ref.norm(), 1e-7);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(lanczos_matrix_square_root) {
+  auto constexpr n = 6;
+  /* symmetric positive-definite test matrix */
+  std::vector<double> mat(n * n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      mat[i * n + j] = (i == j) ? 2. + i : 1. / (1. + i + j);
+    }
+  }
+  auto const matvec = [&mat](std::vector<double> const &x) {
+    std::vector<double> y(n, 0.);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        y[i] += mat[i * n + j] * x[j];
+      }
+    }
+    return y;
+  };
+  auto const dot = [](std::vector<double> const &a,
+                      std::vector<double> const &b) {
+    return std::inner_product(a.begin(), a.end(), b.begin(), 0.);
+  };
+  std::vector<double> const z{1., -0.5, 0.25, 2., 0., -1.};
+
+  /* applying the square root twice gives the matrix-vector product */
+  auto const sqrt_z = lanczos_sqrt(matvec, dot, z, n, 1e-14);
+  auto const res = lanczos_sqrt(matvec, dot, sqrt_z, n, 1e-14);
+  auto const ref = matvec(z);
+  for (int i = 0; i < n; ++i) {
+    BOOST_CHECK_SMALL(res[i] - ref[i], 1e-10);
+  }
+
+  /* null vector */
+  auto const zero =
+      lanczos_sqrt(matvec, dot, std::vector<double>(n, 0.), n, 1e-14);
+  BOOST_CHECK_EQUAL(dot(zero, zero), 0.);
+
+  /* diagonal matrix converges in one iteration for an eigenvector */
+  {
+    auto const diag = [](std::vector<double> const &x) {
+      std::vector<double> y(x);
+      for (auto &v : y) {
+        v *= 4.;
+      }
+      return y;
+    };
+    auto const v = lanczos_sqrt(diag, dot, z, n, 1e-14);
+    for (std::size_t i = 0; i < z.size(); ++i) {
+      BOOST_CHECK_SMALL(v[i] - 2. * z[i], 1e-12);
+    }
+  }
+}
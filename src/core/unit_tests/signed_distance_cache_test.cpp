@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE SignedDistanceCache test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "constraints/SignedDistanceCache.hpp"
+
+#include <shapes/Sphere.hpp>
+#include <shapes/Union.hpp>
+#include <shapes/Wall.hpp>
+
+#include <utils/Vector.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+BOOST_AUTO_TEST_CASE(error_bound) {
+  auto sphere = std::make_shared<Shapes::Sphere>();
+  sphere->pos() = {4., 5., 6.};
+  sphere->rad() = 2.5;
+  sphere->direction() = -1.;
+  auto wall = std::make_shared<Shapes::Wall>();
+  wall->set_normal({0., 1., 1.});
+  wall->d() = 1.;
+  Shapes::Union shape;
+  shape.add(sphere);
+  shape.add(wall);
+
+  Utils::Vector3d const lower{1., 2., 3.};
+  Utils::Vector3d const upper{9., 8.5, 7.};
+  auto const spacing = 0.3;
+  Constraints::SignedDistanceCache const cache(shape, lower, upper, spacing);
+  BOOST_CHECK(cache.covers(lower, upper, spacing));
+  BOOST_CHECK(not cache.covers(lower, upper, 2. * spacing));
+  BOOST_CHECK_CLOSE(cache.error_bound(), 0.5 * std::sqrt(3.) * spacing, 1e-12);
+
+  // the cached distance is within the error bound of the exact distance
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist_x(lower[0], upper[0]);
+  std::uniform_real_distribution<double> dist_y(lower[1], upper[1]);
+  std::uniform_real_distribution<double> dist_z(lower[2], upper[2]);
+  int n_cached = 0;
+  for (int i = 0; i < 1000; ++i) {
+    Utils::Vector3d const pos{dist_x(gen), dist_y(gen), dist_z(gen)};
+    double dist;
+    Utils::Vector3d vec;
+    try {
+      shape.calculate_dist(pos, dist, vec);
+    } catch (std::domain_error const &) {
+      continue;
+    }
+    if (auto const cached = cache(pos)) {
+      BOOST_CHECK_LE(std::abs(*cached - dist), cache.error_bound());
+      ++n_cached;
+    }
+  }
+  BOOST_CHECK_GT(n_cached, 100);
+
+  // nodes hold the exact distance
+  Utils::Vector3d const node = lower + Utils::Vector3d{10., 10., 9.} * spacing;
+  double dist;
+  Utils::Vector3d vec;
+  shape.calculate_dist(node, dist, vec);
+  BOOST_CHECK_EQUAL(*cache(node), dist);
+
+  // nodes where the distance is not defined are not cached
+  BOOST_CHECK_THROW(shape.calculate_dist(lower, dist, vec), std::domain_error);
+  BOOST_CHECK(not cache(lower));
+
+  // positions outside of the region are not cached
+  BOOST_CHECK(not cache(lower - Utils::Vector3d::broadcast(spacing)));
+  BOOST_CHECK(not cache(upper + Utils::Vector3d::broadcast(spacing)));
+}
+
+BOOST_AUTO_TEST_CASE(exceptions) {
+  Shapes::Sphere const shape;
+  Utils::Vector3d const lower{0., 0., 0.};
+  Utils::Vector3d const upper{1., 1., 1.};
+  BOOST_CHECK_THROW(Constraints::SignedDistanceCache(shape, lower, upper, 0.),
+                    std::domain_error);
+}
@@ -69,7 +69,7 @@ inline void begin_section(const std::string &name) {
  * @param name Identifier of the section.
  */
 inline void end_section(const std::string &name) {
-  ESPRESSO_PROFILER_MARK_BEGIN(name.c_str());
+  ESPRESSO_PROFILER_MARK_END(name.c_str());
 }
 } // namespace Profiler
 #endif
@@ -15,6 +15,7 @@
 # You should have received a copy of the GNU General Public License
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 from .script_interface import ScriptObjectList, ScriptInterfaceHelper, script_interface_register
+from .code_features import assert_features
 import numpy as np
 
 
@@ -75,28 +76,49 @@ class TimeSeries(ScriptInterfaceHelper):
     obs : :class:`espressomd.observables.Observable`
     delta_N : :obj:`int`
         Number of timesteps between subsequent samples for the auto update mechanism.
+    filename : :obj:`str`, optional
+        If given, samples are appended to this file as raw native-endian
+        ``float64`` rows instead of being kept in memory. The file is
+        overwritten by the first sample and only contains samples which
+        have been flushed. Checkpoints only store the buffered samples and
+        a reference to the file, which must not be shared with other
+        accumulators.
+    buffer_size : :obj:`int`, optional
+        Number of samples kept in memory before they are appended to
+        ``filename`` (default: 16).
 
     Methods
     -------
     update()
         Update the accumulator (get the current values from the observable).
     clear()
-        Clear the data
+        Clear the data. Arrays previously returned by :meth:`time_series`
+        for a file-backed accumulator must not be accessed afterwards.
+    flush()
+        Append the buffered samples to ``filename``.
 
     """
     _so_name = "Accumulators::TimeSeries"
     _so_bind_methods = (
         "update",
         "shape",
-        "clear"
+        "clear",
+        "flush"
     )
     _so_creation_policy = "LOCAL"
 
     def time_series(self):
         """
-        Returns the recorded values of the observable.
+        Returns the recorded values of the observable. For a file-backed
+        accumulator, the buffered samples are flushed and a read-only
+        memory map of the file is returned, which does not copy the data.
         """
-        return np.array(self.call_method("time_series")).reshape(self.shape())
+        shape = tuple(self.shape())
+        if self.filename and shape[0] != 0:
+            self.call_method("flush")
+            return np.memmap(self.filename, dtype=np.float64, mode="r",
+                             shape=shape)
+        return np.array(self.call_method("time_series")).reshape(shape)
 
 
 @script_interface_register
@@ -298,6 +320,111 @@ class Correlator(ScriptInterfaceHelper):
         return np.array(self.call_method("get_samples_sizes"), dtype=int)
 
 
+@script_interface_register
+class FFTCorrelator(ScriptInterfaceHelper):
+
+    """
+    Calculates the exact correlation of two observables :math:`A` and
+    :math:`B`, or of one observable against itself (i.e. :math:`B = A`),
+    using every time origin for lag times up to ``tau_max``. The samples
+    are buffered in windows of ``tau_max / (dt * delta_N)`` samples, which
+    are correlated with fast Fourier transforms. Requires the ``FFTW``
+    feature. See :ref:`Exact correlations with FFTs` for more details.
+
+    Parameters
+    ----------
+    obs1 : :class:`espressomd.observables.Observable`
+        The observable :math:`A` to be correlated with :math:`B` (``obs2``).
+        If ``obs2`` is omitted, autocorrelation of ``obs1`` is calculated by
+        default.
+
+    obs2 : :class:`espressomd.observables.Observable`, optional
+        The observable :math:`B` to be correlated with :math:`A` (``obs1``).
+        Must have the same number of values as ``obs1``.
+
+    corr_operation : :obj:`str`
+        The operation that is performed on :math:`A(t)` and
+        :math:`B(t+\\tau)`: one of ``"scalar_product"``,
+        ``"componentwise_product"`` or ``"square_distance_componentwise"``,
+        see :class:`Correlator`.
+
+    delta_N : :obj:`int`
+        Number of timesteps between subsequent samples for the auto update mechanism.
+
+    tau_max : :obj:`float`
+        This is the maximum value of :math:`\\tau` for which the
+        correlation should be computed. The memory footprint is proportional
+        to ``tau_max``.
+
+    Methods
+    -------
+    update()
+        Update the correlator (get the current values from the observables).
+    finalize()
+        Correlate the data left in the incomplete window. No further update
+        is possible afterwards.
+
+    """
+
+    _so_name = "Accumulators::FFTCorrelator"
+    _so_bind_methods = (
+        "update",
+        "shape",
+        "finalize")
+    _so_creation_policy = "LOCAL"
+
+    def __init__(self, **kwargs):
+        assert_features("FFTW")
+        super().__init__(**kwargs)
+
+    def result(self):
+        """
+        Get correlation.
+
+        Returns
+        -------
+        :obj:`ndarray` of :obj:`float`
+            The result of the correlation function. The shape of the array
+            is determined by the shape of the input observable(s) and the
+            correlation operation.
+        """
+        return np.array(self.call_method(
+            "get_correlation")).reshape(self.shape())
+
+    def result_error(self):
+        """
+        Get the standard error of the correlation, estimated from the
+        correlations of the individual windows. The estimate is only
+        meaningful if the windows are longer than the correlation time.
+
+        Returns
+        -------
+        :obj:`ndarray` of :obj:`float`
+            The standard error of the correlation function, with the
+            same shape as :meth:`result`.
+        """
+        return np.array(self.call_method(
+            "get_correlation_error")).reshape(self.shape())
+
+    def lag_times(self):
+        """
+        Returns
+        -------
+        :obj:`ndarray` of :obj:`float`
+            Lag times of the correlation.
+        """
+        return np.array(self.call_method("get_lag_times"))
+
+    def sample_sizes(self):
+        """
+        Returns
+        -------
+        :obj:`ndarray` of :obj:`int`
+            Samples sizes for each lag time.
+        """
+        return np.array(self.call_method("get_samples_sizes"), dtype=int)
+
+
 @script_interface_register
 class AutoUpdateAccumulators(ScriptObjectList):
 
@@ -44,6 +44,10 @@ class CellSystem(ScriptInterfaceHelper):
         Maximal interaction range from all interactions,
         or -1 when no interactions are active (or their
         cutoff has no impact when only 1 MPI rank is used).
+    node_grid_splits : (3,) :obj:`list` of :obj:`list` of :obj:`float`
+        Boundaries of the MPI subdomains along each direction, in units
+        of the box length. Setting :attr:`node_grid` restores subdomains
+        of equal size.
 
     Methods
     -------
@@ -85,6 +89,18 @@ class CellSystem(ScriptInterfaceHelper):
         :obj:`float` :
             The :attr:`skin`
 
+    rebalance()
+        Move the boundaries of the MPI subdomains of the regular
+        decomposition, such that every slab of subdomains along each
+        direction gets the same share of the load.
+
+        Parameters
+        ----------
+        metric : :obj:`str`, optional
+            Load of a MPI rank: ``"particles"`` (default) for the number of
+            particles, or ``"time"`` for the time spent in the short-range
+            force calculation since the last call.
+
     get_state()
         Get the current state of the cell system.
 
@@ -96,7 +112,7 @@ class CellSystem(ScriptInterfaceHelper):
     """
     _so_name = "CellSystem::CellSystem"
     _so_creation_policy = "GLOBAL"
-    _so_bind_methods = ("get_state", "tune_skin", "resort")
+    _so_bind_methods = ("get_state", "tune_skin", "resort", "rebalance")
 
     def __reduce__(self):
         so_callback, so_callback_args = super().__reduce__()
@@ -22,6 +22,7 @@ import os
 import re
 import signal
 from . import utils
+from .particle_data import ParticleList
 
 try:
     import cPickle as pickle
@@ -29,6 +30,49 @@ except ImportError:
     import pickle
 
 
+class _BinaryParticlesPickler(pickle.Pickler):
+    """
+    Pickler that writes particle lists in parallel to a binary file and
+    only stores the file name in the pickle.
+
+    """
+
+    def __init__(self, file, checkpoint_dir, particles_name):
+        super().__init__(file, -1)
+        self.particles_path = os.path.join(checkpoint_dir, particles_name)
+        self.particles_name = particles_name
+
+    def persistent_id(self, obj):
+        if isinstance(obj, ParticleList):
+            obj.call_method("write_checkpoint",
+                            path=self.particles_path + ".__tmp__")
+            return ("ParticleList", self.particles_name)
+        return None
+
+
+class _BinaryParticlesUnpickler(pickle.Unpickler):
+    """
+    Unpickler that restores the particle lists written by
+    :class:`_BinaryParticlesPickler` from their binary file.
+
+    """
+
+    def __init__(self, file, checkpoint_dir):
+        super().__init__(file)
+        self.checkpoint_dir = checkpoint_dir
+
+    def persistent_load(self, pid):
+        type_tag, particles_name = pid
+        if type_tag != "ParticleList":
+            raise pickle.UnpicklingError(
+                f"Unsupported persistent object '{type_tag}'")
+        particles = ParticleList()
+        particles.call_method(
+            "read_checkpoint",
+            path=os.path.join(self.checkpoint_dir, particles_name))
+        return particles
+
+
 # Convenient Checkpointing for ESPResSo
 class Checkpoint:
 
@@ -41,10 +85,16 @@ class Checkpoint:
     checkpoint_path : :obj:`str`, optional
         Path for reading and writing the checkpoint.
         If not given, the current working directory is used.
+    binary_particles : :obj:`bool`, optional
+        Write the particles in parallel to a binary file next to the
+        checkpoint instead of pickling them on the head node.
+        The binary file can only be read by an |es| build with the same
+        features on a machine with the same architecture.
 
     """
 
-    def __init__(self, checkpoint_id=None, checkpoint_path="."):
+    def __init__(self, checkpoint_id=None, checkpoint_path=".",
+                 binary_particles=False):
         # check if checkpoint_id is valid (only allow a-z A-Z 0-9 _ -)
         if not isinstance(checkpoint_id, str) or bool(
                 re.compile(r"[^a-zA-Z0-9_\-]").search(checkpoint_id)):
@@ -55,6 +105,7 @@ class Checkpoint:
 
         self.checkpoint_objects = []
         self.checkpoint_signals = []
+        self.binary_particles = bool(binary_particles)
         frm = inspect.stack()[1]
         self.calling_module = inspect.getmodule(frm[0])
 
@@ -194,7 +245,8 @@ class Checkpoint:
     def save(self, checkpoint_index=None):
         """
         Saves all registered python objects in the given checkpoint directory
-        using cPickle.
+        using cPickle. With ``binary_particles``, the particles are written
+        in parallel to a separate file ``<checkpoint_index>.particles``.
 
         """
         # get attributes of registered objects
@@ -209,8 +261,17 @@ class Checkpoint:
             self.checkpoint_dir, f"{checkpoint_index}.checkpoint")
 
         tmpname = filename + ".__tmp__"
+        particles_name = f"{checkpoint_index}.particles"
         with open(tmpname, "wb") as checkpoint_file:
-            pickle.dump(checkpoint_data, checkpoint_file, -1)
+            if self.binary_particles:
+                pickler = _BinaryParticlesPickler(
+                    checkpoint_file, self.checkpoint_dir, particles_name)
+            else:
+                pickler = pickle.Pickler(checkpoint_file, -1)
+            pickler.dump(checkpoint_data)
+        particles_filename = os.path.join(self.checkpoint_dir, particles_name)
+        if os.path.isfile(particles_filename + ".__tmp__"):
+            os.rename(particles_filename + ".__tmp__", particles_filename)
         os.rename(tmpname, filename)
 
     def load(self, checkpoint_index=None):
@@ -230,7 +291,8 @@ class Checkpoint:
         filename = os.path.join(
             self.checkpoint_dir, f"{checkpoint_index}.checkpoint")
         with open(filename, "rb") as f:
-            checkpoint_data = pickle.load(f)
+            checkpoint_data = _BinaryParticlesUnpickler(
+                f, self.checkpoint_dir).load()
 
         for key in checkpoint_data:
             self.__setattr_submodule(
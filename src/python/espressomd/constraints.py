@@ -109,6 +109,13 @@ class ShapeBasedConstraint(Constraint):
         Whether particles are allowed to penetrate the constraint.
     shape : :class:`espressomd.shapes.Shape`
         One of the shapes from :mod:`espressomd.shapes`
+    distance_cache_spacing : :obj:`float`
+        Grid spacing of an optional cache of the distances to the shape,
+        ``0`` (default) to disable it. Particles that the cache proves to be
+        out of the interaction range skip the exact distance calculation,
+        which speeds up complex shapes; forces are unaffected. The cache
+        is rebuilt when the shape parameters change. It is not used with
+        the DPD thermostat.
 
     See Also
     ----------
@@ -17,7 +17,7 @@
 include "myconfig.pxi"
 from libcpp cimport bool
 
-IF ELECTROKINETICS and CUDA:
+IF ELECTROKINETICS:
     cdef extern from "grid_based_algorithms/electrokinetics.hpp":
 
         DEF MAX_NUMBER_OF_SPECIES = 10
@@ -15,13 +15,13 @@
 # You should have received a copy of the GNU General Public License
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 include "myconfig.pxi"
-IF CUDA:
-    from .lb cimport HydrodynamicInteraction
-    from .lb cimport LBFluidRoutines
-    from .lb cimport lb_lbfluid_print_vtk_boundary
-    from .lb cimport lb_lbnode_is_index_valid
-    from .lb cimport lb_lbfluid_set_lattice_switch
-    from .lb cimport GPU
+from .lb cimport HydrodynamicInteraction
+from .lb cimport LBFluidRoutines
+from .lb cimport lb_lbfluid_print_vtk_boundary
+from .lb cimport lb_lbnode_is_index_valid
+from .lb cimport lb_lbfluid_set_lattice_switch
+from .lb cimport CPU
+from .lb cimport GPU
 from . import utils
 from .utils cimport Vector3i
 import numpy as np
@@ -29,7 +29,8 @@ import numpy as np
 IF ELECTROKINETICS:
     cdef class Electrokinetics(HydrodynamicInteraction):
         """
-        Creates the electrokinetic method using the GPU unit.
+        Creates the electrokinetic method, on the GPU if ESPResSo was compiled
+        with ``CUDA`` and on the CPU otherwise.
 
         """
 
@@ -187,7 +188,10 @@ IF ELECTROKINETICS:
             self._set_params_in_es_core()
             for species in self._params["species"]:
                 species._activate_method()
-            lb_lbfluid_set_lattice_switch(GPU)
+            IF CUDA:
+                lb_lbfluid_set_lattice_switch(GPU)
+            ELSE:
+                lb_lbfluid_set_lattice_switch(CPU)
             self.ek_init()
 
         def neutralize_system(self, species):
@@ -226,7 +230,7 @@ IF ELECTROKINETICS:
         def ek_init(self):
             """
             Initializes the electrokinetic system.
-            This automatically initializes the lattice-Boltzmann method on the GPU.
+            This automatically initializes the lattice-Boltzmann method.
 
             """
             err = ek_init()
@@ -247,9 +247,11 @@ class StokesianDynamics(Integrator):
         Bulk viscosity.
     radii : :obj:`dict`
         Dictionary that maps particle types to radii.
-    approximation_method : :obj:`str`, optional, {'ft', 'fts'}
+    approximation_method : :obj:`str`, optional, {'ft', 'fts', 'rpy'}
         Chooses the method of the mobility approximation.
         ``'fts'`` is more accurate. Default is ``'fts'``.
+        ``'rpy'`` uses the Rotne-Prager-Yamakawa mobility, applied
+        matrix-free on all MPI ranks, which scales to much larger systems.
     self_mobility : :obj:`bool`, optional
         Switches off or on the mobility terms for single particles. Default
         is ``True``.
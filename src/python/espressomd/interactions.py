@@ -720,10 +720,30 @@ class NonBondedInteractions(ScriptInterfaceHelper):
     reset()
         Reset all interaction parameters to their default values.
 
+    set_central_pair_tables()
+        Replace the sum of all isotropic short-range potentials of each
+        pair of particle types by a cubic spline table, to avoid the
+        evaluation of expensive functions in the force kernels. Anisotropic
+        potentials (Gay-Berne, Thole) are still evaluated analytically.
+        The tables are rebuilt whenever interaction parameters change.
+
+        Parameters
+        ----------
+        r_min : :obj:`float`
+            Smallest tabulated distance. Shorter distances are
+            evaluated analytically.
+        n_points : :obj:`int`
+            Number of spline intervals up to the largest cutoff of the
+            tabulated potentials. Use 0 to disable tabulation.
+
+    get_central_pair_tables()
+        Get the parameters of the spline tables as a :obj:`dict`.
+
     """
     _so_name = "Interactions::NonBondedInteractions"
     _so_creation_policy = "GLOBAL"
-    _so_bind_methods = ("reset",)
+    _so_bind_methods = ("reset", "set_central_pair_tables",
+                        "get_central_pair_tables")
 
     def keys(self):
         return [tuple(x) for x in self.call_method("keys")]
@@ -749,12 +769,15 @@ class NonBondedInteractions(ScriptInterfaceHelper):
             for j in range(i, n_types):
                 handle = NonBondedInteractionHandle(_types=(i, j))
                 state.append(((i, j), handle._serialize()))
-        return {"state": state}
+        return {"state": state,
+                "central_pair_tables": self.get_central_pair_tables()}
 
     def __setstate__(self, params):
         for types, kwargs in params["state"]:
             obj = NonBondedInteractionHandle._restore_object(types, kwargs)
             self.call_method("insert", key=types, object=obj)
+        if "central_pair_tables" in params:
+            self.set_central_pair_tables(**params["central_pair_tables"])
 
     @classmethod
     def _restore_object(cls, so_callback, so_callback_args, state):
@@ -82,9 +82,9 @@ class Mpiio(ScriptInterfaceHelper):
         documentation for details.
 
         .. note::
-            The files must be read on the same number of processes that wrote
-            the data. The data must be read on a machine with the same
-            architecture (otherwise, this might silently fail).
+            The files can be read on any number of processes. The data must
+            be read on a machine with the same architecture (otherwise, this
+            might silently fail).
         """
         if prefix is None:
             raise ValueError(
@@ -77,6 +77,18 @@ class H5md(ScriptInterfaceHelper):
         list of valid fields. This list defines the H5MD specifications.
         If the file in ``file_path`` already exists but has different
         specifications, an exception is raised.
+    buffer_size : :obj:`int`, optional
+        Number of frames staged in memory before they are written to disk.
+        Staged frames are also written by :meth:`flush` and :meth:`close`.
+        Larger values amortize the cost of the collective file operations
+        over several frames at the expense of memory. Defaults to 1.
+    chunk_size : :obj:`int`, optional
+        Number of particles per HDF5 chunk. Only used when a new file is
+        created. Defaults to 1000.
+    position_precision : :obj:`float`, optional
+        Absolute precision to which the folded positions are rounded before
+        writing (lossy compression). The rounded trajectory compresses well
+        with tools like ``h5repack``. Defaults to 0 (lossless).
 
     Methods
     -------
@@ -87,13 +99,13 @@ class H5md(ScriptInterfaceHelper):
         Get the list of valid fields.
 
     write()
-        Call the H5md write method.
+        Stage the current frame for writing.
 
     flush()
-        Call the H5md flush method.
+        Write the staged frames and flush the H5md file.
 
     close()
-        Close the H5md file.
+        Write the staged frames and close the H5md file.
 
     Attributes
     ----------
@@ -109,6 +121,9 @@ class H5md(ScriptInterfaceHelper):
     force_unit: :obj:`str`
     velocity_unit: :obj:`str`
     charge_unit: :obj:`str`
+    buffer_size: :obj:`int`
+    chunk_size: :obj:`int`
+    position_precision: :obj:`float`
 
     """
     _so_name = "ScriptInterface::Writer::H5md"
@@ -142,17 +157,23 @@ class H5md(ScriptInterfaceHelper):
             time_unit=unit_system.time,
             force_unit=unit_system.force,
             velocity_unit=unit_system.velocity,
-            charge_unit=unit_system.charge
+            charge_unit=unit_system.charge,
+            buffer_size=params["buffer_size"],
+            chunk_size=params["chunk_size"],
+            position_precision=params["position_precision"]
         )
 
     def default_params(self):
-        return {"unit_system": UnitSystem(), "fields": "all"}
+        return {"unit_system": UnitSystem(), "fields": "all",
+                "buffer_size": 1, "chunk_size": 1000,
+                "position_precision": 0.}
 
     def required_keys(self):
         return {"file_path"}
 
     def valid_keys(self):
-        return {"file_path", "unit_system", "fields"}
+        return {"file_path", "unit_system", "fields", "buffer_size",
+                "chunk_size", "position_precision"}
 
     def validate_params(self, params):
         """Check validity of given parameters.
@@ -326,8 +326,8 @@ cdef class HydrodynamicInteraction(FluidActor):
         ----------
         interpolation_order : :obj:`str`, {"linear", "quadratic"}
             ``"linear"`` for trilinear interpolation, ``"quadratic"`` for
-            quadratic interpolation. For the CPU implementation of LB, only
-            ``"linear"`` is available.
+            quadratic interpolation. For the CPU implementation of LB,
+            ``"quadratic"`` is only available on a single MPI rank.
 
         """
         if interpolation_order == "linear":
@@ -1088,10 +1088,15 @@ class ParticleList(ScriptInterfaceHelper):
             first_id = self.highest_particle_id + 1
             p_list_dict["id"] = np.arange(first_id, first_id + n_parts)
 
-        # Place the particles
-        for i in range(n_parts):
-            p_dict = {k: v[i] for k, v in p_list_dict.items()}
-            self._place_new_particle(p_dict)
+        # Place the particles in a single call if all properties
+        # can be set in bulk, otherwise one particle at a time
+        bulk_dict = _bulk_attributes_or_none(p_list_dict, n_parts)
+        if bulk_dict is not None:
+            self.call_method("add_particles", **bulk_dict)
+        else:
+            for i in range(n_parts):
+                p_dict = {k: v[i] for k, v in p_list_dict.items()}
+                self._place_new_particle(p_dict)
 
         # Return slice of added particles
         return self.by_ids(p_list_dict["id"])
@@ -1240,6 +1245,44 @@ class ParticleList(ScriptInterfaceHelper):
                 "select() takes either selection function as positional argument or a set of keyword arguments.")
 
 
+# Particle properties that can be set for many particles in a single call,
+# with the number of components of each property
+_bulk_attributes = {"id": 1, "pos": 3, "v": 3, "f": 3, "type": 1,
+                    "mol_id": 1, "q": 1, "mass": 1}
+
+
+# Particle properties that can be read for many particles in a single call,
+# with the dtype of the returned array
+_bulk_readback_attributes = {"pos": float, "v": float, "f": float,
+                             "q": float, "type": int, "image_box": int}
+
+
+def _bulk_attributes_or_none(p_list_dict, n_parts):
+    """
+    Convert per-particle properties to arrays suitable for a bulk update.
+    Return ``None`` if any property cannot be set in bulk.
+
+    """
+    bulk_dict = {}
+    for k, v in p_list_dict.items():
+        if k not in _bulk_attributes:
+            return None
+        if k in ("id", "type", "mol_id"):
+            values = np.asarray(v)
+            if not np.issubdtype(values.dtype, np.signedinteger):
+                return None
+        else:
+            try:
+                values = np.asarray(v, dtype=float)
+            except (TypeError, ValueError):
+                return None
+        shape = (n_parts,) if _bulk_attributes[k] == 1 else (n_parts, 3)
+        if values.shape != shape:
+            return None
+        bulk_dict[k] = values
+    return bulk_dict
+
+
 def set_slice_one_for_all(particle_slice, attribute, values):
     for i in particle_slice.id_selection:
         setattr(ParticleHandle(id=i), attribute, values)
@@ -1272,6 +1315,22 @@ def _add_particle_slice_properties():
             raise AttributeError(
                 "Cannot set properties of an empty ParticleSlice")
 
+        # Attributes that can be set in a single call
+        if attribute in _bulk_attributes and attribute != "id":
+            shape = (N,) if _bulk_attributes[attribute] == 1 else (N, 3)
+            try:
+                bulk_values = np.broadcast_to(values, shape)
+            except ValueError:
+                bulk_values = None
+            if bulk_values is not None:
+                bulk_dict = _bulk_attributes_or_none(
+                    {attribute: bulk_values}, N)
+                if bulk_dict is not None:
+                    particle_slice.call_method(
+                        "set_particles_property", name=attribute,
+                        values=bulk_dict[attribute])
+                    return
+
         # Special attributes
         if attribute == "bonds":
             nlvl = nesting_level(values)
@@ -1346,6 +1405,14 @@ def _add_particle_slice_properties():
         if N == 0:
             return np.empty(0, dtype=type(None))
 
+        # Attributes that can be read in a single call
+        if attribute in _bulk_readback_attributes:
+            values = particle_slice.call_method(
+                "get_particles_property", name=attribute)
+            shape = (N,) if attribute in ("q", "type") else (N, 3)
+            return np.reshape(values, shape).astype(
+                _bulk_readback_attributes[attribute])
+
         # get first slice member to determine its type
         target = getattr(ParticleHandle(
             id=particle_slice.id_selection[0]), attribute)
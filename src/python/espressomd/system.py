@@ -151,13 +151,31 @@ class System(ScriptInterfaceHelper):
         alpha : :obj:`float`
             How much to rotate
 
+    get_instrumentation()
+        Get the timers and counters of the integration phases,
+        aggregated over all MPI ranks. The values accumulate until
+        :meth:`reset_instrumentation` is called.
+
+        Returns
+        -------
+        :obj:`dict`
+            Dictionary with keys ``"timers"`` (wall-clock time in seconds)
+            and ``"counters"``. Each maps the name of a phase or event to
+            a dict with the ``"min"``, ``"avg"`` and ``"max"`` over all
+            ranks.
+
+    reset_instrumentation()
+        Reset the timers and counters of the integration phases.
+
     """
     _so_name = "System::System"
     _so_creation_policy = "GLOBAL"
     _so_bind_methods = (
         "setup_type_map",
         "number_of_particles",
-        "rotate_system")
+        "rotate_system",
+        "get_instrumentation",
+        "reset_instrumentation")
 
     def __getattr__(self, attr):
         if attr in self.__dict__.get("_globals_parameters", []):
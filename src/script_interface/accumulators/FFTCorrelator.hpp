@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCRIPT_INTERFACE_CORRELATORS_FFTCORRELATOR_HPP
+#define SCRIPT_INTERFACE_CORRELATORS_FFTCORRELATOR_HPP
+
+#include "config/config.hpp"
+
+#ifdef FFTW
+
+#include "AccumulatorBase.hpp"
+
+#include "script_interface/ScriptInterface.hpp"
+#include "script_interface/auto_parameters/AutoParameters.hpp"
+#include "script_interface/observables/Observable.hpp"
+
+#include "core/accumulators/FFTCorrelator.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace ScriptInterface {
+namespace Accumulators {
+
+class FFTCorrelator : public AccumulatorBase {
+  using CoreCorr = ::Accumulators::FFTCorrelator;
+
+public:
+  FFTCorrelator() {
+    add_parameters(
+        {{"tau_max", m_correlator, &CoreCorr::tau_max},
+         {"corr_operation", m_correlator, &CoreCorr::correlation_operation},
+         {"obs1", std::as_const(m_obs1)},
+         {"obs2", std::as_const(m_obs2)}});
+  }
+
+  void do_construct(VariantMap const &args) override {
+    set_from_args(m_obs1, args, "obs1");
+    if (args.count("obs2"))
+      set_from_args(m_obs2, args, "obs2");
+    else
+      m_obs2 = m_obs1;
+
+    m_correlator = std::make_shared<CoreCorr>(
+        get_value<double>(args, "tau_max"), get_value<int>(args, "delta_N"),
+        get_value<std::string>(args, "corr_operation"), m_obs1->observable(),
+        m_obs2->observable());
+  }
+
+  Variant do_call_method(std::string const &method,
+                         VariantMap const &parameters) override {
+    if (method == "update")
+      m_correlator->update();
+    if (method == "finalize")
+      m_correlator->finalize();
+    if (method == "get_correlation")
+      return m_correlator->get_correlation();
+    if (method == "get_correlation_error")
+      return m_correlator->get_correlation_error();
+    if (method == "get_lag_times")
+      return m_correlator->get_lag_times();
+    if (method == "get_samples_sizes")
+      return m_correlator->get_samples_sizes();
+
+    return AccumulatorBase::call_method(method, parameters);
+  }
+
+  std::shared_ptr<::Accumulators::AccumulatorBase> accumulator() override {
+    return m_correlator;
+  }
+
+  std::shared_ptr<const ::Accumulators::AccumulatorBase>
+  accumulator() const override {
+    return std::static_pointer_cast<::Accumulators::AccumulatorBase>(
+        m_correlator);
+  }
+
+private:
+  std::shared_ptr<CoreCorr> m_correlator;
+
+  std::shared_ptr<Observables::Observable> m_obs1;
+  std::shared_ptr<Observables::Observable> m_obs2;
+
+  std::string get_internal_state() const override {
+    return m_correlator->get_internal_state();
+  }
+
+  void set_internal_state(std::string const &state) override {
+    m_correlator->set_internal_state(state);
+  }
+};
+
+} // namespace Accumulators
+} // namespace ScriptInterface
+
+#endif // FFTW
+#endif
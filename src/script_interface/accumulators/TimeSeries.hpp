@@ -26,7 +26,9 @@
 
 #include <boost/range/algorithm/transform.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -36,14 +38,29 @@ namespace Accumulators {
 
 class TimeSeries : public AccumulatorBase {
 public:
-  TimeSeries() { add_parameters({{"obs", std::as_const(m_obs)}}); }
+  TimeSeries() {
+    add_parameters(
+        {{"obs", std::as_const(m_obs)},
+         {"filename", AutoParameter::read_only,
+          [this]() { return m_accumulator->filename(); }},
+         {"buffer_size", AutoParameter::read_only, [this]() {
+            return static_cast<int>(m_accumulator->buffer_size());
+          }}});
+  }
 
   void do_construct(VariantMap const &params) override {
     set_from_args(m_obs, params, "obs");
 
-    if (m_obs)
+    if (m_obs) {
+      auto const buffer_size = get_value_or<int>(params, "buffer_size", 16);
+      if (buffer_size <= 0) {
+        throw std::domain_error("Parameter 'buffer_size' must be > 0");
+      }
       m_accumulator = std::make_shared<::Accumulators::TimeSeries>(
-          m_obs->observable(), get_value_or<int>(params, "delta_N", 1));
+          m_obs->observable(), get_value_or<int>(params, "delta_N", 1),
+          get_value_or<std::string>(params, "filename", ""),
+          static_cast<std::size_t>(buffer_size));
+    }
   }
 
   Variant do_call_method(std::string const &method,
@@ -64,6 +81,9 @@ public:
     if (method == "clear") {
       m_accumulator->clear();
     }
+    if (method == "flush") {
+      m_accumulator->flush();
+    }
 
     return AccumulatorBase::call_method(method, parameters);
   }
@@ -17,8 +17,11 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "config/config.hpp"
+
 #include "AutoUpdateAccumulators.hpp"
 #include "Correlator.hpp"
+#include "FFTCorrelator.hpp"
 #include "MeanVarianceCalculator.hpp"
 #include "TimeSeries.hpp"
 
@@ -35,6 +38,10 @@ void initialize(Utils::Factory<ObjectHandle> *om) {
   om->register_new<TimeSeries>("Accumulators::TimeSeries");
 
   om->register_new<Correlator>("Accumulators::Correlator");
+
+#ifdef FFTW
+  om->register_new<FFTCorrelator>("Accumulators::FFTCorrelator");
+#endif
 }
 } /* namespace Accumulators */
 } /* namespace ScriptInterface */
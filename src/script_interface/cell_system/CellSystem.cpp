@@ -28,6 +28,7 @@
 #include "core/event.hpp"
 #include "core/grid.hpp"
 #include "core/integrate.hpp"
+#include "core/load_balancing.hpp"
 #include "core/nonbonded_interactions/nonbonded_interaction_data.hpp"
 #include "core/particle_node.hpp"
 #include "core/tuning.hpp"
@@ -124,6 +125,20 @@ CellSystem::CellSystem() {
       {"max_cut_nonbonded", AutoParameter::read_only, maximal_cutoff_nonbonded},
       {"max_cut_bonded", AutoParameter::read_only, maximal_cutoff_bonded},
       {"interaction_range", AutoParameter::read_only, interaction_range},
+      {"node_grid_splits", AutoParameter::read_only,
+       []() {
+         std::vector<Variant> out;
+         for (int i = 0; i < 3; i++) {
+           auto splits = ::node_grid_splits[i];
+           if (splits.empty()) {
+             for (int k = 0; k <= ::node_grid[i]; k++) {
+               splits.emplace_back(static_cast<double>(k) / ::node_grid[i]);
+             }
+           }
+           out.emplace_back(std::move(splits));
+         }
+         return out;
+       }},
   });
 }
 
@@ -225,6 +240,20 @@ Variant CellSystem::do_call_method(std::string const &name,
               get_value_or<bool>(params, "adjust_max_skin", false));
     return ::skin;
   }
+  if (name == "rebalance") {
+    context()->parallel_try_catch([&params]() {
+      auto const metric =
+          get_value_or<std::string>(params, "metric", "particles");
+      if (metric == "particles") {
+        LoadBalancing::rebalance(LoadBalancing::Metric::PARTICLES);
+      } else if (metric == "time") {
+        LoadBalancing::rebalance(LoadBalancing::Metric::TIME);
+      } else {
+        throw std::invalid_argument("Unknown metric '" + metric + "'");
+      }
+    });
+    return {};
+  }
   return {};
 }
 
@@ -56,7 +56,15 @@ public:
                        }
                      },
                      [this]() { return m_shape; }},
-                    {"particle_velocity", m_constraint->velocity()}});
+                    {"particle_velocity", m_constraint->velocity()},
+                    {"distance_cache_spacing",
+                     [this](Variant const &value) {
+                       m_constraint->set_distance_cache_spacing(
+                           get_value<double>(value));
+                     },
+                     [this]() {
+                       return m_constraint->distance_cache_spacing();
+                     }}});
   }
 
   Variant do_call_method(std::string const &name, VariantMap const &) override {
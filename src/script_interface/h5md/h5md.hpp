@@ -50,7 +50,11 @@ public:
          {"time_unit", m_h5md, &::Writer::H5md::File::time_unit},
          {"force_unit", m_h5md, &::Writer::H5md::File::force_unit},
          {"velocity_unit", m_h5md, &::Writer::H5md::File::velocity_unit},
-         {"charge_unit", m_h5md, &::Writer::H5md::File::charge_unit}});
+         {"charge_unit", m_h5md, &::Writer::H5md::File::charge_unit},
+         {"buffer_size", m_h5md, &::Writer::H5md::File::buffer_size},
+         {"chunk_size", m_h5md, &::Writer::H5md::File::chunk_size},
+         {"position_precision", m_h5md,
+          &::Writer::H5md::File::position_precision}});
   };
 
 private:
@@ -62,10 +66,11 @@ private:
     m_h5md = make_shared_from_args<::Writer::H5md::File, std::string,
                                    std::string, std::vector<std::string>,
                                    std::string, std::string, std::string,
-                                   std::string, std::string, std::string>(
+                                   std::string, std::string, std::string, int,
+                                   int, double>(
         params, "file_path", "script_path", "fields", "mass_unit",
         "length_unit", "time_unit", "force_unit", "velocity_unit",
-        "charge_unit");
+        "charge_unit", "buffer_size", "chunk_size", "position_precision");
   }
 
   std::shared_ptr<::Writer::H5md::File> m_h5md;
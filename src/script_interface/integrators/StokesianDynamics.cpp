@@ -61,9 +61,12 @@ StokesianDynamics::StokesianDynamics() {
        }},
       {"approximation_method", AutoParameter::read_only,
        [this]() {
-         return std::string(
-             (get_instance().flags & static_cast<int>(sd_flags::FTS)) ? "fts"
-                                                                      : "ft");
+         auto const flags = get_instance().flags;
+         if (flags & static_cast<int>(sd_flags::RPY)) {
+           return std::string("rpy");
+         }
+         return std::string((flags & static_cast<int>(sd_flags::FTS)) ? "fts"
+                                                                     : "ft");
        }},
   });
 }
@@ -81,6 +84,8 @@ void StokesianDynamics::do_construct(VariantMap const &params) {
         get_value_or<std::string>(params, "approximation_method", "fts");
     if (approx == "fts") {
       bitfield |= static_cast<int>(sd_flags::FTS);
+    } else if (approx == "rpy") {
+      bitfield |= static_cast<int>(sd_flags::RPY);
     } else if (approx != "ft") {
       throw std::invalid_argument("Unknown approximation '" + approx + "'");
     }
@@ -87,6 +87,17 @@ public:
       reset();
       return {};
     }
+    if (name == "set_central_pair_tables") {
+      context()->parallel_try_catch([&]() {
+        set_central_pair_tables(get_value<double>(params, "r_min"),
+                                get_value<int>(params, "n_points"));
+      });
+      return {};
+    }
+    if (name == "get_central_pair_tables") {
+      return VariantMap{{"r_min", get_central_pair_tables_r_min()},
+                        {"n_points", get_central_pair_tables_n_points()}};
+    }
     if (name == "insert") {
       auto const types = get_value<std::vector<int>>(params.at("key"));
       make_particle_type_exist_local(std::max(types[0], types[1]));
@@ -17,17 +17,24 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "config/config.hpp"
+
 #include "ParticleList.hpp"
 #include "ParticleHandle.hpp"
 
 #include "script_interface/ObjectState.hpp"
 #include "script_interface/ScriptInterface.hpp"
 
+#include "core/Particle.hpp"
+#include "core/io/mpiio/mpiio.hpp"
 #include "core/particle_node.hpp"
 
 #include <utils/Vector.hpp>
 #include <utils/serialization/pack.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -55,6 +62,94 @@ static void set_bonds(ParticleHandle &p, Variant const &bonds) {
   }
 }
 
+/**
+ * @brief Apply a per-particle property to particles created in bulk.
+ * @param particles   Particles under construction
+ * @param params      Method parameters, one list of values per property
+ * @param name        Property name
+ * @param setter      Callback that writes one value into a particle
+ */
+template <typename T, typename F>
+static void set_bulk_property(std::vector<Particle> &particles,
+                              VariantMap const &params,
+                              std::string const &name, F const &setter) {
+  if (params.count(name) == 0) {
+    return;
+  }
+  auto const values = get_value<std::vector<T>>(params.at(name));
+  if (values.size() != particles.size()) {
+    throw std::invalid_argument("When adding several particles at once, all "
+                                "lists of attributes have to have the same "
+                                "size");
+  }
+  for (std::size_t i = 0; i < particles.size(); ++i) {
+    setter(particles[i], values[i]);
+  }
+}
+
+static void add_particles(VariantMap const &params) {
+  auto const supported = std::vector<std::string>{
+      "id", "pos", "v", "f", "type", "mol_id", "q", "mass"};
+  for (auto const &kv : params) {
+    if (std::find(supported.begin(), supported.end(), kv.first) ==
+        supported.end()) {
+      throw std::invalid_argument("Attribute '" + kv.first +
+                                  "' cannot be set in bulk");
+    }
+  }
+
+  auto const p_ids = get_value<std::vector<int>>(params, "id");
+  std::vector<Particle> particles(p_ids.size());
+  for (std::size_t i = 0; i < p_ids.size(); ++i) {
+    particles[i].id() = p_ids[i];
+  }
+  set_bulk_property<Utils::Vector3d>(
+      particles, params, "pos",
+      [](Particle &p, Utils::Vector3d const &pos) { p.pos() = pos; });
+  set_bulk_property<Utils::Vector3d>(
+      particles, params, "v",
+      [](Particle &p, Utils::Vector3d const &v) { p.v() = v; });
+  set_bulk_property<Utils::Vector3d>(
+      particles, params, "f",
+      [](Particle &p, Utils::Vector3d const &f) { p.force() = f; });
+  set_bulk_property<int>(particles, params, "type", [](Particle &p, int type) {
+    if (type < 0) {
+      throw std::domain_error(
+          "attribute 'type' of 'ParticleHandle' must be an integer >= 0");
+    }
+    p.type() = type;
+  });
+  set_bulk_property<int>(
+      particles, params, "mol_id", [](Particle &p, int mol_id) {
+        if (mol_id < 0) {
+          throw std::domain_error(
+              "attribute 'mol_id' of 'ParticleHandle' must be an integer >= 0");
+        }
+        p.mol_id() = mol_id;
+      });
+  set_bulk_property<double>(particles, params, "q", [](Particle &p, double q) {
+#ifdef ELECTROSTATICS
+    p.q() = q;
+#else
+    if (q != 0.) {
+      throw std::runtime_error("Feature ELECTROSTATICS not compiled in");
+    }
+#endif // ELECTROSTATICS
+  });
+  set_bulk_property<double>(
+      particles, params, "mass", [](Particle &p, double mass) {
+#ifdef MASS
+        p.mass() = mass;
+#else
+        if (std::abs(mass - 1.) > 1e-10) {
+          throw std::runtime_error("Feature MASS not compiled in");
+        }
+#endif // MASS
+      });
+
+  mpi_make_new_particles(std::move(particles));
+}
+
 std::string ParticleList::get_internal_state() const {
   auto const p_ids = get_particle_ids();
   std::vector<std::string> object_states(p_ids.size());
@@ -153,9 +248,20 @@ Set attribute 'quat' together with 'dipm' (scalar dipole moment) instead.");
 #endif // EXCLUSIONS
     return p_handle.get_parameter("id");
   }
+  if (name == "add_particles") {
+    add_particles(params);
+  }
   if (name == "get_highest_particle_id") {
     return get_maximal_particle_id();
   }
+  if (name == "write_checkpoint") {
+    auto const path = get_value<std::string>(params, "path");
+    Mpiio::mpi_write_particle_checkpoint(path);
+  }
+  if (name == "read_checkpoint") {
+    auto const path = get_value<std::string>(params, "path");
+    Mpiio::mpi_read_particle_checkpoint(path);
+  }
   return {};
 }
 
@@ -17,20 +17,107 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "config/config.hpp"
+
 #include "ParticleSlice.hpp"
 
 #include "script_interface/ScriptInterface.hpp"
 
+#include "core/particle_data.hpp"
 #include "core/particle_node.hpp"
 
 #include <utils/Span.hpp>
+#include <utils/Vector.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ScriptInterface {
 namespace Particles {
 
+/**
+ * @brief Set a property of all particles in a single collective call.
+ * @param p_ids   Particle ids
+ * @param name    Property name
+ * @param values  One value per particle
+ */
+static void set_particles_property(std::vector<int> const &p_ids,
+                                   std::string const &name,
+                                   Variant const &values) {
+  auto const check_non_negative = [&name](std::vector<int> const &vec) {
+    if (std::any_of(vec.begin(), vec.end(), [](int v) { return v < 0; })) {
+      throw std::domain_error("attribute '" + name +
+                              "' of 'ParticleHandle' must be an integer >= 0");
+    }
+  };
+  if (name == "pos") {
+    mpi_set_particles_pos(p_ids,
+                          get_value<std::vector<Utils::Vector3d>>(values));
+  } else if (name == "v") {
+    set_particles_v(p_ids, get_value<std::vector<Utils::Vector3d>>(values));
+  } else if (name == "f") {
+    set_particles_f(p_ids, get_value<std::vector<Utils::Vector3d>>(values));
+  } else if (name == "type") {
+    auto const types = get_value<std::vector<int>>(values);
+    check_non_negative(types);
+    set_particles_type(p_ids, types);
+  } else if (name == "mol_id") {
+    auto const mol_ids = get_value<std::vector<int>>(values);
+    check_non_negative(mol_ids);
+    set_particles_mol_id(p_ids, mol_ids);
+  } else if (name == "q") {
+    auto const charges = get_value<std::vector<double>>(values);
+#ifdef ELECTROSTATICS
+    set_particles_q(p_ids, charges);
+#else
+    if (std::any_of(charges.begin(), charges.end(),
+                    [](double q) { return q != 0.; })) {
+      throw std::runtime_error("Feature ELECTROSTATICS not compiled in");
+    }
+#endif // ELECTROSTATICS
+  } else if (name == "mass") {
+    auto const masses = get_value<std::vector<double>>(values);
+#ifdef MASS
+    set_particles_mass(p_ids, masses);
+#else
+    if (std::any_of(masses.begin(), masses.end(),
+                    [](double m) { return std::abs(m - 1.) > 1e-10; })) {
+      throw std::runtime_error("Feature MASS not compiled in");
+    }
+#endif // MASS
+  } else {
+    throw std::invalid_argument("Attribute '" + name +
+                                "' cannot be set in bulk");
+  }
+}
+
+/**
+ * @brief Get a property of all particles in a single collective call.
+ * @param p_ids   Particle ids
+ * @param name    Property name
+ * @return Flat array of values, in the order of @p p_ids
+ */
+static std::vector<double>
+get_particles_property(std::vector<int> const &p_ids, std::string const &name) {
+  static std::unordered_map<std::string, ParticleBulkProperty> const
+      properties = {{"pos", ParticleBulkProperty::POS},
+                    {"v", ParticleBulkProperty::V},
+                    {"f", ParticleBulkProperty::F},
+                    {"q", ParticleBulkProperty::Q},
+                    {"type", ParticleBulkProperty::TYPE},
+                    {"image_box", ParticleBulkProperty::IMAGE_BOX}};
+  auto const it = properties.find(name);
+  if (it == properties.end()) {
+    throw std::invalid_argument("Attribute '" + name +
+                                "' cannot be read in bulk");
+  }
+  return mpi_get_particles_property(p_ids, it->second);
+}
+
 void ParticleSlice::do_construct(VariantMap const &params) {
   m_id_selection = get_value<std::vector<int>>(params, "id_selection");
   m_chunk_size = get_value_or<int>(params, "prefetch_chunk_size", 10000);
@@ -43,6 +130,13 @@ Variant ParticleSlice::do_call_method(std::string const &name,
     prefetch_particle_data(Utils::Span<int>(p_ids));
   } else if (name == "particle_exists") {
     return particle_exists(get_value<int>(params, "p_id"));
+  } else if (name == "set_particles_property") {
+    set_particles_property(m_id_selection,
+                           get_value<std::string>(params, "name"),
+                           params.at("values"));
+  } else if (name == "get_particles_property") {
+    return get_particles_property(m_id_selection,
+                                  get_value<std::string>(params, "name"));
   }
   return {};
 }
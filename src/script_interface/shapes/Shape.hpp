@@ -29,6 +29,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ScriptInterface {
@@ -53,6 +54,26 @@ public:
 
     return {};
   }
+
+protected:
+  /**
+   * @brief Register parameters whose setters also mark the wrapped shape
+   * as modified, so that data derived from the shape can be invalidated.
+   */
+  void add_parameters(std::vector<AutoParameter> &&params) {
+    std::vector<AutoParameter> wrapped;
+    wrapped.reserve(params.size());
+    for (auto const &p : params) {
+      wrapped.emplace_back(
+          p.name.c_str(),
+          [this, setter = p.setter_](Variant const &v) {
+            setter(v);
+            shape()->modified();
+          },
+          p.getter_);
+    }
+    AutoParameters<Shape>::add_parameters(std::move(wrapped));
+  }
 };
 
 } /* namespace Shapes */
@@ -22,6 +22,7 @@
 #include "config/config.hpp"
 
 #include "core/grid.hpp"
+#include "core/instrumentation.hpp"
 #include "core/object-in-fluid/oif_global_forces.hpp"
 #include "core/particle_data.hpp"
 #include "core/particle_node.hpp"
@@ -29,6 +30,7 @@
 
 #include <utils/Vector.hpp>
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -116,6 +118,31 @@ Variant System::do_call_method(std::string const &name,
     auto const pos2 = get_value<Utils::Vector3d>(parameters, "pos2");
     return ::box_geo.get_mi_vector(pos2, pos1);
   }
+  if (name == "get_instrumentation") {
+    using namespace Instrumentation;
+    auto const report = reduce_report(context()->get_comm());
+    if (not context()->is_head_node()) {
+      return {};
+    }
+    auto const to_variant = [](Statistics const &stats) {
+      return VariantMap{{"min", stats.min}, {"avg", stats.avg},
+                        {"max", stats.max}};
+    };
+    VariantMap timers, counters;
+    for (std::size_t i = 0; i < n_timers; ++i) {
+      timers[Instrumentation::name(static_cast<Timer>(i))] =
+          to_variant(report.timers[i]);
+    }
+    for (std::size_t i = 0; i < n_counters; ++i) {
+      counters[Instrumentation::name(static_cast<Counter>(i))] =
+          to_variant(report.counters[i]);
+    }
+    return VariantMap{{"timers", timers}, {"counters", counters}};
+  }
+  if (name == "reset_instrumentation") {
+    Instrumentation::reset();
+    return {};
+  }
   if (name == "rotate_system") {
     rotate_system(get_value<double>(parameters, "phi"),
                   get_value<double>(parameters, "theta"),
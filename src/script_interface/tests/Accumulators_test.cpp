@@ -21,6 +21,7 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <boost/filesystem.hpp>
 #include <boost/variant.hpp>
 
 #include "script_interface/accumulators/Correlator.hpp"
@@ -29,10 +30,12 @@
 #include "script_interface/get_value.hpp"
 #include "script_interface/observables/ParamlessObservable.hpp"
 
+#include "core/accumulators/TimeSeries.hpp"
 #include "core/observables/Observable.hpp"
 
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -84,6 +87,56 @@ BOOST_AUTO_TEST_CASE(time_series) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(time_series_file) {
+  auto const obs = std::make_shared<TestObs>();
+  auto const filename = std::string("Accumulators_test_time_series.bin");
+  auto const series_ref = std::vector<double>{1., 2., 3., 4.};
+  ScriptInterface::Accumulators::TimeSeries acc;
+  acc.do_construct({{"obs", obs},
+                    {"delta_N", 2},
+                    {"filename", filename},
+                    {"buffer_size", 2}});
+  BOOST_CHECK_EQUAL(get_value<std::string>(acc.get_parameter("filename")),
+                    filename);
+  BOOST_CHECK_EQUAL(get_value<int>(acc.get_parameter("buffer_size")), 2);
+  auto const core_acc =
+      std::dynamic_pointer_cast<::Accumulators::TimeSeries>(acc.accumulator());
+  BOOST_REQUIRE(core_acc);
+  for (int i = 0; i < 3; ++i) {
+    acc.do_call_method("update", VariantMap{});
+  }
+  // only complete buffers are written to the file
+  BOOST_CHECK_EQUAL(boost::filesystem::file_size(filename),
+                    2u * series_ref.size() * sizeof(double));
+  BOOST_CHECK_EQUAL(core_acc->n_samples(), 3u);
+  auto const state = core_acc->get_internal_state();
+  {
+    auto const variant = acc.do_call_method("time_series", VariantMap{});
+    auto const time_series = get_value<std::vector<Variant>>(variant);
+    BOOST_REQUIRE_EQUAL(time_series.size(), 3u);
+    for (auto const &sample : time_series) {
+      auto const series = get_value<std::vector<double>>(sample);
+      BOOST_TEST(series == series_ref, boost::test_tools::per_element());
+    }
+  }
+  acc.do_call_method("flush", VariantMap{});
+  BOOST_CHECK_EQUAL(boost::filesystem::file_size(filename),
+                    3u * series_ref.size() * sizeof(double));
+  // restoring the state discards samples flushed after it was saved
+  core_acc->set_internal_state(state);
+  BOOST_CHECK_EQUAL(core_acc->n_samples(), 3u);
+  BOOST_CHECK_EQUAL(boost::filesystem::file_size(filename),
+                    2u * series_ref.size() * sizeof(double));
+  BOOST_CHECK_EQUAL(core_acc->time_series().size(), 3u);
+  acc.do_call_method("clear", VariantMap{});
+  BOOST_CHECK_EQUAL(core_acc->n_samples(), 0u);
+  BOOST_CHECK_EQUAL(boost::filesystem::file_size(filename), 0u);
+  BOOST_CHECK_THROW(core_acc->set_internal_state(state), std::runtime_error);
+  boost::filesystem::remove(filename);
+  BOOST_CHECK_THROW(acc.do_construct({{"obs", obs}, {"buffer_size", 0}}),
+                    std::domain_error);
+}
+
 BOOST_AUTO_TEST_CASE(correlator) {
   auto const obs = std::make_shared<TestObs>();
   ScriptInterface::Accumulators::Correlator acc;
@@ -24,6 +24,8 @@
 
 #include <utils/Vector.hpp>
 
+#include <cstddef>
+
 namespace Shapes {
 
 class Shape {
@@ -52,7 +54,19 @@ public:
     calculate_dist(pos, dist, vec);
     return dist <= 0.0;
   }
+  /**
+   * @brief Stamp that changes whenever the shape parameters change.
+   * Stamps are drawn from a global counter, hence a larger stamp always
+   * denotes a more recent modification, including in composite shapes.
+   */
+  virtual std::size_t version() const { return m_version; }
+  /** @brief Signal that the shape parameters have changed. */
+  void modified() { m_version = ++s_last_version; }
   virtual ~Shape() = default;
+
+private:
+  static inline std::size_t s_last_version = 0u;
+  std::size_t m_version = 0u;
 };
 
 } /* namespace Shapes */
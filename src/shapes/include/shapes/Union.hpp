@@ -23,8 +23,10 @@
 #include "Shape.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -35,11 +37,13 @@ class Union : public Shape {
 public:
   void add(std::shared_ptr<Shapes::Shape> const &shape) {
     m_shapes.emplace_back(shape);
+    modified();
   }
 
   void remove(std::shared_ptr<Shapes::Shape> const &shape) {
     m_shapes.erase(std::remove(m_shapes.begin(), m_shapes.end(), shape),
                    m_shapes.end());
+    modified();
   }
 
   /**
@@ -78,6 +82,13 @@ public:
         [&pos](auto const &shape) { return shape->is_inside(pos); });
   }
 
+  std::size_t version() const override {
+    return std::accumulate(m_shapes.begin(), m_shapes.end(), Shape::version(),
+                           [](std::size_t v, auto const &shape) {
+                             return std::max(v, shape->version());
+                           });
+  }
+
 private:
   std::vector<std::shared_ptr<Shapes::Shape>> m_shapes;
 };
@@ -66,3 +66,25 @@ BOOST_AUTO_TEST_CASE(dist_function) {
     check_union({1.2, 2.3, 5.5});
   }
 }
+
+BOOST_AUTO_TEST_CASE(version) {
+  auto wall1 = std::make_shared<Shapes::Wall>();
+  auto wall2 = std::make_shared<Shapes::Wall>();
+  Shapes::Union uni;
+
+  auto check_update = [&uni](auto const &update) {
+    auto const old_version = uni.version();
+    update();
+    BOOST_CHECK_GT(uni.version(), old_version);
+  };
+
+  check_update([&]() { uni.add(wall1); });
+  check_update([&]() { uni.add(wall2); });
+  check_update([&]() { wall1->modified(); });
+  check_update([&]() { wall2->modified(); });
+  check_update([&]() { uni.remove(wall2); });
+  auto const version = uni.version();
+  wall2->modified();
+  BOOST_CHECK_EQUAL(uni.version(), version);
+  check_update([&]() { uni.modified(); });
+}
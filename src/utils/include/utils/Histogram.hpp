@@ -79,6 +79,14 @@ public:
     return {m_count.data(), m_count.data() + m_count.num_elements()};
   }
 
+  /** \brief Access the histogram data, e.g. to sum partial histograms. */
+  Span<T> data() { return {m_array.data(), m_array.num_elements()}; }
+
+  /** \brief Access the histogram count data. */
+  Span<std::size_t> count_data() {
+    return {m_count.data(), m_count.num_elements()};
+  }
+
   /** \brief Get the ranges (min, max) for each dimension. */
   std::array<std::pair<U, U>, M> get_limits() const { return m_limits; }
 
@@ -57,6 +57,13 @@ BOOST_AUTO_TEST_CASE(histogram) {
               std::vector<double>{{10.0, 10.0}});
   BOOST_CHECK((hist.get_histogram())[0] == 11.0);
   BOOST_CHECK((hist.get_histogram())[1] == 11.0);
+  // Check that the data can be modified in place, e.g. to sum histograms.
+  hist.data()[0] += 1.0;
+  hist.count_data()[0] += 2;
+  BOOST_CHECK((hist.get_histogram())[0] == 12.0);
+  BOOST_CHECK((hist.get_tot_count())[0] == 4);
+  BOOST_CHECK(hist.data().size() == hist.get_histogram().size());
+  BOOST_CHECK(hist.count_data().size() == hist.get_tot_count().size());
   // Check exceptions
   BOOST_CHECK_THROW(hist.update(std::vector<double>{{1.0, 5.0, 3.0}}),
                     std::invalid_argument);
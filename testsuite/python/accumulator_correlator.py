@@ -18,6 +18,7 @@
 #
 
 import unittest as ut
+import unittest_decorators as utx
 
 import numpy as np
 import pickle
@@ -283,6 +284,81 @@ class CorrelatorTest(ut.TestCase):
                 self.check_pickling(acc_lin)
                 self.check_pickling(acc_def)
 
+    @utx.skipIfMissingFeatures(["FFTW"])
+    def test_fft_correlator(self):
+        system = self.system
+        system.part.add(pos=[[1., 2., 3.], [4., 5., 6.]], v=[[1., 0., 0.],
+                                                             [0., 2., 0.]])
+        system.thermostat.set_langevin(kT=1., gamma=1., seed=42)
+        pos_obs = espressomd.observables.ParticlePositions(ids=(0, 1))
+        vel_obs = espressomd.observables.ParticleVelocities(ids=(0, 1))
+        # tau_max / dt = 10 < tau_lin: the multiple tau correlator is linear
+        accumulators = []
+        for obs, corr_operation in [(pos_obs, "square_distance_componentwise"),
+                                    (vel_obs, "componentwise_product"),
+                                    (vel_obs, "scalar_product")]:
+            kwargs = {"obs1": obs, "tau_max": 0.1, "delta_N": 1,
+                      "corr_operation": corr_operation}
+            acc_fft = espressomd.accumulators.FFTCorrelator(**kwargs)
+            acc_ref = espressomd.accumulators.Correlator(tau_lin=12, **kwargs)
+            system.auto_update_accumulators.add(acc_fft)
+            system.auto_update_accumulators.add(acc_ref)
+            accumulators.append((acc_fft, acc_ref))
+
+        # the last window is incomplete
+        system.integrator.run(137)
+        system.thermostat.turn_off()
+
+        for acc_fft, acc_ref in accumulators:
+            n_lags = acc_fft.lag_times().shape[0]
+            self.assertEqual(n_lags, 11)
+            self.assertEqual(acc_fft.tau_max, 0.1)
+            np.testing.assert_allclose(
+                acc_fft.lag_times(), acc_ref.lag_times()[:n_lags], atol=1e-12)
+            np.testing.assert_array_equal(
+                acc_fft.sample_sizes(), acc_ref.sample_sizes()[:n_lags])
+            np.testing.assert_allclose(
+                acc_fft.result(), acc_ref.result()[:n_lags], rtol=1e-8,
+                atol=1e-10)
+            error = acc_fft.result_error()
+            self.assertEqual(error.shape, acc_fft.result().shape)
+            self.assertTrue(np.all(np.isfinite(error)))
+            self.assertTrue(np.all(error >= 0.))
+            # check pickling
+            acc_unpickled = pickle.loads(pickle.dumps(acc_fft))
+            np.testing.assert_array_equal(acc_unpickled.result(),
+                                          acc_fft.result())
+            np.testing.assert_array_equal(acc_unpickled.sample_sizes(),
+                                          acc_fft.sample_sizes())
+            # finalizing correlates the incomplete window
+            result = acc_fft.result()
+            acc_fft.finalize()
+            np.testing.assert_allclose(acc_fft.result(), result, atol=1e-12)
+            with self.assertRaisesRegex(RuntimeError, r"FFTCorrelator::finalize\(\) can only be called once"):
+                acc_fft.finalize()
+            with self.assertRaisesRegex(RuntimeError, r"No data can be added after finalize\(\) was called."):
+                acc_fft.update()
+
+        # check exceptions
+        kwargs = {"obs1": vel_obs, "tau_max": 0.1, "delta_N": 1,
+                  "corr_operation": "scalar_product"}
+        # round-off in tau_max / delta_t must not add a lag
+        acc_fft = espressomd.accumulators.FFTCorrelator(
+            **{**kwargs, "tau_max": 0.07})
+        self.assertEqual(acc_fft.lag_times().shape[0], 8)
+        acc_fft = espressomd.accumulators.FFTCorrelator(
+            **{**kwargs, "tau_max": 0.075})
+        self.assertEqual(acc_fft.lag_times().shape[0], 9)
+        with self.assertRaisesRegex(ValueError, "correlation operation 'tensor_product' not implemented in the FFT correlator"):
+            espressomd.accumulators.FFTCorrelator(
+                **{**kwargs, "corr_operation": "tensor_product"})
+        with self.assertRaisesRegex(RuntimeError, "tau_max must be >= delta_t"):
+            espressomd.accumulators.FFTCorrelator(**{**kwargs, "delta_N": 20})
+        with self.assertRaisesRegex(RuntimeError, "requires observables of equal dimensions"):
+            espressomd.accumulators.FFTCorrelator(
+                obs2=espressomd.observables.ParticleVelocities(ids=(0,)),
+                **kwargs)
+
     def test_correlator_exceptions(self):
         self.system.part.add(pos=2 * [(0, 0, 0)])
         obs = espressomd.observables.ParticleVelocities(ids=(0,))
@@ -20,7 +20,9 @@
 import unittest as ut
 
 import numpy as np
+import os
 import pickle
+import tempfile
 
 import espressomd
 import espressomd.observables
@@ -72,6 +74,42 @@ class TimeSeriesTest(ut.TestCase):
         acc.clear()
         self.assertEqual(len(acc.time_series()), 0)
 
+    def test_file_backed(self):
+        """Check that samples flushed to disk are read back unchanged."""
+        system = self.system
+        system.part.add(pos=np.zeros((N_PART, 3)))
+        obs = espressomd.observables.ParticlePositions(ids=range(N_PART))
+        positions = np.copy(system.box_l) * np.random.random((7, N_PART, 3))
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            filename = os.path.join(tmp_dir, "time_series.bin")
+            acc = espressomd.accumulators.TimeSeries(
+                obs=obs, filename=filename, buffer_size=3)
+            self.assertEqual(acc.filename, filename)
+            self.assertEqual(acc.buffer_size, 3)
+
+            for pos in positions:
+                system.part.all().pos = pos
+                acc.update()
+
+            # only complete buffers are written
+            self.assertEqual(os.path.getsize(filename), 6 * N_PART * 3 * 8)
+            np.testing.assert_array_equal(acc.time_series(), positions)
+            self.assertEqual(os.path.getsize(filename), positions.nbytes)
+
+            # Check pickling
+            acc_unpickled = pickle.loads(pickle.dumps(acc))
+            np.testing.assert_array_equal(
+                acc_unpickled.time_series(), positions)
+
+            acc.clear()
+            self.assertEqual(len(acc.time_series()), 0)
+            self.assertEqual(os.path.getsize(filename), 0)
+            del acc, acc_unpickled
+
+        with self.assertRaisesRegex(ValueError, "Parameter 'buffer_size' must be > 0"):
+            espressomd.accumulators.TimeSeries(
+                obs=obs, filename="unused.bin", buffer_size=0)
+
 
 if __name__ == "__main__":
     ut.main()
@@ -0,0 +1,99 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+"""
+Binary particle checkpoints written and read with different numbers of
+MPI ranks.
+"""
+
+import unittest as ut
+import espressomd
+import espressomd.checkpointing
+import espressomd.interactions
+import numpy as np
+import rank_change_common as rcc
+
+system = rcc.make_system()
+harmonic = espressomd.interactions.HarmonicBond(k=1., r_0=0.5)
+system.bonded_inter.add(harmonic)
+particles = system.part
+data = rcc.RankChangeData("checkpoint_binary_particles")
+
+
+def make_checkpoint(path):
+    return espressomd.checkpointing.Checkpoint(
+        checkpoint_id=path.name, checkpoint_path=str(path.parent),
+        binary_particles=True)
+
+
+class Write(ut.TestCase):
+
+    def test(self):
+        pos, v, types = rcc.reference_particles(system)
+        system.part.add(pos=pos, v=v, type=types)
+        # bonds and exclusions between particles stored on different ranks
+        for i in range(rcc.n_part - 1):
+            system.part.by_id(i).add_bond((harmonic, i + 1))
+            if espressomd.has_features("EXCLUSIONS") and i + 2 < rcc.n_part:
+                system.part.by_id(i).add_exclusion(i + 2)
+
+        _, path = data.writer_dir(system)
+        checkpoint = make_checkpoint(path)
+        checkpoint.register("particles")
+        checkpoint.save(0)
+
+
+class Read(ut.TestCase):
+
+    def test(self):
+        writers = data.writer_dirs()
+        self.assertGreater(len(writers), 0, "no checkpoint was written")
+        pos, v, types = rcc.reference_particles(system)
+        for n_writers, path in writers:
+            with self.subTest(n_writers=n_writers):
+                system.part.clear()
+                checkpoint = make_checkpoint(path)
+                checkpoint.load(0)
+                self.assertEqual(len(system.part), rcc.n_part)
+                partcls = system.part.by_ids(range(rcc.n_part))
+                np.testing.assert_array_equal(np.copy(partcls.pos), pos)
+                np.testing.assert_array_equal(np.copy(partcls.v), v)
+                np.testing.assert_array_equal(np.copy(partcls.type), types)
+                for i in range(rcc.n_part):
+                    p = system.part.by_id(i)
+                    bonds = [(bond[0].params, bond[1]) for bond in p.bonds]
+                    if i + 1 < rcc.n_part:
+                        self.assertEqual(bonds, [(harmonic.params, i + 1)])
+                    else:
+                        self.assertEqual(bonds, [])
+                    if espressomd.has_features("EXCLUSIONS"):
+                        partners = sorted(p.exclusions)
+                        expected = [j for j in (i - 2, i + 2)
+                                    if 0 <= j < rcc.n_part]
+                        self.assertEqual(partners, expected)
+
+
+class Cleanup(ut.TestCase):
+
+    def test(self):
+        data.remove()
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -1067,6 +1067,84 @@ class ShapeBasedConstraintTest(ut.TestCase):
         system.non_bonded_inter[0, 1].lennard_jones.set_params(
             epsilon=0.0, sigma=0.0, cutoff=0.0, shift=0)
 
+    def test_distance_cache(self):
+        """Checks that the distance cache doesn't change forces or energies.
+
+        """
+        system = self.system
+        system.time_step = 0.01
+        system.cell_system.skin = 0.4
+        system.non_bonded_inter[0, 1].lennard_jones.set_params(
+            epsilon=1.0, sigma=1.0, cutoff=2.5, shift=0)
+
+        pore = espressomd.shapes.SimplePore(
+            axis=[1., 0., 0.], radius=5., smoothing_radius=2., length=10.,
+            center=3 * [self.box_l / 2.])
+        constraint = system.constraints.add(
+            shape=pore, particle_type=1, penetrable=True)
+        self.assertEqual(constraint.distance_cache_spacing, 0.)
+
+        rng = np.random.default_rng(seed=42)
+        system.part.add(pos=rng.random((200, 3)) * self.box_l, type=0)
+
+        def forces_and_energy():
+            system.integrator.run(recalc_forces=True, steps=0)
+            return (np.copy(system.part.all().f),
+                    system.analysis.energy()["total"],
+                    np.copy(constraint.total_force()))
+
+        ref_f, ref_energy, ref_total_f = forces_and_energy()
+        self.assertGreater(np.count_nonzero(ref_f), 0)
+        for spacing in [0.1, 0.7, 3.]:
+            constraint.distance_cache_spacing = spacing
+            self.assertEqual(constraint.distance_cache_spacing, spacing)
+            f, energy, total_f = forces_and_energy()
+            np.testing.assert_array_equal(f, ref_f)
+            self.assertEqual(energy, ref_energy)
+            np.testing.assert_array_equal(total_f, ref_total_f)
+
+        # the cache is rebuilt after a shape update
+        def check_shape_update(shape, **params):
+            constraint.distance_cache_spacing = 0.7
+            forces_and_energy()
+            for key, value in params.items():
+                setattr(shape, key, value)
+            f, _, _ = forces_and_energy()
+            constraint.distance_cache_spacing = 0.
+            ref_f, _, _ = forces_and_energy()
+            np.testing.assert_array_equal(f, ref_f)
+
+        check_shape_update(pore, radius=4.)
+        check_shape_update(pore, center=[self.box_l / 2. + 1.5,
+                                         self.box_l / 2. - 1.,
+                                         self.box_l / 2.])
+
+        wall = espressomd.shapes.Wall(normal=[0., 0., 1.], dist=2.)
+        union = espressomd.shapes.Union()
+        union.add(wall)
+        constraint.shape = union
+        constraint.penetrable = False
+        system.part.all().pos = self.box_l / 2. + rng.random((200, 3)) * 3.
+        check_shape_update(wall, dist=self.box_l / 2. - 1.)
+        check_shape_update(wall, normal=[0., 1., 0.])
+        ref_f, _, _ = forces_and_energy()
+        constraint.distance_cache_spacing = 0.7
+        forces_and_energy()
+        union.add(espressomd.shapes.Sphere(
+            center=3 * [self.box_l / 2. - 1.], radius=0.5))
+        f, _, _ = forces_and_energy()
+        self.assertGreater(np.max(np.abs(f - ref_f)), 0.)
+        constraint.distance_cache_spacing = 0.
+        ref_f, _, _ = forces_and_energy()
+        np.testing.assert_array_equal(f, ref_f)
+
+        with self.assertRaisesRegex(ValueError, "Parameter 'distance_cache_spacing' must be >= 0"):
+            constraint.distance_cache_spacing = -1.
+
+        # Reset
+        system.non_bonded_inter[0, 1].lennard_jones.set_params(
+            epsilon=0.0, sigma=0.0, cutoff=0.0, shift=0)
+
 
 if __name__ == "__main__":
     ut.main()
@@ -29,7 +29,8 @@ import math
 # Build plates using two ek species.
 
 
-@utx.skipIfMissingGPU()
+@ut.skipIf(espressomd.has_features("CUDA") and not espressomd.gpu_available(),
+           "Skipping test: no GPU available")
 @utx.skipIfMissingFeatures(["ELECTROKINETICS"])
 class ek_charged_plate(ut.TestCase):
 
@@ -0,0 +1,90 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+import espressomd
+import espressomd.electrokinetics
+import math
+
+
+@ut.skipIf(espressomd.has_features("CUDA") and not espressomd.gpu_available(),
+           "Skipping test: no GPU available")
+@utx.skipIfMissingFeatures(["ELECTROKINETICS"])
+class ek_charged_slab(ut.TestCase):
+    """
+    Electrostatic potential of a uniformly charged slab in a periodic box
+    with a neutralizing background. The field obtained from the potential
+    difference of neighboring nodes is compared to the solution of the
+    continuum Poisson equation at the midpoint between the nodes.
+
+    """
+
+    box_l = [12., 3., 3.]
+    agrid = 0.5
+    bjerrum_length = 0.8
+    valency = 2.
+    density = 0.1
+    slab = (4., 8.)
+
+    system = espressomd.System(box_l=box_l)
+    system.time_step = 0.1
+    system.cell_system.skin = 0.2
+
+    def field(self, x):
+        charge_density = self.valency * self.density
+        width = self.slab[1] - self.slab[0]
+        background = charge_density * width / self.box_l[0]
+        distance = x - 0.5 * (self.slab[0] + self.slab[1])
+        prefactor = 4. * math.pi * self.bjerrum_length
+        if abs(distance) <= width / 2.:
+            return prefactor * (charge_density - background) * distance
+        return math.copysign(prefactor, distance) * (
+            (charge_density - background) * width / 2. -
+            background * (abs(distance) - width / 2.))
+
+    def test(self):
+        system = self.system
+        agrid = self.agrid
+        ek = espressomd.electrokinetics.Electrokinetics(
+            agrid=agrid, lb_density=1.0, viscosity=1.0, friction=1.0, T=1.0,
+            prefactor=self.bjerrum_length, stencil="linkcentered",
+            advection=False)
+        species = espressomd.electrokinetics.Species(
+            density=0.0, D=0.0, valency=self.valency)
+        ek.add_species(species)
+        system.actors.add(ek)
+
+        shape = [int(round(length / agrid)) for length in self.box_l]
+        for i in range(shape[0]):
+            if self.slab[0] < (i + 0.5) * agrid < self.slab[1]:
+                for j in range(shape[1]):
+                    for k in range(shape[2]):
+                        species[i, j, k].density = self.density
+        system.integrator.run(0)
+
+        potential = [ek[i, 1, 2].potential for i in range(shape[0])]
+        for i in range(shape[0] - 1):
+            measured_field = -(potential[i + 1] - potential[i]) / agrid
+            self.assertAlmostEqual(measured_field, self.field((i + 1) * agrid),
+                                   delta=1e-4)
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -0,0 +1,80 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+import espressomd
+import espressomd.electrokinetics
+import numpy as np
+
+
+@ut.skipIf(espressomd.has_features("CUDA") and not espressomd.gpu_available(),
+           "Skipping test: no GPU available")
+@utx.skipIfMissingFeatures(["ELECTROKINETICS"])
+class ek_diffusion(ut.TestCase):
+    """
+    Free diffusion of a neutral species released on a single node.
+    The total number of particles is conserved and the variance of the
+    distribution grows like :math:`2Dt` along each axis.
+
+    """
+
+    box_l = 16.
+    agrid = 0.5
+    D = 0.05
+    n_steps = 100
+
+    system = espressomd.System(box_l=3 * [box_l])
+    system.time_step = 0.1
+    system.cell_system.skin = 0.2
+
+    def test(self):
+        system = self.system
+        agrid = self.agrid
+        ek = espressomd.electrokinetics.Electrokinetics(
+            agrid=agrid, lb_density=1.0, viscosity=1.0, friction=1.0, T=1.0,
+            prefactor=1.0, stencil="linkcentered", advection=False)
+        species = espressomd.electrokinetics.Species(
+            density=0.0, D=self.D, valency=0.0)
+        ek.add_species(species)
+        system.actors.add(ek)
+
+        n_nodes = int(self.box_l / agrid)
+        center = n_nodes // 2
+        species[center, center, center].density = 1. / agrid**3
+        system.integrator.run(self.n_steps)
+
+        densities = np.zeros(3 * [n_nodes])
+        for i in range(n_nodes):
+            for j in range(n_nodes):
+                for k in range(n_nodes):
+                    densities[i, j, k] = species[i, j, k].density
+        mass = densities * agrid**3
+        self.assertAlmostEqual(np.sum(mass), 1., delta=1e-6)
+
+        distance = (np.arange(n_nodes) - center) * agrid
+        time = self.n_steps * system.time_step
+        for axis in range(3):
+            profile = np.sum(mass, axis=tuple({0, 1, 2} - {axis}))
+            variance = np.sum(profile * distance**2)
+            self.assertAlmostEqual(variance, 2. * self.D * time, delta=1e-5)
+
+
+if __name__ == "__main__":
+    ut.main()
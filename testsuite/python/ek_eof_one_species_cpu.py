@@ -0,0 +1,205 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+
+import math
+
+import espressomd
+import espressomd.electrokinetics
+import espressomd.lbboundaries
+import espressomd.shapes
+
+
+##########################################################################
+# Utility functions
+##########################################################################
+
+def solve(xi, d, bjerrum_length, sigma, valency, el_char=1.0):
+    # root finding function
+    return xi * math.tan(xi * d / 2.0) + 2.0 * math.pi * \
+        bjerrum_length * sigma / (valency * el_char)
+
+
+def density(x, xi, bjerrum_length):
+    return (xi * xi) / (2.0 * math.pi * bjerrum_length *
+                        math.cos(xi * x) * math.cos(xi * x))
+
+
+def velocity(x, xi, d, bjerrum_length, force, visc_kinematic, density_water):
+    return force * math.log(math.cos(xi * x) / math.cos(xi * d / 2.0)) / \
+        (2.0 * math.pi * bjerrum_length * visc_kinematic * density_water)
+
+
+# geometry. The padding is used to ensure that there is no field outside
+# the slit.
+
+params = dict([
+    ('dt', 1.0 / 7),
+    ('integration_length', 2300),
+    ('agrid', 1. / 3),
+    ('density_water', 26.15),
+    ('friction', 1.9),
+    ('width', 20.0),
+    ('thickness', 3.0),
+    ('sigma', -0.04),
+    ('padding', 6.0),
+    ('force', 0.07),
+    ('temperature', 1.1),
+    ('viscosity_kinematic', 1.7),
+    ('bjerrum_length', 0.8),
+    ('valency', 1.0),
+])
+params['density_counterions'] = -2.0 * params['sigma'] / params['width']
+
+
+def bisection():
+    args = [params[k] for k in ('width', 'bjerrum_length', 'sigma', 'valency')]
+    # initial parameters for bisection scheme
+    size = math.pi / (2.0 * params['width'])
+    pnt0 = 0.0
+    pntm = pnt0 + size
+    pnt1 = pnt0 + 1.9 * size
+    # the bisection scheme
+    tol = 1.0e-08
+    while size > tol:
+        size /= 2.0
+        val0, val1, valm = map(lambda x: solve(x, *args), [pnt0, pnt1, pntm])
+        assert val0 < 0.0 and val1 > 0.0, "Bisection method failed"
+        if valm < 0.0:
+            pnt0 = pntm
+            pntm += size
+        else:
+            pnt1 = pntm
+            pntm -= size
+    return pntm
+
+
+@ut.skipIf(espressomd.has_features("CUDA"),
+           "Skipping test: the GPU implementation uses EK boundaries")
+@utx.skipIfMissingFeatures(["ELECTROKINETICS", "LB_BOUNDARIES"])
+class ek_eof_one_species_cpu(ut.TestCase):
+    """
+    Electroosmotic flow of counterions between two charged walls with the
+    CPU implementation, which has no EK boundaries. The fluid is confined
+    by LB boundaries and the surface charge is carried by a fixed density
+    of the counterion species on the boundary nodes.
+
+    """
+
+    system = espressomd.System(box_l=[1.0, 1.0, 1.0])
+    xi = bisection()
+
+    @classmethod
+    def setUpClass(cls):
+        system = cls.system
+        system.box_l = [params['thickness'], params['thickness'],
+                        params['width'] + 2 * params['padding']]
+        system.time_step = params['dt']
+        system.cell_system.skin = 0.1
+        system.thermostat.turn_off()
+
+        # Set up the (LB) electrokinetics fluid
+        ek = cls.ek = espressomd.electrokinetics.Electrokinetics(
+            agrid=params['agrid'],
+            lb_density=params['density_water'],
+            viscosity=params['viscosity_kinematic'],
+            friction=params['friction'],
+            T=params['temperature'],
+            prefactor=params['bjerrum_length'] * params['temperature'],
+            stencil="linkcentered")
+
+        counterions = cls.counterions = espressomd.electrokinetics.Species(
+            density=params['density_counterions'],
+            D=0.3,
+            valency=params['valency'],
+            ext_force_density=[params['force'], 0.0, 0.0])
+        ek.add_species(counterions)
+        system.actors.add(ek)
+
+        # Set up the walls confining the fluid
+        system.lbboundaries.add(espressomd.lbboundaries.LBBoundary(
+            shape=espressomd.shapes.Wall(normal=[0, 0, 1],
+                                         dist=params['padding'])))
+        system.lbboundaries.add(espressomd.lbboundaries.LBBoundary(
+            shape=espressomd.shapes.Wall(
+                normal=[0, 0, -1],
+                dist=-(params['padding'] + params['width']))))
+
+        # Charge the walls
+        n_nodes_xy = int(round(params['thickness'] / params['agrid']))
+        n_nodes_z = int(round(system.box_l[2] / params['agrid']))
+        for k in range(n_nodes_z):
+            position = (k + 0.5) * params['agrid']
+            if params['padding'] < position < params['padding'] + \
+                    params['width']:
+                continue
+            for i in range(n_nodes_xy):
+                for j in range(n_nodes_xy):
+                    counterions[i, j, k].density = \
+                        params['sigma'] / params['padding'] / params['valency']
+
+        # Integrate the system
+        system.integrator.run(params['integration_length'])
+
+    def test(self):
+        # compare the density and the velocity to the analytic results
+        total_velocity_difference = 0.0
+        total_density_difference = 0.0
+
+        agrid = params['agrid']
+        index_xy = int(params['thickness'] / (2 * agrid))
+        n_nodes_z = int(round(self.system.box_l[2] / agrid))
+        for k in range(n_nodes_z):
+            if not (params['padding'] <= k * agrid <
+                    params['padding'] + params['width']):
+                continue
+            position = k * agrid - params['padding'] - \
+                params['width'] / 2.0 + agrid / 2.0
+            node = [index_xy, index_xy, k]
+
+            measured_density = self.counterions[node].density
+            calculated_density = density(
+                position, self.xi, params['bjerrum_length'])
+            total_density_difference += abs(
+                measured_density - calculated_density)
+
+            measured_velocity = self.ek[node].velocity[0]
+            calculated_velocity = velocity(
+                position,
+                self.xi,
+                params['width'],
+                params['bjerrum_length'],
+                params['force'],
+                params['viscosity_kinematic'],
+                params['density_water'])
+            total_velocity_difference += abs(
+                measured_velocity - calculated_velocity)
+
+        total_density_difference *= agrid / params['width']
+        total_velocity_difference *= agrid / params['width']
+        self.assertLess(total_density_difference, 1.0e-04,
+                        "Density accuracy not achieved")
+        self.assertLess(total_velocity_difference, 1.0e-04,
+                        "Velocity accuracy not achieved")
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -46,6 +46,15 @@ class Exclusions(ut.TestCase):
         p0.delete_exclusion(2)
         self.assertEqual(list(p0.exclusions), [])
 
+        # exclusions are stored sorted, independently of insertion order
+        self.system.part.add(id=3, pos=[0, 0, 0])
+        p0.add_exclusion(3)
+        p0.add_exclusion(1)
+        p0.add_exclusion(2)
+        self.assertEqual(list(p0.exclusions), [1, 2, 3])
+        with self.assertRaisesRegex(RuntimeError, "already in exclusion list"):
+            p0.add_exclusion(2)
+
     def test_transfer(self):
         p0 = self.system.part.add(id=0, pos=[0, 0, 0], v=[1., 1., 1])
         self.system.part.add(id=1, pos=[0, 0, 0])
@@ -144,6 +144,34 @@ class H5mdTests(ut.TestCase):
             predicate(cur, f'particles/atoms/box/edges/value')
             predicate(cur, f'connectivity/atoms/value')
 
+    def test_buffered(self):
+        # stage both frames in memory and write them on flush
+        temp_file = self.temp_path / 'buffered.h5'
+        h5 = espressomd.io.writer.h5md.H5md(
+            file_path=str(temp_file), buffer_size=3, chunk_size=7,
+            position_precision=0.25)
+        self.assertEqual(h5.buffer_size, 3)
+        self.assertEqual(h5.chunk_size, 7)
+        self.assertAlmostEqual(h5.position_precision, 0.25, delta=1e-12)
+        h5.write()
+        h5.write()
+        h5.flush()
+        h5.close()
+        with h5py.File(temp_file, 'r') as cur:
+            for key in ('image', 'velocity', 'force', 'id', 'species',
+                        'mass', 'charge'):
+                key = f'particles/atoms/{key}/value'
+                np.testing.assert_allclose(cur[key], self.py_file[key])
+            key = 'particles/atoms/position/value'
+            ref_pos = self.py_file[key][:]
+            self.assertEqual(cur[key].shape, ref_pos.shape)
+            np.testing.assert_allclose(cur[key], ref_pos, atol=0.125)
+            np.testing.assert_allclose(cur[key][:] % 0.25, 0.)
+            np.testing.assert_allclose(cur['connectivity/atoms/value'],
+                                       self.py_file['connectivity/atoms/value'])
+            np.testing.assert_allclose(cur['particles/atoms/id/step'],
+                                       self.py_file['particles/atoms/id/step'])
+
     @ut.skipIf(n_nodes > 1, "only runs for 1 MPI rank")
     def test_exceptions(self):
         h5md = espressomd.io.writer.h5md
@@ -178,6 +206,12 @@ class H5mdTests(ut.TestCase):
         # open a file with invalid specifications
         with self.assertRaisesRegex(ValueError, "Unknown field 'lb'"):
             h5md.H5md(file_path=str(temp_file), fields='lb')
+        with self.assertRaisesRegex(ValueError, "Parameter 'buffer_size' must be > 0"):
+            h5md.H5md(file_path=str(temp_file), buffer_size=0)
+        with self.assertRaisesRegex(ValueError, "Parameter 'chunk_size' must be > 0"):
+            h5md.H5md(file_path=str(temp_file), chunk_size=0)
+        with self.assertRaisesRegex(ValueError, "Parameter 'position_precision' must be >= 0"):
+            h5md.H5md(file_path=str(temp_file), position_precision=-1.)
         # check read-only parameters
         for key in self.h5_obj.get_params():
             with self.assertRaisesRegex(RuntimeError, f"Parameter '{key}' is read-only"):
@@ -0,0 +1,94 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+import numpy as np
+import espressomd
+
+
+@utx.skipIfMissingFeatures(["LENNARD_JONES"])
+class Instrumentation(ut.TestCase):
+    system = espressomd.System(box_l=3 * [10.])
+    system.time_step = 0.01
+    system.cell_system.skin = 0.4
+
+    def setUp(self):
+        # simple cubic lattice with a spacing slightly below the WCA cutoff,
+        # so that every nearest-neighbor pair interacts with a small force
+        grid = 1.05 * np.arange(6)
+        pos = np.array(np.meshgrid(grid, grid, grid)).reshape(3, -1).T
+        self.system.part.add(pos=pos + 0.5)
+        self.system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1., sigma=1., cutoff=2.**(1. / 6.), shift="auto")
+        self.system.integrator.run(0)
+        self.system.reset_instrumentation()
+
+    def tearDown(self):
+        self.system.part.clear()
+        self.system.non_bonded_inter[0, 0].lennard_jones.deactivate()
+
+    def check_statistics(self, stats):
+        self.assertEqual(set(stats.keys()), {"min", "avg", "max"})
+        self.assertGreaterEqual(stats["min"], 0.)
+        self.assertLessEqual(stats["min"], stats["avg"] + 1e-12)
+        self.assertLessEqual(stats["avg"], stats["max"] + 1e-12)
+
+    def test_report(self):
+        n_steps = 20
+        self.system.integrator.run(n_steps)
+        report = self.system.get_instrumentation()
+        timers = report["timers"]
+        counters = report["counters"]
+        self.assertEqual(
+            set(timers.keys()),
+            {"integrate", "force_calc", "short_range", "long_range",
+             "ghost_communication", "fft", "mpi_wait", "lb"})
+        self.assertEqual(
+            set(counters.keys()),
+            {"steps", "pairs", "verlet_rebuilds", "ghost_bytes_sent"})
+        for stats in list(timers.values()) + list(counters.values()):
+            self.check_statistics(stats)
+        # every rank integrates every step
+        for key in ("min", "avg", "max"):
+            self.assertEqual(counters["steps"][key], n_steps)
+        # nested phases are included in their parent phase
+        self.assertGreater(timers["integrate"]["max"], 0.)
+        self.assertGreaterEqual(timers["integrate"]["max"],
+                                timers["force_calc"]["max"])
+        self.assertGreaterEqual(timers["force_calc"]["max"],
+                                timers["short_range"]["max"])
+        self.assertGreater(counters["pairs"]["max"], 0)
+        n_nodes = self.system.cell_system.get_state()["n_nodes"]
+        if n_nodes > 1:
+            self.assertGreater(counters["ghost_bytes_sent"]["max"], 0)
+
+        # values accumulate until reset
+        self.system.integrator.run(n_steps)
+        report = self.system.get_instrumentation()
+        self.assertEqual(report["counters"]["steps"]["avg"], 2 * n_steps)
+        self.system.reset_instrumentation()
+        report = self.system.get_instrumentation()
+        for stats in list(report["timers"].values()) + \
+                list(report["counters"].values()):
+            self.assertEqual(stats, {"min": 0., "avg": 0., "max": 0.})
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -496,6 +496,39 @@ class InteractionsNonBondedTest(ut.TestCase):
                       energy_kernel=gaussian_potential,
                       n_steps=125)
 
+    # Test the spline tables of the isotropic potentials
+    @utx.skipIfMissingFeatures(["MORSE", "GAUSSIAN"])
+    def test_central_pair_tables(self):
+        ia = self.system.non_bonded_inter[0, 0]
+        ia.morse.set_params(eps=1.92, alpha=3.03, rmin=0.923, cutoff=2.253)
+        ia.gaussian.set_params(eps=6.92, sig=1.03, cutoff=1.843)
+        p0, p1 = self.system.part.all()
+
+        def sample():
+            energies = []
+            forces = []
+            for i in range(150):
+                p1.pos = p0.pos + self.axis * (0.6 + 0.011 * i)
+                self.system.integrator.run(recalc_forces=True, steps=0)
+                energies.append(self.system.analysis.energy()["non_bonded"])
+                forces.append(np.copy(p1.f))
+            return np.array(energies), np.array(forces)
+
+        E_ref, f_ref = sample()
+        self.system.non_bonded_inter.set_central_pair_tables(
+            r_min=0.5, n_points=4000)
+        self.assertEqual(self.system.non_bonded_inter.get_central_pair_tables(),
+                         {"r_min": 0.5, "n_points": 4000})
+        E_tab, f_tab = sample()
+        self.system.non_bonded_inter.set_central_pair_tables(
+            r_min=0., n_points=0)
+        np.testing.assert_allclose(E_tab, E_ref, rtol=1e-6, atol=1e-8)
+        np.testing.assert_allclose(f_tab, f_ref, rtol=1e-4, atol=1e-6)
+
+        with self.assertRaisesRegex(ValueError, "Parameter 'r_min' must be > 0"):
+            self.system.non_bonded_inter.set_central_pair_tables(
+                r_min=0., n_points=10)
+
     # Test the Gay-Berne potential and the resulting force and torque
     @utx.skipIfMissingFeatures("GAY_BERNE")
     def test_gb(self):
@@ -465,6 +465,24 @@ class TestLBCPU(TestLB, ut.TestCase):
     lb_class = espressomd.lb.LBFluid
     atol = 1e-10
 
+    @utx.skipIfMissingFeatures("EXTERNAL_FORCES")
+    def test_viscous_coupling_higher_order_interpolation(self):
+        if self.system.cell_system.get_state()["n_nodes"] > 1:
+            lbf = self.lb_class(
+                visc=self.params['viscosity'],
+                dens=self.params['dens'],
+                agrid=self.params['agrid'],
+                tau=self.system.time_step)
+            self.system.actors.add(lbf)
+            lbf.set_interpolation_order("quadratic")
+            with self.assertRaisesRegex(RuntimeError, "only implemented for the CPU LB on one MPI rank"):
+                lbf.get_interpolated_velocity([0., 0., 0.])
+            lbf.set_interpolation_order("linear")
+            return
+        self.interpolation = True
+        self.test_viscous_coupling()
+        self.interpolation = False
+
 
 @utx.skipIfMissingGPU()
 class TestLBGPU(TestLB, ut.TestCase):
@@ -0,0 +1,143 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+import numpy as np
+import espressomd
+import espressomd.electrostatics
+
+
+class LoadBalancing(ut.TestCase):
+    system = espressomd.System(box_l=3 * [20.])
+    system.time_step = 0.01
+    system.cell_system.skin = 0.4
+    n_nodes = system.cell_system.get_state()["n_nodes"]
+    original_node_grid = tuple(system.cell_system.node_grid)
+
+    def setUp(self):
+        np.random.seed(42)
+        self.system.cell_system.set_regular_decomposition()
+        self.system.cell_system.node_grid = self.original_node_grid
+        # particle density increases towards the origin
+        pos = self.system.box_l * np.random.random((800, 3))**2
+        self.system.part.add(pos=pos)
+
+    def tearDown(self):
+        self.system.part.clear()
+        self.system.actors.clear()
+        self.system.non_bonded_inter[0, 0].reset()
+        self.system.cell_system.set_regular_decomposition()
+        self.system.cell_system.node_grid = self.original_node_grid
+
+    def check_splits(self, splits):
+        self.assertEqual(len(splits), 3)
+        for i in range(3):
+            n = self.system.cell_system.node_grid[i]
+            self.assertEqual(len(splits[i]), n + 1)
+            self.assertEqual(splits[i][0], 0.)
+            self.assertEqual(splits[i][-1], 1.)
+            self.assertTrue(np.all(np.diff(splits[i]) > 0.))
+
+    def test_uniform(self):
+        splits = self.system.cell_system.node_grid_splits
+        self.check_splits(splits)
+        for i in range(3):
+            n = self.system.cell_system.node_grid[i]
+            np.testing.assert_allclose(splits[i], np.arange(n + 1) / n)
+
+    @ut.skipIf(n_nodes < 2, "Skipping test: only runs for n_nodes >= 2")
+    def test_particles(self):
+        cell_system = self.system.cell_system
+        counts_ref = np.array(cell_system.resort())
+        cell_system.rebalance(metric="particles")
+        splits = cell_system.node_grid_splits
+        self.check_splits(splits)
+        for i in range(3):
+            if cell_system.node_grid[i] > 1:
+                # boundaries move towards the dense region
+                self.assertLess(splits[i][1], 1. / cell_system.node_grid[i])
+        counts = np.array(cell_system.resort())
+        self.assertEqual(np.sum(counts), len(self.system.part))
+        self.assertLess(np.max(counts) - np.min(counts),
+                        np.max(counts_ref) - np.min(counts_ref))
+        # setting the node grid restores equal subdomains
+        cell_system.node_grid = self.original_node_grid
+        self.test_uniform()
+
+    @utx.skipIfMissingFeatures(["LENNARD_JONES"])
+    def test_forces(self):
+        self.system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1., sigma=0.5, cutoff=1.5, shift="auto")
+        self.system.integrator.run(0, recalc_forces=True)
+        f_ref = np.copy(self.system.part.all().f)
+        e_ref = self.system.analysis.energy()["total"]
+        self.system.cell_system.rebalance()
+        self.system.integrator.run(0, recalc_forces=True)
+        f = np.copy(self.system.part.all().f)
+        e = self.system.analysis.energy()["total"]
+        atol = 1e-10 * np.max(np.abs(f_ref))
+        np.testing.assert_allclose(f, f_ref, rtol=0., atol=atol)
+        self.assertAlmostEqual(e / e_ref, 1., delta=1e-10)
+        # integration with rebalancing in between
+        self.system.force_cap = 10.
+        self.system.integrator.run(10)
+        self.system.cell_system.rebalance(metric="time")
+        self.check_splits(self.system.cell_system.node_grid_splits)
+        self.system.integrator.run(10)
+        self.system.force_cap = 0.
+        self.assertEqual(len(self.system.part), 800)
+
+    def test_exceptions(self):
+        cell_system = self.system.cell_system
+        with self.assertRaisesRegex(ValueError, "Unknown metric 'steps'"):
+            cell_system.rebalance(metric="steps")
+        cell_system.set_n_square()
+        with self.assertRaisesRegex(RuntimeError, "requires the regular decomposition"):
+            cell_system.rebalance()
+
+    @utx.skipIfMissingFeatures(["ELECTROSTATICS"])
+    def test_short_range_electrostatics(self):
+        # purely short-range solvers do not depend on the partition
+        dh = espressomd.electrostatics.DH(prefactor=1., kappa=1., r_cut=1.)
+        self.system.actors.add(dh)
+        self.system.cell_system.rebalance()
+        self.check_splits(self.system.cell_system.node_grid_splits)
+        self.system.integrator.run(0)
+
+    @utx.skipIfMissingFeatures(["P3M"])
+    def test_p3m(self):
+        self.system.part.by_ids([0, 1]).q = [1., -1.]
+        p3m = espressomd.electrostatics.P3M(
+            prefactor=1., accuracy=1e-2, mesh=[16, 16, 16], cao=3,
+            r_cut=1., alpha=2., tune=False)
+        self.system.actors.add(p3m)
+        with self.assertRaisesRegex(RuntimeError, "not compatible with mesh-based or far-field electrostatics methods"):
+            self.system.cell_system.rebalance()
+        self.system.actors.clear()
+        if self.n_nodes > 1:
+            self.system.cell_system.rebalance()
+            self.system.actors.add(p3m)
+            with self.assertRaisesRegex(Exception, "set the node grid to restore equal subdomains"):
+                self.system.integrator.run(0)
+            self.system.actors.clear()
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -103,10 +103,13 @@ class MPIIOTest(ut.TestCase):
         with self.assertRaisesRegex(RuntimeError, f'Could not get file size of "{fn}"'):
             mpiio.read(path, types=True)
 
-        # exception when the MPI world size differs for reading and writing
+        # exception when the dump lists no writer rank
         # (empty .pref file -> data was written with MPI world size of 0)
-        path, _ = generator.create('id', 'pref', read_only=True)
-        with self.assertRaisesRegex(RuntimeError, f'Trying to read a file with a different COMM size than at point of writing'):
+        path, _ = generator.create(
+            'id', 'head', 'type', 'pref', read_only=False, from_ref=path_ref)
+        fn = f'{path}.pref'
+        os.truncate(fn, 0)
+        with self.assertRaisesRegex(RuntimeError, f'No writer rank found in "{fn}"'):
             mpiio.read(path, types=True)
 
         # exception when the particle types don't exist
@@ -0,0 +1,106 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+"""
+MPI-IO dumps written and read with different numbers of MPI ranks.
+"""
+
+import unittest as ut
+import espressomd.interactions
+import espressomd.io
+import numpy as np
+import rank_change_common as rcc
+
+fields = {'types': True, 'positions': True, 'velocities': True,
+          'bonds': True}
+
+system = rcc.make_system()
+harmonic = espressomd.interactions.HarmonicBond(k=1., r_0=0.5)
+angle = espressomd.interactions.AngleHarmonic(bend=1., phi0=np.pi)
+system.bonded_inter.add(harmonic)
+system.bonded_inter.add(angle)
+data = rcc.RankChangeData("mpiio_rank_change")
+
+
+def reference_bonds(pid):
+    """
+    A varying number of pair and angle bonds per particle, such that the
+    bond data of a rank does not split into equal parts. The partners are
+    scattered over the box and mostly stored on other ranks.
+    """
+    bonds = []
+    for k in range(pid % 4):
+        partner = (pid + 7 * k + 1) % rcc.n_part
+        if k % 2 == 0:
+            bonds.append((harmonic, partner))
+        else:
+            bonds.append((angle, partner, (partner + 1) % rcc.n_part))
+    return bonds
+
+
+class Write(ut.TestCase):
+
+    def test(self):
+        pos, v, types = rcc.reference_particles(system)
+        system.part.add(pos=pos, v=v, type=types)
+        for pid in range(rcc.n_part):
+            for bond in reference_bonds(pid):
+                system.part.by_id(pid).add_bond(bond)
+
+        _, path = data.writer_dir(system)
+        mpiio = espressomd.io.mpiio.Mpiio()
+        mpiio.write(str(path / "dump"), **fields)
+
+
+class Read(ut.TestCase):
+
+    def test(self):
+        writers = data.writer_dirs()
+        self.assertGreater(len(writers), 0, "no dump was written")
+        pos, v, types = rcc.reference_particles(system)
+        mpiio = espressomd.io.mpiio.Mpiio()
+        for n_writers, path in writers:
+            with self.subTest(n_writers=n_writers):
+                # the prefix file holds one unsigned long per writing rank
+                n_archives = (path / "dump.pref").stat().st_size // \
+                    np.dtype("L").itemsize
+                self.assertEqual(n_archives, n_writers)
+                system.part.clear()
+                mpiio.read(str(path / "dump"), **fields)
+                self.assertEqual(len(system.part), rcc.n_part)
+                partcls = system.part.by_ids(range(rcc.n_part))
+                np.testing.assert_array_equal(np.copy(partcls.pos), pos)
+                np.testing.assert_array_equal(np.copy(partcls.v), v)
+                np.testing.assert_array_equal(np.copy(partcls.type), types)
+                for pid in range(rcc.n_part):
+                    bonds = [(bond[0].params, *bond[1:])
+                             for bond in system.part.by_id(pid).bonds]
+                    ref_bonds = [(bond[0].params, *bond[1:])
+                                 for bond in reference_bonds(pid)]
+                    self.assertEqual(bonds, ref_bonds)
+
+
+class Cleanup(ut.TestCase):
+
+    def test(self):
+        data.remove()
+
+
+if __name__ == "__main__":
+    ut.main()
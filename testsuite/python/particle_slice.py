@@ -379,6 +379,80 @@ class ParticleSliceTest(ut.TestCase):
         self.assertEqual(p0.type, 0)
         self.assertEqual(p1.type, 1)
 
+    def test_bulk_properties(self):
+        self.system.part.clear()
+        n_part = 10
+        pos = np.random.random((n_part, 3)) * self.system.box_l
+        vel = np.random.random((n_part, 3))
+        types = np.arange(n_part) % 3
+        partcls = self.system.part.add(
+            id=np.arange(20, 20 + n_part), pos=pos, v=vel, type=types)
+        np.testing.assert_array_equal(np.copy(partcls.id),
+                                      np.arange(20, 20 + n_part))
+        np.testing.assert_allclose(np.copy(partcls.pos), pos)
+        np.testing.assert_allclose(np.copy(partcls.v), vel)
+        np.testing.assert_array_equal(np.copy(partcls.type), types)
+        for i, p in enumerate(partcls):
+            np.testing.assert_allclose(np.copy(p.pos), pos[i])
+            self.assertEqual(p.type, types[i])
+        self.assertEqual(self.system.part.highest_particle_id, 29)
+
+        # set properties in bulk
+        partcls.pos = pos[::-1]
+        partcls.v = [1., 2., 3.]
+        partcls.f = vel
+        partcls.type = 4
+        partcls.mol_id = types
+        np.testing.assert_allclose(np.copy(partcls.pos), pos[::-1])
+        np.testing.assert_allclose(np.copy(partcls.v),
+                                   np.tile([1., 2., 3.], (n_part, 1)))
+        np.testing.assert_allclose(np.copy(partcls.f), vel)
+        np.testing.assert_array_equal(np.copy(partcls.type), n_part * [4])
+        np.testing.assert_array_equal(np.copy(partcls.mol_id), types)
+        if espressomd.has_features(["ELECTROSTATICS"]):
+            partcls.q = np.linspace(-1., 1., n_part)
+            np.testing.assert_allclose(np.copy(partcls.q),
+                                       np.linspace(-1., 1., n_part))
+
+        # invalid values
+        with self.assertRaisesRegex(ValueError, "Particle 20 already exists"):
+            self.system.part.add(id=[30, 20], pos=pos[:2])
+        with self.assertRaisesRegex(ValueError, "attribute 'type' of 'ParticleHandle' must be an integer >= 0"):
+            self.system.part.add(id=[30, 31], pos=pos[:2], type=[0, -1])
+        with self.assertRaisesRegex(ValueError, "attribute 'type' of 'ParticleHandle' must be an integer >= 0"):
+            partcls.type = -1
+        self.assertEqual(len(self.system.part), n_part)
+
+    def test_bulk_readback(self):
+        self.system.part.clear()
+        box_l = np.copy(self.system.box_l)
+        pos = np.array([[0.5, 0.5, 0.5],
+                        [-0.5, 1.5, 0.5],
+                        [2.5, 0.5, -1.5],
+                        [1.5, 2.5, 0.5]]) * box_l
+        types = np.array([2, 0, 1, 3])
+        partcls = self.system.part.add(pos=pos, type=types)
+        # read back in a permuted order
+        order = [3, 1, 0, 2]
+        sel = self.system.part.by_ids(order)
+        pos_rb = sel.pos
+        self.assertEqual(pos_rb.dtype, float)
+        np.testing.assert_allclose(pos_rb, pos[order])
+        type_rb = sel.type
+        self.assertTrue(np.issubdtype(type_rb.dtype, np.integer))
+        np.testing.assert_array_equal(type_rb, types[order])
+        image_box = sel.image_box
+        self.assertTrue(np.issubdtype(image_box.dtype, np.integer))
+        np.testing.assert_array_equal(
+            image_box, np.floor(pos[order] / box_l).astype(int))
+        for attribute in ("v", "f", "q"):
+            values = getattr(sel, attribute)
+            for i, p_id in enumerate(order):
+                np.testing.assert_allclose(
+                    values[i],
+                    getattr(self.system.part.by_id(p_id), attribute))
+        partcls.remove()
+
     def test_empty(self):
         np.testing.assert_array_equal(
             self.system.part.by_ids([]).pos, np.empty(0))
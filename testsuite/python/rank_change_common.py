@@ -0,0 +1,77 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+"""
+Data written with one number of MPI ranks and read with another one.
+The ``Write`` tests store their data in a subdirectory named after their
+number of ranks, the ``Read`` tests read every subdirectory they find and
+the ``Cleanup`` test removes the data.
+"""
+
+import espressomd
+import numpy as np
+import pathlib
+import shutil
+
+n_part = 150
+
+
+def make_system():
+    system = espressomd.System(box_l=3 * [10.])
+    system.time_step = 0.01
+    system.cell_system.skin = 0.4
+    return system
+
+
+def reference_particles(system):
+    """Positions, velocities and types of particles spread over the box."""
+    rng = np.random.default_rng(seed=42)
+    pos = rng.random((n_part, 3)) * np.copy(system.box_l)
+    v = rng.random((n_part, 3)) - 0.5
+    types = rng.integers(0, 5, n_part)
+    return pos, v, types
+
+
+class RankChangeData:
+
+    """Directories of the data written by each number of ranks."""
+
+    def __init__(self, name):
+        self.root = pathlib.Path(__file__).parent / f"{name}_data"
+
+    def writer_dir(self, system):
+        """
+        Return the number of ranks and an empty directory for its data.
+        Data left over from a previous run is removed.
+        """
+        n_writers = system.cell_system.get_state()["n_nodes"]
+        path = self.root / str(n_writers)
+        shutil.rmtree(path, ignore_errors=True)
+        path.mkdir(parents=True)
+        return n_writers, path
+
+    def writer_dirs(self):
+        """Return the number of ranks and the directory of all writers."""
+        if not self.root.is_dir():
+            return []
+        return sorted((int(path.name), path) for path in self.root.iterdir()
+                      if path.name.isdigit())
+
+    def remove(self):
+        shutil.rmtree(self.root, ignore_errors=True)
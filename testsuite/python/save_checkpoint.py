@@ -425,6 +425,10 @@ class TestCheckpoint(ut.TestCase):
             self.assertTrue(lbf_cpt_path.is_file(),
                             "LB checkpoint file not created")
 
+        particles_filepath = path_cpt_root / "0.particles"
+        self.assertEqual(particles_filepath.is_file(), 'CPT.BINARY' in modes,
+                         "particle checkpoint file mismatch")
+
         # only objects at global scope can be checkpointed
         with self.assertRaisesRegex(KeyError, "The given object 'local_obj' was not found in the current scope"):
             local_obj = "local"  # pylint: disable=unused-variable
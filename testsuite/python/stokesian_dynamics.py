@@ -105,6 +105,29 @@ class StokesianDynamicsTest(ut.TestCase):
     def test_default_ft(self):
         self.falling_spheres(1.0, 1.0, 1.0, 'ft')
 
+    def test_rpy_pair(self):
+        eta = 1.5
+        a = 1.0
+        d = 4.0
+        g = 0.1
+        self.system.time_step = 0.1
+        partcls = self.system.part.add(
+            pos=[[-d / 2, 0, 0], [d / 2, 0, 0]], rotation=2 * [3 * [True]])
+        self.system.integrator.set_stokesian_dynamics(
+            viscosity=eta, radii={0: a}, approximation_method='rpy')
+        self.assertEqual(
+            self.system.integrator.integrator.approximation_method, 'rpy')
+        self.system.constraints.add(
+            espressomd.constraints.Gravity(g=[0, -g, 0]))
+        self.system.integrator.run(1)
+        # sedimentation perpendicular to the line of centers
+        mu_self = 1. / (6. * np.pi * eta * a)
+        mu_pair = (1. + 2. * a**2 / (3. * d**2)) / (8. * np.pi * eta * d)
+        v_ref = [0., -g * (mu_self + mu_pair), 0.]
+        np.testing.assert_allclose(np.copy(partcls.v),
+                                   [v_ref, v_ref], atol=1e-12)
+        np.testing.assert_allclose(np.copy(partcls.omega_lab), 0., atol=1e-12)
+
 
 @utx.skipIfMissingFeatures(["STOKESIAN_DYNAMICS"])
 class StokesianDiffusionTest(ut.TestCase):
@@ -27,6 +27,7 @@ import tests_common
 @utx.skipIfMissingFeatures(["VIRTUAL_SITES_RELATIVE", "LENNARD_JONES"])
 class VirtualSites(ut.TestCase):
     system = espressomd.System(box_l=[1.0, 1.0, 1.0])
+    min_global_cut = system.min_global_cut
 
     np.random.seed(42)
 
@@ -41,6 +42,7 @@ class VirtualSites(ut.TestCase):
         self.system.integrator.set_vv()
         self.system.non_bonded_inter[0, 0].lennard_jones.deactivate()
         self.system.virtual_sites = espressomd.virtual_sites.VirtualSitesOff()
+        self.system.min_global_cut = self.min_global_cut
 
     def multiply_quaternions(self, a, b):
         return np.array(
@@ -244,6 +246,54 @@ class VirtualSites(ut.TestCase):
             # Check
             self.assertAlmostEqual(np.linalg.norm(t_exp - t), 0., delta=1E-6)
 
+    def test_rigid_body_across_domains(self):
+        """
+        Check a rigid body whose virtual sites are spread over the periodic
+        images and, when running in parallel, over several MPI ranks.
+        """
+        system = self.system
+        system.virtual_sites = espressomd.virtual_sites.VirtualSitesRelative()
+        system.time_step = 0.01
+        system.cell_system.skin = 0.3
+        system.min_global_cut = 3.6
+
+        p_ref = system.part.add(rotation=3 * [True], pos=(9.8, 5.1, 0.3),
+                                v=(0.3, -0.2, 0.1), omega_lab=(0.5, -1., 2.))
+        offsets = np.random.uniform(-2., 2., (40, 3))
+        sites = system.part.add(pos=p_ref.pos + offsets,
+                                rotation=len(offsets) * [3 * [True]])
+        for p in sites:
+            p.vs_auto_relate_to(p_ref)
+        system.integrator.run(0, recalc_forces=True)
+        for p in sites:
+            self.verify_vs(p)
+
+        if espressomd.has_features("EXTERNAL_FORCES"):
+            forces = np.random.uniform(-1., 1., (len(sites), 3))
+            torques = np.random.uniform(-1., 1., (len(sites), 3))
+            sites.ext_force = forces
+            sites.ext_torque = torques
+            system.integrator.run(0, recalc_forces=True)
+            f_exp = np.sum(forces, axis=0)
+            t_exp = np.sum(torques, axis=0)
+            for p, f in zip(sites, forces):
+                t_exp += np.cross(system.distance_vec(p_ref, p), f)
+            np.testing.assert_allclose(np.copy(p_ref.f), f_exp, atol=1E-10)
+            np.testing.assert_allclose(
+                np.copy(p_ref.torque_lab), t_exp, atol=1E-10)
+            sites.ext_force = np.zeros((len(sites), 3))
+            sites.ext_torque = np.zeros((len(sites), 3))
+
+        # Without forces, the body moves ballistically and the sites follow
+        pos_ref = np.copy(p_ref.pos)
+        v_ref = np.copy(p_ref.v)
+        system.integrator.run(20, recalc_forces=True)
+        np.testing.assert_allclose(
+            np.copy(p_ref.pos), pos_ref + 20 * system.time_step * v_ref,
+            atol=1E-10)
+        for p in sites:
+            self.verify_vs(p)
+
     def run_test_lj(self):
         """
         This fills the system with vs-based dumbbells, adds a LJ potential,